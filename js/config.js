@@ -5,7 +5,11 @@ window.CONFIG = {
     websocket: {
         // ⚠ ESP 的 IP — 開機後從 Serial Monitor 或 Windows「行動熱點」看 ESP 拿到的 IP，貼這
         //   只要這行一個地方
+        //   多台讀卡機：改指 hub（tools/hub），例如 'ws://192.168.137.1:8081'，事件會多一個 reader 欄位
         url: 'ws://192.168.137.218:81',
+        // true = 連線時要求二進位協定（?proto=bin），掃描 / hold / 燈條事件改用幾個 byte 的 frame
+        //        舊 firmware 不支援會自動維持 JSON
+        binary: true,
         reconnectMinInterval: 200,
         reconnectMaxInterval: 3000,
         heartbeatInterval: 3000,
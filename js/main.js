@@ -1410,11 +1410,22 @@ function setupStep5Season() {
 
 // ========== NFC hold 揭曉（掃描對應瓶子需 hold 5 秒才揭曉）==========
 const REVEAL_HOLD_MS = 5000;
+// hold 的燈條：琥珀進度條 5 秒從頭長到尾、停在全滿。連線時上傳給 firmware（nfc.js），
+// hold 開始 / 中斷只送 led_play（帶已累積的時間）/ led_stop，不用再每 100ms 推 led_progress
+window.HOLD_LED_TIMELINE = {
+    keys: [
+        { color: [230, 160, 60], amp: 0.7, fill: 0, ease: 'linear', ms: REVEAL_HOLD_MS },
+        { color: [230, 160, 60], amp: 0.7, fill: 1 }
+    ]
+};
 let revealHoldMatchedUID = null;
 let revealHoldMode       = null;  // 'scan' | 'panel'
 let revealHoldStartTime  = 0;
 let revealHoldAccum      = 0;
 let revealHoldTicker     = null;
+// firmware 計時（nfc.js 的 firmwareHold）：進入等掃描時送 hold_target，之後等 hold_progress / hold_complete
+let revealHoldTarget     = null;  // { quoteNumber, mode }：目前要 firmware 等的那一瓶
+let revealHoldFirmware   = false; // firmware 收下了 hold_target，這一輪不用瀏覽器計時
 
 function showRevealHoldUI(mode) {
     const id = mode === 'panel' ? 'quote-panel-reveal-hold' : 'scan-reveal-hold';
@@ -1446,8 +1457,13 @@ function clearRevealHold() {
     revealHoldMode = null;
     revealHoldAccum = 0;
     hideRevealHoldUI();
+    if (revealHoldTarget) {
+        revealHoldTarget = null;
+        revealHoldFirmware = false;
+        sendHoldTarget(-1);
+    }
     // 也把燈條進度歸零（但不切模式，保留 await_scan 等前端決定）
-    sendLedProgress(0);
+    if (!stopLedTimeline()) sendLedProgress(0);
 }
 
 // ========== ESP 燈條控制：透過 WebSocket 推狀態 / hold 進度 ==========
@@ -1455,7 +1471,7 @@ function clearRevealHold() {
 function sendLedMode(mode) {
     if (!window.nfcManager || !window.nfcManager.ws || !window.nfcManager.isConnected) return;
     try {
-        window.nfcManager.ws.send(JSON.stringify({ type: 'led_mode', mode }));
+        window.nfcManager.sendLedMode(mode);
     } catch (e) {}
 }
 
@@ -1473,12 +1489,53 @@ function sendLedProgress(value) {
     _lastLedProgressSend = now;
     _lastLedProgressValue = value;
     try {
-        window.nfcManager.ws.send(JSON.stringify({ type: 'led_progress', value }));
+        window.nfcManager.sendLedProgress(value);
     } catch (e) {}
 }
 window.sendLedMode = sendLedMode;
 window.sendLedProgress = sendLedProgress;
 
+// firmware 有 HOLD_LED_TIMELINE（連線時上傳）→ 從 offsetMs 開始播，回 true 就不用再推 led_progress
+function playLedTimeline(offsetMs) {
+    if (!window.nfcManager || !window.nfcManager.isConnected) return false;
+    try {
+        return window.nfcManager.sendLedPlay(offsetMs);
+    } catch (e) {
+        return false;
+    }
+}
+
+// 停掉 timeline，燈回到 led_mode 的畫面；舊 firmware 回 false，呼叫端照舊送 led_progress 0
+function stopLedTimeline() {
+    if (!window.nfcManager || !window.nfcManager.isConnected) return false;
+    try {
+        return window.nfcManager.sendLedStop();
+    } catch (e) {
+        return false;
+    }
+}
+
+// 進入等掃描：告訴 firmware 要等哪一瓶，5 秒 hold 由 firmware 計時（舊 firmware 回 false，照舊瀏覽器計時）
+function sendHoldTarget(quoteNumber) {
+    if (!window.nfcManager || !window.nfcManager.isConnected) return false;
+    try {
+        return window.nfcManager.sendHoldTarget(quoteNumber, REVEAL_HOLD_MS);
+    } catch (e) {
+        return false;
+    }
+}
+
+function armRevealHold(quoteNumber, mode) {
+    revealHoldTarget = { quoteNumber, mode };
+    revealHoldFirmware = sendHoldTarget(quoteNumber);
+}
+
+// 重連後 firmware 可能重開機過（hold_target 沒了）→ 重送；瀏覽器這邊已經在計時的那一輪就讓它跑完
+window.onNfcConnected = function() {
+    if (!revealHoldTarget || revealHoldTicker) return;
+    revealHoldFirmware = sendHoldTarget(revealHoldTarget.quoteNumber);
+};
+
 // 由 nfc.js 在掃到「對應正確瓶子」時呼叫；mode: 'scan' | 'panel' | 'ai'
 // 'ai' mode：在 chat-result-view 揭曉 AI 雞湯，hold 滿 5 秒呼叫 revealChatQuote
 window.startRevealHold = function(uid, mode) {
@@ -1495,6 +1552,10 @@ window.startRevealHold = function(uid, mode) {
     revealHoldStartTime = performance.now();
     showRevealHoldUI(mode);
     updateRevealHoldUI(revealHoldAccum / REVEAL_HOLD_MS);
+    // firmware 在計時：進度條跟著 hold_progress 走，燈條 firmware 自己畫
+    if (revealHoldFirmware && revealHoldTarget && revealHoldTarget.mode === mode) return;
+    // 燈條進度交給 firmware 自己跑（舊 firmware 才由下面每 100ms 推 led_progress）
+    const ledOnDevice = playLedTimeline(revealHoldAccum);
 
     if (revealHoldTicker) clearInterval(revealHoldTicker);
     revealHoldTicker = setInterval(() => {
@@ -1502,7 +1563,7 @@ window.startRevealHold = function(uid, mode) {
         const total = Math.min(revealHoldAccum + elapsed, REVEAL_HOLD_MS);
         const frac = total / REVEAL_HOLD_MS;
         updateRevealHoldUI(frac);
-        sendLedProgress(frac);  // 推給 ESP 讓琥珀燈跟著變亮
+        if (!ledOnDevice) sendLedProgress(frac);  // 推給 ESP 讓琥珀燈跟著變亮
 
         if (total >= REVEAL_HOLD_MS) {
             clearInterval(revealHoldTicker); revealHoldTicker = null;
@@ -1513,7 +1574,7 @@ window.startRevealHold = function(uid, mode) {
             revealHoldMode = null;
             revealHoldAccum = 0;
             hideRevealHoldUI();
-            sendLedProgress(1);          // 滿進度
+            if (!ledOnDevice) sendLedProgress(1);   // 滿進度（timeline 自己停在全滿）
             if (typeof doReveal === 'function') doReveal();
         }
     }, 50);
@@ -1522,13 +1583,31 @@ window.startRevealHold = function(uid, mode) {
 window.cancelRevealHold = clearRevealHold;
 
 // NFC 卡離開：暫停 hold（保留累積進度，給觀眾重放繼續）
-window.onNfcHoldEnd = function() {
-    if (!revealHoldTicker) return;
+// 感應區上可以同時有兩個瓶子：拿走的不是正在 hold 的那瓶就不理（萬用卡 / 舊韌體沒帶 uid 照舊暫停）
+window.onNfcHoldEnd = function(uid) {
+    if (revealHoldFirmware || !revealHoldTicker) return;
+    if (uid && revealHoldMatchedUID && revealHoldMatchedUID !== 'WILDCARD' && uid !== revealHoldMatchedUID) return;
     const elapsed = performance.now() - revealHoldStartTime;
     revealHoldAccum = Math.min(revealHoldAccum + elapsed, REVEAL_HOLD_MS - 1);
     clearInterval(revealHoldTicker); revealHoldTicker = null;
     // 燈條回到「等待中」的暗呼吸（不會掉到 idle 白色，因為 led_mode 還是 await_scan）
-    sendLedProgress(0);
+    if (!stopLedTimeline()) sendLedProgress(0);
+};
+
+// firmware 計時的進度：瀏覽器只更新進度條（拿走超過 grace 會收到 holding false，進度停在累積的地方）
+window.onHoldProgress = function(message) {
+    if (!revealHoldFirmware || !revealHoldTarget) return;
+    if (!revealHoldMode) showRevealHoldUI(revealHoldTarget.mode);   // show_context 的查表還沒回來
+    updateRevealHoldUI(message.required ? message.ms / message.required : 0);
+};
+
+// firmware 判定累積滿了 → 揭曉（瓶子對不對 firmware 已經照 hold_target 比過）
+window.onHoldComplete = function() {
+    if (!revealHoldFirmware || !revealHoldTarget) return;
+    const mode = revealHoldTarget.mode;
+    const doReveal = mode === 'panel' ? window.revealQuoteInPanel : window.revealQuote;
+    clearRevealHold();
+    if (typeof doReveal === 'function') doReveal();
 };
 
 // 熬製已改為純 UI；NFC hold_start 目前只保留作為相容 hook，不做事
@@ -1596,6 +1675,9 @@ window.advanceFromSoup = function() {
                 // 進入「掃描」階段 → 燈條換琥珀、從最暗開始
                 sendLedMode('await_scan');
                 sendLedProgress(0);
+                if (window.finalQuizResult && window.finalQuizResult.quote) {
+                    armRevealHold(window.finalQuizResult.quote.number, 'scan');
+                }
                 gsap.fromTo(nodes,
                     { opacity: 0, y: 10 },
                     { opacity: 1, y: 0, duration: 0.45, ease: 'power2.out', stagger: 0.08 }
@@ -1802,6 +1884,7 @@ function openQuotePanel(quote) {
         sendLedMode('await_scan');
         sendLedProgress(0);
     }
+    armRevealHold(quote.number, 'panel');
     const panel = document.getElementById('quote-slide-panel');
     const nfcSection = document.getElementById('quote-panel-nfc');
     const revealSection = document.getElementById('quote-panel-reveal');
@@ -11,6 +11,144 @@ function logScanToEsp(uid, matchText) {
     } catch (e) {}
 }
 
+// ===== 二進位 WebSocket 協定（跟 src/ws_binary.h 對應）=====
+// CONFIG.websocket.binary = true 時連線 URL 帶 ?proto=bin；firmware 回 HELLO 才真的切過去，
+// 舊 firmware 會照舊回 JSON 的 connected，這邊就維持 JSON
+const WS_BIN = {
+    HELLO: 0x01,
+    SHOW_CONTEXT: 0x10,
+    RANDOM_QUOTE: 0x11,
+    AI_REVEAL: 0x12,
+    HOLD_START: 0x13,
+    HOLD_END: 0x14,
+    HOLD_PROGRESS: 0x15,
+    HOLD_COMPLETE: 0x16,
+    EVENTS: 0x20,
+    HEARTBEAT: 0x80,
+    LED_MODE: 0x81,
+    LED_PROGRESS: 0x82,
+    CURRENT_QUOTE: 0x83,
+    LED_TIMELINE: 0x84,
+    LED_PLAY: 0x85,
+    LED_SEEK: 0x86,
+    LED_STOP: 0x87,
+    HOLD_TARGET: 0x88
+};
+const WS_BIN_LED_MODES = ['idle', 'await_scan', 'revealed'];
+
+// ===== 燈條 keyframe timeline（跟 src/led_timeline.h 對應）=====
+// 每個 keyframe 8 bytes：[r][g][b][amp][fill][ease][ms u16 LE]，amp / fill 是 0~1 → 0~255
+const LED_EASES = ['step', 'linear', 'in', 'out', 'in_out'];
+const LED_NO_LOOP = 0xff;
+
+function encodeLedKeyframes(keys) {
+    const out = new Uint8Array(keys.length * 8);
+    keys.forEach((k, i) => {
+        const byte = v => Math.max(0, Math.min(255, Math.round(v * 255)));
+        const ms = Math.max(0, Math.min(0xffff, Math.round(k.ms || 0)));
+        const ease = LED_EASES.indexOf(k.ease || 'linear');
+        out.set([k.color[0], k.color[1], k.color[2], byte(k.amp), byte(k.fill || 0),
+                 ease < 0 ? 1 : ease, ms & 0xff, ms >> 8], i * 8);
+    });
+    return out;
+}
+
+function withBinaryProto(url) {
+    if (url.includes('?')) return `${url}&proto=bin`;
+    return `${url}${url.endsWith('/') ? '' : '/'}?proto=bin`;
+}
+
+// float → IEEE 754 half（進度只有 0~1，但還是照標準處理，round to nearest even）
+function floatToHalf(value) {
+    const f32 = new Float32Array(1);
+    const u32 = new Uint32Array(f32.buffer);
+    f32[0] = value;
+    const f = u32[0];
+    const sign = (f >>> 16) & 0x8000;
+    const exp8 = (f >>> 23) & 0xff;
+    let mant = f & 0x7fffff;
+    if (exp8 === 0xff) return sign | 0x7c00 | (mant ? 0x200 : 0);
+    const exp = exp8 - 127 + 15;
+    if (exp >= 0x1f) return sign | 0x7c00;
+    if (exp <= 0) {
+        if (exp < -10) return sign;
+        mant |= 0x800000;
+        const shift = 14 - exp;
+        let half = mant >>> shift;
+        const rest = mant & ((1 << shift) - 1);
+        const mid = 1 << (shift - 1);
+        if (rest > mid || (rest === mid && (half & 1))) half++;
+        return sign | half;
+    }
+    let half = (exp << 10) | (mant >>> 13);
+    const rest = mant & 0x1fff;
+    if (rest > 0x1000 || (rest === 0x1000 && (half & 1))) half++;
+    return sign | half;
+}
+
+// [op][uidLength][uid × 7] → "04:A1:..."（SHOW_CONTEXT / HOLD_START / HOLD_END 共用）
+function decodeWsBinaryUID(b) {
+    const uidLength = Math.min(b[1], 7);
+    return Array.from(b.subarray(2, 2 + uidLength))
+        .map(x => x.toString(16).toUpperCase().padStart(2, '0'))
+        .join(':');
+}
+
+// 二進位 frame → 跟 JSON 一樣形狀的 message，後面的 switch 共用；不認得回 null
+function decodeWsBinary(buffer) {
+    const b = buffer instanceof Uint8Array ? buffer : new Uint8Array(buffer);
+    if (b.length === 0) return null;
+    switch (b[0]) {
+        case WS_BIN.EVENTS: {
+            // [op][seq u32][t u32][len][事件][len][事件]...（src/event_queue.h）
+            if (b.length < 9) return null;
+            const view = new DataView(b.buffer, b.byteOffset, b.byteLength);
+            const events = [];
+            for (let i = 9; i < b.length;) {
+                const n = b[i++];
+                if (n === 0 || i + n > b.length) return null;
+                const event = decodeWsBinary(b.subarray(i, i + n));
+                if (event) events.push(event);
+                i += n;
+            }
+            return { type: 'events', seq: view.getUint32(1, true), t: view.getUint32(5, true), events };
+        }
+        case WS_BIN.HELLO:
+            return { type: 'connected', binary: true, version: b[1] };
+        case WS_BIN.SHOW_CONTEXT: {
+            if (b.length < 10) return null;
+            const message = { type: 'show_context', uid: decodeWsBinaryUID(b) };
+            if (b[9] > 0) message.quoteNumber = b[9];
+            return message;
+        }
+        case WS_BIN.RANDOM_QUOTE: return { type: 'random_quote' };
+        case WS_BIN.AI_REVEAL: return { type: 'ai_reveal' };
+        case WS_BIN.HOLD_START:
+        case WS_BIN.HOLD_END: {
+            // version 1 的 firmware 只送 [op]，沒有 uid
+            const message = { type: b[0] === WS_BIN.HOLD_START ? 'nfc_hold_start' : 'nfc_hold_end' };
+            if (b.length >= 9) message.uid = decodeWsBinaryUID(b);
+            return message;
+        }
+        case WS_BIN.HOLD_PROGRESS: {
+            // [op][uidLen][uid×7][held u16][required u16][holding]
+            if (b.length < 14) return null;
+            const view = new DataView(b.buffer, b.byteOffset, b.byteLength);
+            return {
+                type: 'hold_progress', uid: decodeWsBinaryUID(b),
+                ms: view.getUint16(9, true), required: view.getUint16(11, true), holding: b[13] !== 0
+            };
+        }
+        case WS_BIN.HOLD_COMPLETE: {
+            if (b.length < 11) return null;
+            const view = new DataView(b.buffer, b.byteOffset, b.byteLength);
+            return { type: 'hold_complete', uid: decodeWsBinaryUID(b), ms: view.getUint16(9, true) };
+        }
+        case WS_BIN.HEARTBEAT: return { type: 'heartbeat' };
+        default: return null;
+    }
+}
+
 class NFCManager {
     constructor() {
         this.ws = null;
@@ -19,6 +157,10 @@ class NFCManager {
         this.heartbeatWatchdog = null;
         this.lastMessageTime = 0;
         this.currentQuoteNumber = -1; // 當前顯示的雞湯編號
+        this.binary = false; // firmware 回了二進位 HELLO 才是 true
+        this.ledTimeline = false; // firmware 認得 led_timeline（JSON 的 connected 帶 timeline、二進位 HELLO v3 以上）
+        this.firmwareHold = false; // firmware 自己計時 5 秒 hold（JSON 的 connected 帶 hold、二進位 HELLO v4 以上）
+        this.lastSeq = 0; // 最近一個事件 frame 的 seq（0 = 還沒收到過）；重連不清掉，拿來要 replay
 
         // 事件回調
         this.onReadCallback = null;
@@ -32,14 +174,19 @@ class NFCManager {
     // 開 → 用 → 斷了 setTimeout 2 秒重連，沒了
     // 沒有 library、沒有 heartbeat watchdog、沒有複雜的重連邏輯
     connect(url = CONFIG.websocket.url) {
-        log(`連線到 ${url}`);
         this._url = url;
-        this.ws = new WebSocket(url);
+        const wsUrl = CONFIG.websocket.binary ? withBinaryProto(url) : url;
+        log(`連線到 ${wsUrl}`);
+        this.binary = false;
+        this.ws = new WebSocket(wsUrl);
+        this.ws.binaryType = 'arraybuffer';
 
         this.ws.addEventListener('open', () => {
             log('WebSocket 連線成功', 'info');
             this.isConnected = true;
             this.updateUIStatus(true);
+            // 斷線期間掃的卡 firmware 記在 journal：從最後收到的 seq 之後補拿
+            if (this.lastSeq > 0) this.requestReplay(this.lastSeq);
             if (this.onConnectCallback) this.onConnectCallback();
         });
 
@@ -50,6 +197,7 @@ class NFCManager {
         this.ws.addEventListener('close', () => {
             log('WebSocket 連線關閉，2 秒後重連', 'warn');
             this.isConnected = false;
+            this.binary = false;
             this.updateUIStatus(false);
             if (this.onDisconnectCallback) this.onDisconnectCallback();
             // 純粹斷了再連，沒有指數 backoff、沒有 retry limit
@@ -62,85 +210,146 @@ class NFCManager {
     // 處理接收到的訊息
     handleMessage(data) {
         try {
-            const message = JSON.parse(data);
+            const message = data instanceof ArrayBuffer ? decodeWsBinary(data) : JSON.parse(data);
+            if (!message) {
+                log(`不認得的二進位訊息 (${data.byteLength} bytes)`, 'warn');
+                return;
+            }
             log(`收到訊息: ${JSON.stringify(message)}`, 'info');
 
-            switch (message.type) {
-                case 'connected':
-                    log('ESP8266 連線確認', 'info');
-                    break;
-                case 'nfc_hold_start':
-                    // 觸發卡剛被放上去 → 通知熬製頁開始 5 秒 hold 計時
-                    if (typeof window.onNfcHoldStart === 'function') window.onNfcHoldStart();
-                    break;
-                case 'nfc_hold_end':
-                    // 觸發卡離開 → 暫停 hold 計時（保留目前進度）
-                    if (typeof window.onNfcHoldEnd === 'function') window.onNfcHoldEnd();
-                    break;
-                case 'random_quote':
-                    // 萬用卡：隨機抽雞湯 / soup / panel 階段當任意瓶子
-                    this.handleRandomQuote(message);
-                    break;
-                case 'ai_reveal':
-                    // AI 解鎖卡：只在 chat-result-view 揭曉 AI 原句
-                    this.handleAIReveal();
-                    break;
-                case 'category_selected':
-                    // 處理分類選擇（保留向下相容）
-                    this.handleCategorySelected(message);
-                    break;
-                case 'show_context':
-                    // 處理顯示脈絡（舊版，保留相容性）
-                    this.handleShowContext(message);
-                    break;
-                case 'toggle_context':
-                    // 處理切換脈絡顯示
-                    this.handleToggleContext(message);
-                    break;
-                case 'save_quote':
-                    // 處理儲存雞湯
-                    this.handleSaveQuote(message);
-                    break;
-                case 'page_change':
-                    // 舊版頁面切換（保留向下相容）
-                    this.handlePageChange(message);
-                    break;
-                case 'nfc_read':
-                    this.handleNFCRead(message.data);
-                    break;
-                case 'nfc_removed':
-                    // 不再處理 NFC 移除事件，改用切換邏輯
-                    log('收到 NFC 移除訊息（已忽略）', 'info');
-                    break;
-                case 'nfc_write_success':
-                    this.handleNFCWriteSuccess(message.data);
-                    break;
-                case 'nfc_write_error':
-                    this.handleNFCWriteError(message.data);
-                    break;
-                case 'nfc_emulate_ready':
-                    // 韌體已切成模擬模式，等待觀眾感應
-                    if (typeof window.onNFCEmulateReady === 'function') window.onNFCEmulateReady();
-                    break;
-                case 'nfc_emulate_read':
-                    // 觀眾手機讀到了 → 通知前端收尾
-                    if (typeof window.onNFCEmulateRead === 'function') window.onNFCEmulateRead();
-                    break;
-                case 'nfc_emulate_timeout':
-                    // 模擬模式超時，回到 reader 模式
-                    if (typeof window.onNFCEmulateTimeout === 'function') window.onNFCEmulateTimeout();
-                    break;
-                case 'heartbeat':
-                    // 心跳回應
-                    break;
-                default:
-                    log(`未知的訊息類型: ${message.type}`, 'warn');
-            }
+            // replay 補送跟即時送的可能重疊：收過的 seq 直接丟掉
+            if (message.seq !== undefined && !this.trackSeq(message.seq)) return;
+            // firmware 把同一個 loop 產生的事件合成一個 frame，拆開照順序處理
+            const events = message.type === 'events' ? message.events || [] : [message];
+            events.forEach(event => this.dispatchMessage(event));
         } catch (error) {
             log(`解析訊息失敗: ${error}`, 'error');
         }
     }
 
+    // seq 每個 frame +1（重開機也接著編）：跳號 = 中間有 frame 沒收到（沒訂 write 的話燒錄結果也會佔號）
+    // 回傳 false = 收過了（replay 重疊的部分），不要再處理一次
+    trackSeq(seq) {
+        if (this.lastSeq && seq <= this.lastSeq) return false;
+        if (this.lastSeq && seq > this.lastSeq + 1) {
+            log(`事件 seq 跳號：${this.lastSeq} → ${seq}（漏了 ${seq - this.lastSeq - 1} 個 frame）`, 'warn');
+        }
+        this.lastSeq = seq;
+        return true;
+    }
+
+    // {"type":"replay","after":42} → firmware 把 42 之後的 frame 照原樣重送，最後回 replay_done
+    requestReplay(after) {
+        if (!this.isConnected || !this.ws) return;
+        this.ws.send(JSON.stringify({ type: 'replay', after }));
+        log(`要求 replay（seq ${after} 之後）`, 'sent');
+    }
+
+    // replay_done：more = 一次補不完，接著要；reset = firmware 的 journal 被清過，seq 從它那邊重新算
+    handleReplayDone(message) {
+        if (message.reset) {
+            log(`firmware journal 比較舊（最新 seq ${message.last}），seq 重新起算`, 'warn');
+            this.lastSeq = message.last;
+            return;
+        }
+        if (message.lost > 0) log(`replay：${message.lost} 個 frame 太舊，journal 已經沒有了`, 'warn');
+        if (message.more) this.requestReplay(Math.max(this.lastSeq, message.last));
+    }
+
+    // 單一事件分派（JSON / 二進位 decode 後形狀一樣）
+    dispatchMessage(message) {
+        switch (message.type) {
+            case 'connected':
+                this.binary = !!message.binary;
+                this.ledTimeline = this.binary ? message.version >= 3 : !!message.timeline;
+                this.firmwareHold = this.binary ? message.version >= 4 : !!message.hold;
+                log(`ESP8266 連線確認（${this.binary ? '二進位' : 'JSON'} 協定）`, 'info');
+                // hold 的燈條動畫先傳上去，之後 hold 只送 play / stop（main.js 的 HOLD_LED_TIMELINE）
+                if (this.ledTimeline && window.HOLD_LED_TIMELINE) this.uploadLedTimeline(window.HOLD_LED_TIMELINE);
+                // 重連（或 ESP 重開機）時正在等掃描 → 重新告訴 firmware 要等哪一瓶
+                if (typeof window.onNfcConnected === 'function') window.onNfcConnected();
+                break;
+            case 'hold_progress':
+                // firmware 計時中的進度（最多每 250ms 一次）；holding false = 拿走超過 grace、暫停
+                if (typeof window.onHoldProgress === 'function') window.onHoldProgress(message);
+                break;
+            case 'hold_complete':
+                // 對的瓶子累積滿 5 秒 → 揭曉
+                if (typeof window.onHoldComplete === 'function') window.onHoldComplete(message.uid);
+                break;
+            case 'nfc_hold_start':
+                // 觸發卡剛被放上去 → 通知熬製頁開始 5 秒 hold 計時
+                if (typeof window.onNfcHoldStart === 'function') window.onNfcHoldStart(message.uid);
+                break;
+            case 'nfc_hold_end':
+                // 觸發卡離開 → 暫停 hold 計時（保留目前進度）；兩張同時在場時 uid 說明是哪一張走了
+                if (typeof window.onNfcHoldEnd === 'function') window.onNfcHoldEnd(message.uid);
+                break;
+            case 'random_quote':
+                // 萬用卡：隨機抽雞湯 / soup / panel 階段當任意瓶子
+                this.handleRandomQuote(message);
+                break;
+            case 'ai_reveal':
+                // AI 解鎖卡：只在 chat-result-view 揭曉 AI 原句
+                this.handleAIReveal();
+                break;
+            case 'category_selected':
+                // 處理分類選擇（保留向下相容）
+                this.handleCategorySelected(message);
+                break;
+            case 'show_context':
+                // 處理顯示脈絡（舊版，保留相容性）
+                this.handleShowContext(message);
+                break;
+            case 'toggle_context':
+                // 處理切換脈絡顯示
+                this.handleToggleContext(message);
+                break;
+            case 'save_quote':
+                // 處理儲存雞湯
+                this.handleSaveQuote(message);
+                break;
+            case 'page_change':
+                // 舊版頁面切換（保留向下相容）
+                this.handlePageChange(message);
+                break;
+            case 'nfc_read':
+                this.handleNFCRead(message.data);
+                break;
+            case 'nfc_removed':
+                // 不再處理 NFC 移除事件，改用切換邏輯
+                log('收到 NFC 移除訊息（已忽略）', 'info');
+                break;
+            case 'nfc_write_success':
+                this.handleNFCWriteSuccess(message.data);
+                break;
+            case 'nfc_write_error':
+                this.handleNFCWriteError(message.data);
+                break;
+            case 'nfc_emulate_ready':
+                // 韌體已切成模擬模式，等待觀眾感應
+                if (typeof window.onNFCEmulateReady === 'function') window.onNFCEmulateReady();
+                break;
+            case 'nfc_emulate_read':
+                // 觀眾手機讀到了 → 通知前端收尾
+                if (typeof window.onNFCEmulateRead === 'function') window.onNFCEmulateRead();
+                break;
+            case 'nfc_emulate_timeout':
+                // 模擬模式超時，回到 reader 模式
+                if (typeof window.onNFCEmulateTimeout === 'function') window.onNFCEmulateTimeout();
+                break;
+            case 'replay_done':
+                this.handleReplayDone(message);
+                break;
+
+            case 'heartbeat':
+                // 心跳回應
+                break;
+            default:
+                log(`未知的訊息類型: ${message.type}`, 'warn');
+        }
+    }
+
     // 處理萬用卡（抽籤 + soup/panel 階段當任意瓶子）
     async handleRandomQuote(message = {}) {
         log('收到萬用卡掃描指令', 'info');
@@ -312,9 +521,16 @@ class NFCManager {
         log(`掃描到 NFC UID: "${uid}"`, 'info');
 
         try {
-            const response = await fetch(CONFIG.dataFiles.quotes);
-            const quotes = await response.json();
-            const matchedQuote = quotes.find(q => q.nfcUID === uid);
+            // 新版韌體會直接帶 quoteNumber（UID 對照表編在 firmware 裡），不用再 fetch JSON 查
+            // 舊韌體 / 未登錄的卡才 fallback 用 UID 去 quotes-selected.json 找
+            let matchedQuote = null;
+            if (Number.isInteger(message.quoteNumber) && message.quoteNumber > 0) {
+                matchedQuote = { number: message.quoteNumber, nfcUID: uid };
+            } else {
+                const response = await fetch(CONFIG.dataFiles.quotes);
+                const quotes = await response.json();
+                matchedQuote = quotes.find(q => q.nfcUID === uid);
+            }
 
             if (!matchedQuote) {
                 log(`找不到匹配的雞湯，UID: ${uid}`, 'warn');
@@ -397,11 +613,17 @@ class NFCManager {
         }
 
         try {
-            const message = JSON.stringify({
-                type: 'update_current_quote',
-                quoteNumber: quoteNumber
-            });
-            this.ws.send(message);
+            if (this.binary) {
+                const frame = new DataView(new ArrayBuffer(3));
+                frame.setUint8(0, WS_BIN.CURRENT_QUOTE);
+                frame.setInt16(1, quoteNumber, true);
+                this.ws.send(frame.buffer);
+            } else {
+                this.ws.send(JSON.stringify({
+                    type: 'update_current_quote',
+                    quoteNumber: quoteNumber
+                }));
+            }
             log(`已發送當前雞湯編號給 ESP8266: ${quoteNumber}`, 'sent');
             return true;
         } catch (error) {
@@ -703,6 +925,93 @@ class NFCManager {
         });
     }
 
+    // 燈條模式 / hold 進度（main.js 的 sendLedMode / sendLedProgress 會呼叫）
+    // 二進位：LED_MODE 2 bytes、LED_PROGRESS 3 bytes（float16）；否則照舊 JSON
+    sendLedMode(mode) {
+        if (!this.isConnected || !this.ws) return false;
+        const index = WS_BIN_LED_MODES.indexOf(mode);
+        if (this.binary && index >= 0) {
+            this.ws.send(new Uint8Array([WS_BIN.LED_MODE, index]).buffer);
+        } else {
+            this.ws.send(JSON.stringify({ type: 'led_mode', mode }));
+        }
+        return true;
+    }
+
+    sendLedProgress(value) {
+        if (!this.isConnected || !this.ws) return false;
+        if (this.binary) {
+            const half = floatToHalf(value);
+            this.ws.send(new Uint8Array([WS_BIN.LED_PROGRESS, half & 0xff, half >> 8]).buffer);
+        } else {
+            this.ws.send(JSON.stringify({ type: 'led_progress', value }));
+        }
+        return true;
+    }
+
+    // timeline：{ keys: [{ color: [r,g,b], amp, fill, ease, ms }, ...], loop: [from, to] }（loop 省略 = 不循環）
+    uploadLedTimeline(timeline) {
+        if (!this.isConnected || !this.ws || !this.ledTimeline) return false;
+        const keys = encodeLedKeyframes(timeline.keys);
+        const loop = timeline.loop || [LED_NO_LOOP, LED_NO_LOOP];
+        if (this.binary) {
+            const frame = new Uint8Array(3 + keys.length);
+            frame.set([WS_BIN.LED_TIMELINE, loop[0], loop[1]]);
+            frame.set(keys, 3);
+            this.ws.send(frame.buffer);
+        } else {
+            const hex = Array.from(keys, b => b.toString(16).padStart(2, '0')).join('');
+            const message = { type: 'led_timeline', keys: hex };
+            if (timeline.loop) Object.assign(message, { loop_from: loop[0], loop_to: loop[1] });
+            this.ws.send(JSON.stringify(message));
+        }
+        return true;
+    }
+
+    // 從 offsetMs 開始播已上傳的 timeline（hold 中斷後接著播）
+    sendLedPlay(offsetMs = 0) {
+        if (!this.isConnected || !this.ws || !this.ledTimeline) return false;
+        const offset = Math.max(0, Math.round(offsetMs));
+        if (this.binary) {
+            const frame = new Uint8Array(5);
+            frame[0] = WS_BIN.LED_PLAY;
+            new DataView(frame.buffer).setUint32(1, offset, true);
+            this.ws.send(frame.buffer);
+        } else {
+            this.ws.send(JSON.stringify({ type: 'led_play', offset }));
+        }
+        return true;
+    }
+
+    sendLedStop() {
+        if (!this.isConnected || !this.ws || !this.ledTimeline) return false;
+        if (this.binary) {
+            this.ws.send(new Uint8Array([WS_BIN.LED_STOP]).buffer);
+        } else {
+            this.ws.send(JSON.stringify({ type: 'led_stop' }));
+        }
+        return true;
+    }
+
+    // 告訴 firmware 要等哪一瓶：quoteNumber 0 = 任何卡、-1 = 不等了；ms 0 = firmware 預設（HOLD_REQUIRED_MS）
+    sendHoldTarget(quoteNumber, ms = 0) {
+        if (!this.isConnected || !this.ws || !this.firmwareHold) return false;
+        const required = Math.max(0, Math.min(0xffff, Math.round(ms)));
+        if (this.binary) {
+            const frame = new Uint8Array(5);
+            const view = new DataView(frame.buffer);
+            frame[0] = WS_BIN.HOLD_TARGET;
+            view.setInt16(1, quoteNumber, true);
+            view.setUint16(3, required, true);
+            this.ws.send(frame.buffer);
+        } else {
+            const message = { type: 'hold_target', quoteNumber };
+            if (required) message.ms = required;
+            this.ws.send(JSON.stringify(message));
+        }
+        return true;
+    }
+
     // 發送訊息
     send(type, data = {}) {
         if (!this.isConnected || !this.ws) {
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""
+把每一句雞湯的網址（main.cpp 的 QUOTE_BASE_URL + 編號）預先組成 NTAG 的 NDEF TLV image 編進 firmware
+產生 src/generated/quote_ndef_images.h：依編號排好的 PROGMEM 陣列，
+燒錄時 firmware 直接把 image 一頁一頁寫進卡（見 src/ntag_writer.h / src/quote_ndef_image.cpp）
+
+image 格式跟 ndef::encodeType2Image()（src/ndef_encoder.cpp）的單筆 URI record 一樣：
+  03 LEN  D1 01 LEN 'U' 前綴碼 URI...  FE  補 00 到 4 的倍數
+
+兩種用法：
+  1. PlatformIO 自動跑（platformio.ini 的 extra_scripts = pre:scripts/gen_quote_ndef_images.py）
+  2. 手動：python scripts/gen_quote_ndef_images.py [quotes.json] [輸出.h]
+
+編號來源是 data/quotes.json（全部 200 句，前端 writeURLToNFC 用的 currentQuoteNumber 可能是任何一句）。
+內容沒變就不覆寫，免得每次 build 都整個重編。
+"""
+
+import json
+import os
+import re
+import sys
+
+DEFAULT_INPUT = os.path.join("data", "quotes.json")
+DEFAULT_OUTPUT = os.path.join("src", "generated", "quote_ndef_images.h")
+MAIN_CPP = os.path.join("src", "main.cpp")
+
+# NFC Forum URI RTD 前綴碼：code = index + 1，取最長符合的（跟 ndef_encoder.cpp 的 URI_PREFIXES 同一張表）
+URI_PREFIXES = [
+    "http://www.", "https://www.", "http://", "https://", "tel:", "mailto:", "ftp://anonymous:anonymous@",
+    "ftp://ftp.", "ftps://", "sftp://", "smb://", "nfs://", "ftp://", "dav://", "news:", "telnet://", "imap:",
+    "rtsp://", "urn:", "pop:", "sip:", "sips:", "tftp:", "btspp://", "btl2cap://", "btgoep://", "tcpobex://",
+    "irdaobex://", "file://", "urn:epc:id:", "urn:epc:tag:", "urn:epc:pat:", "urn:epc:raw:", "urn:epc:", "urn:nfc:",
+]
+
+MAX_IMAGE = 128   # NtagWriter::kMaxImage
+
+
+def read_base_url(project_dir):
+    with open(os.path.join(project_dir, MAIN_CPP), encoding="utf-8") as f:
+        m = re.search(r'QUOTE_BASE_URL\s*=\s*"([^"]+)"', f.read())
+    if not m:
+        raise ValueError(f"{MAIN_CPP} 裡找不到 QUOTE_BASE_URL")
+    return m.group(1)
+
+
+def encode_uri(url):
+    code, matched = 0x00, 0
+    for i, prefix in enumerate(URI_PREFIXES):
+        if len(prefix) > matched and url.startswith(prefix):
+            code, matched = i + 1, len(prefix)
+    uri = url[matched:].encode("utf-8")
+    record = bytes([0xD1, 0x01, 1 + len(uri), ord("U"), code]) + uri
+    if len(record) >= 0xFF:
+        raise ValueError(f"URL 太長：{url}")
+    image = bytes([0x03, len(record)]) + record + bytes([0xFE])
+    image += bytes(-len(image) % 4)
+    if len(image) > MAX_IMAGE:
+        raise ValueError(f"NDEF image {len(image)} bytes，超過 {MAX_IMAGE}：{url}")
+    return image
+
+
+def load_numbers(path):
+    with open(path, encoding="utf-8") as f:
+        quotes = json.load(f)
+    numbers = sorted({int(q["number"]) for q in quotes})
+    if not numbers or numbers[0] < 1 or numbers[-1] > 255:
+        raise ValueError("雞湯編號必須在 1..255")
+    return numbers
+
+
+def render(numbers, base_url, source):
+    first, last = numbers[0], numbers[-1]
+    present = set(numbers)
+    images = {n: encode_uri(f"{base_url}{n}") for n in numbers}
+    stride = max(len(i) for i in images.values())
+
+    lines = [
+        "// ⚠ 自動產生，請勿手改 — 來源 " + source.replace(os.sep, "/") + " + src/main.cpp 的 QUOTE_BASE_URL",
+        "//   重新產生：python scripts/gen_quote_ndef_images.py（PlatformIO build 時也會自動跑）",
+        "#pragma once",
+        "",
+        '#include "../quote_ndef_image.h"',
+        "",
+        f'#define QUOTE_NDEF_BASE_URL "{base_url}"',
+        f"#define QUOTE_NDEF_FIRST {first}",
+        f"#define QUOTE_NDEF_COUNT {last - first + 1}",
+        f"#define QUOTE_NDEF_STRIDE {stride}",
+        "",
+        "// QUOTE_NDEF_LENGTHS[n - QUOTE_NDEF_FIRST] = 編號 n 的 image 長度（4 的倍數，0 = 沒有這個編號）",
+        "constexpr uint8_t QUOTE_NDEF_LENGTHS[QUOTE_NDEF_COUNT] PROGMEM = {",
+    ]
+    row = []
+    for n in range(first, last + 1):
+        row.append(str(len(images[n]) if n in present else 0))
+        if len(row) == 20:
+            lines.append("  " + ", ".join(row) + ",")
+            row = []
+    if row:
+        lines.append("  " + ", ".join(row) + ",")
+    lines += [
+        "};",
+        "",
+        "constexpr uint8_t QUOTE_NDEF_IMAGES[QUOTE_NDEF_COUNT][QUOTE_NDEF_STRIDE] PROGMEM = {",
+    ]
+    for n in range(first, last + 1):
+        image = images.get(n, b"")
+        body = ", ".join(f"0x{b:02X}" for b in image)
+        lines.append(f"  {{{body}}},  // #{n}")
+    lines += ["};", ""]
+    return "\n".join(lines)
+
+
+def generate(project_dir, input_rel=DEFAULT_INPUT, output_rel=DEFAULT_OUTPUT):
+    src = os.path.join(project_dir, input_rel)
+    out = os.path.join(project_dir, output_rel)
+    text = render(load_numbers(src), read_base_url(project_dir), input_rel)
+
+    if os.path.exists(out):
+        with open(out, encoding="utf-8") as f:
+            if f.read() == text:
+                return out, False
+    os.makedirs(os.path.dirname(out), exist_ok=True)
+    with open(out, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+    return out, True
+
+
+try:
+    Import("env")  # noqa: F821 — PlatformIO / SCons 注入
+    _out, _changed = generate(env["PROJECT_DIR"])  # noqa: F821
+    if _changed:
+        print(f"gen_quote_ndef_images: 已更新 {_out}")
+except NameError:
+    if __name__ == "__main__":
+        root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+        args = sys.argv[1:]
+        out, changed = generate(root, *args[:2])
+        print(("已更新 " if changed else "沒有變更 ") + out)
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""
+把 data/quotes-selected.json 的 nfcUID → number 對照表編進 firmware
+產生 src/generated/quote_uid_table.h：依 7-byte UID 排序的 PROGMEM 陣列，
+firmware 用二分搜尋直接拿 uid[] 查雞湯編號（見 src/quote_uid_index.cpp）
+
+兩種用法：
+  1. PlatformIO 自動跑（platformio.ini 的 extra_scripts = pre:scripts/gen_quote_uid_table.py）
+  2. 手動：python scripts/gen_quote_uid_table.py [quotes.json] [輸出.h]
+
+前端用的是 CONFIG.dataFiles.quotes（= quotes-selected.json），所以這裡預設也讀它，
+兩邊對照表才會一致。內容沒變就不覆寫，免得每次 build 都整個重編。
+"""
+
+import json
+import os
+import sys
+
+DEFAULT_INPUT = os.path.join("data", "quotes-selected.json")
+DEFAULT_OUTPUT = os.path.join("src", "generated", "quote_uid_table.h")
+
+
+def parse_uid(text):
+    parts = text.split(":")
+    if len(parts) != 7:
+        raise ValueError(f"UID 不是 7 bytes：{text}")
+    return bytes(int(p, 16) for p in parts)
+
+
+def load_entries(path):
+    with open(path, encoding="utf-8") as f:
+        quotes = json.load(f)
+
+    entries = {}
+    for q in quotes:
+        uid_text = (q.get("nfcUID") or "").strip()
+        if not uid_text:
+            continue
+        number = int(q["number"])
+        if not 0 < number < 256:
+            raise ValueError(f"雞湯編號超出 uint8_t：#{number}")
+        uid = parse_uid(uid_text)
+        if uid in entries and entries[uid] != number:
+            raise ValueError(f"UID {uid_text} 同時對到 #{entries[uid]} 跟 #{number}")
+        entries[uid] = number
+    return sorted(entries.items())
+
+
+def render(entries, source):
+    lines = [
+        "// ⚠ 自動產生，請勿手改 — 來源 " + source.replace(os.sep, "/"),
+        "//   重新產生：python scripts/gen_quote_uid_table.py（PlatformIO build 時也會自動跑）",
+        "#pragma once",
+        "",
+        '#include "../quote_uid_index.h"',
+        "",
+        f"#define QUOTE_UID_COUNT {len(entries)}",
+        "",
+        "// 依 uid 排序（memcmp 順序），quote_uid_index.cpp 用二分搜尋",
+        "constexpr QuoteUidEntry QUOTE_UID_TABLE[QUOTE_UID_COUNT] PROGMEM = {",
+    ]
+    for uid, number in entries:
+        body = ", ".join(f"0x{b:02X}" for b in uid)
+        lines.append(f"  {{{{{body}}}, {number}}},")
+    lines += [
+        "};",
+        "",
+        "constexpr bool quoteUidTableSorted() {",
+        "  for (int i = 1; i < QUOTE_UID_COUNT; i++) {",
+        "    int c = 0;",
+        "    for (int k = 0; k < 7 && c == 0; k++) {",
+        "      c = (int)QUOTE_UID_TABLE[i - 1].uid[k] - (int)QUOTE_UID_TABLE[i].uid[k];",
+        "    }",
+        "    if (c >= 0) return false;",
+        "  }",
+        "  return true;",
+        "}",
+        'static_assert(quoteUidTableSorted(), "QUOTE_UID_TABLE 必須依 UID 嚴格遞增");',
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def generate(project_dir, input_rel=DEFAULT_INPUT, output_rel=DEFAULT_OUTPUT):
+    src = os.path.join(project_dir, input_rel)
+    out = os.path.join(project_dir, output_rel)
+    text = render(load_entries(src), input_rel)
+
+    if os.path.exists(out):
+        with open(out, encoding="utf-8") as f:
+            if f.read() == text:
+                return out, False
+    os.makedirs(os.path.dirname(out), exist_ok=True)
+    with open(out, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+    return out, True
+
+
+try:
+    Import("env")  # noqa: F821 — PlatformIO / SCons 注入
+    _out, _changed = generate(env["PROJECT_DIR"])  # noqa: F821
+    if _changed:
+        print(f"gen_quote_uid_table: 已更新 {_out}")
+except NameError:
+    if __name__ == "__main__":
+        root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+        args = sys.argv[1:]
+        out, changed = generate(root, *args[:2])
+        print(("已更新 " if changed else "沒有變更 ") + out)
@@ -0,0 +1,11 @@
+#!/usr/bin/env python3
+"""
+env:native_asan 用：build_flags 裡的 -fsanitize=... 也要帶到 link，不然會缺 __asan_* / __ubsan_* 符號
+
+  platformio.ini 的 extra_scripts = post:scripts/native_sanitize_link.py
+"""
+
+Import("env")  # noqa: F821 — PlatformIO / SCons 注入
+
+_flags = [f for f in env.get("CCFLAGS", []) if isinstance(f, str) and f.startswith("-fsanitize")]  # noqa: F821
+env.Append(LINKFLAGS=[f for f in _flags if f not in env.get("LINKFLAGS", [])])  # noqa: F821
@@ -4,7 +4,12 @@ NFC 批次燒錄工具
 透過 USB Serial 連接 ESP8266 + PN532，自動將一批 URL 依序燒錄進空白 NFC 卡片。
 
 使用方法：
-  python nfc_batch_write.py urls.txt COM3
+  python nfc_batch_write.py urls.txt COM3            # 批次佇列：一直換卡就好
+  python nfc_batch_write.py urls.txt COM3 --single   # 舊流程：一張一張 WRITE:，每張按 Enter
+
+批次佇列模式先用 QUEUE: 把 firmware 的佇列塞滿（最多 16 個），START 之後每放上一張新卡，
+firmware 就直接寫隊首的 URL、讀回驗證，逐張回 RESULT:；每完成一個就再補一個 QUEUE:。
+失敗的 URL 會在下一張卡自動重試，同一個 URL 失敗 3 次才放棄。
 
 urls.txt 格式（每行一個 URL，# 開頭為註解）：
   https://example.com/quotes/quote1
@@ -68,14 +73,7 @@ def wait_response(ser, timeout=30):
     return None
 
 
-def run(urls_file, port, baud=115200):
-    urls = load_urls(urls_file)
-    total = len(urls)
-    if total == 0:
-        print("URL 清單是空的，結束。")
-        return
-
-    print(f"\n共 {total} 個 URL，連接 {port}...")
+def open_port(port, baud):
     try:
         ser = serial.Serial(port, baud, timeout=1)
     except serial.SerialException as e:
@@ -86,6 +84,125 @@ def run(urls_file, port, baud=115200):
     time.sleep(2)   # 等 ESP reset 穩定
     ser.reset_input_buffer()
     print("連線成功！\n")
+    return ser
+
+
+def read_line(ser, backlog=None):
+    if backlog:
+        return backlog.pop(0)
+    raw = ser.readline()
+    if not raw:
+        return None
+    line = raw.decode("utf-8", errors="replace").strip()
+    return line or None
+
+
+def queue_url(ser, url, pending, backlog):
+    """送一個 QUEUE:，等 QUEUED:<id>:<剩幾格>，把 id 對回 URL。
+    回傳 "ok" / "full"（佇列滿，等一下再補）/ "bad"（URL 空的或太長，跳過）/ None（沒回應）。
+    等待中收到的 RESULT: 之類的其他行放進 backlog，主迴圈之後再處理。"""
+    ser.write(f"QUEUE:{url}\n".encode("utf-8"))
+    deadline = time.time() + 5
+    while time.time() < deadline:
+        line = read_line(ser)
+        if not line:
+            continue
+        if line.startswith("QUEUED:"):
+            job_id = int(line.split(":")[1])
+            pending[job_id] = url
+            return "ok"
+        if line == "ERR:queue_full":
+            return "full"
+        if line.startswith("ERR:"):
+            print(f"  ✗ 無法加入佇列（{line[4:]}）：{url}")
+            return "bad"
+        backlog.append(line)
+    print(f"  超時：QUEUE 沒有回應（{url}）")
+    return None
+
+
+def fill_queue(ser, urls, next_url, pending, skipped, backlog):
+    """從 urls[next_url] 開始一直 QUEUE: 到佇列滿，回傳下一個還沒送的 index。"""
+    while next_url < len(urls):
+        result = queue_url(ser, urls[next_url], pending, backlog)
+        if result == "bad":
+            skipped.append(urls[next_url])
+        elif result != "ok":
+            break
+        next_url += 1
+    return next_url
+
+
+def run_batch(urls, port, baud=115200):
+    total = len(urls)
+    ser = open_port(port, baud)
+    ser.write(b"CANCEL\n")   # 清掉上一輪沒跑完的佇列
+    time.sleep(0.2)
+    ser.reset_input_buffer()
+
+    pending = {}     # firmware job id → URL
+    skipped = []
+    backlog = []
+    next_url = fill_queue(ser, urls, 0, pending, skipped, backlog)
+
+    ser.write(b"START\n")
+    print(f"已預載 {len(pending)} 個 URL，開始燒錄：一直換卡就好（Ctrl+C 中止）\n")
+
+    written = []
+    failed = []
+    stats = ""
+    try:
+        while pending:
+            line = read_line(ser, backlog)
+            if not line:
+                continue
+            if line.startswith("BATCH_STATS:"):
+                # 每張卡之後 firmware 都會回一行：written=..,failed=..,gave_up=..,queued=..,tags_per_min=..
+                stats = line[len("BATCH_STATS:"):]
+                print(f"          {stats}")
+                continue
+            if not line.startswith("RESULT:"):
+                continue
+            parts = line.split(":")
+            job_id, status = int(parts[1]), parts[2]
+            url = pending.get(job_id, "?")
+            done = len(written) + len(failed)
+            if status == "OK":
+                uid = ":".join(parts[3:-1])
+                written.append((url, uid))
+                print(f"[{done + 1}/{total}] ✓ {url}  UID {uid}  ({parts[-1]} ms)")
+            elif status == "FAIL":
+                print(f"          ✗ {url}  {parts[3]}（第 {parts[-1]} 次），換一張卡重試")
+                continue
+            elif status == "GIVEUP":
+                failed.append(url)
+                print(f"[{done + 1}/{total}] ✗ 放棄 {url}（{parts[3]}）")
+            pending.pop(job_id, None)
+            # 寫完一個補一個，佇列一直是滿的
+            next_url = fill_queue(ser, urls, next_url, pending, skipped, backlog)
+        # 最後一張的 BATCH_STATS 跟在 RESULT 後面
+        deadline = time.time() + 2
+        while time.time() < deadline:
+            line = read_line(ser, backlog)
+            if line and line.startswith("BATCH_STATS:"):
+                stats = line[len("BATCH_STATS:"):]
+                break
+    except KeyboardInterrupt:
+        print("\n中止，清空 firmware 佇列...")
+    ser.write(b"CANCEL\n")
+
+    print(f"\n═══════════════════════════════════════════")
+    print(f"完成！共燒錄 {len(written)} / {total} 張。")
+    if stats:
+        print(f"  {stats}")
+    for url in failed + skipped:
+        print(f"  未燒錄：{url}")
+    ser.close()
+
+
+def run_single(urls, port, baud=115200):
+    total = len(urls)
+    ser = open_port(port, baud)
 
     i = 0
     while i < total:
@@ -131,6 +248,20 @@ def run(urls_file, port, baud=115200):
     ser.close()
 
 
+def run(urls_file, port, single=False):
+    urls = load_urls(urls_file)
+    total = len(urls)
+    if total == 0:
+        print("URL 清單是空的，結束。")
+        return
+
+    print(f"\n共 {total} 個 URL，連接 {port}...")
+    if single:
+        run_single(urls, port)
+    else:
+        run_batch(urls, port)
+
+
 if __name__ == "__main__":
     if len(sys.argv) < 2:
         print(__doc__)
@@ -143,8 +274,8 @@ if __name__ == "__main__":
         sys.exit(0)
 
     if len(sys.argv) < 3:
-        print("用法：python nfc_batch_write.py <urls.txt> <COM port>")
+        print("用法：python nfc_batch_write.py <urls.txt> <COM port> [--single]")
         print("      python nfc_batch_write.py --list-ports")
         sys.exit(1)
 
-    run(sys.argv[1], sys.argv[2])
+    run(sys.argv[1], sys.argv[2], single="--single" in sys.argv[3:])
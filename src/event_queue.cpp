@@ -0,0 +1,63 @@
+#include "event_queue.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ws_binary.h"
+
+bool EventQueue::push(const char* json, size_t jsonLength, const uint8_t* bin, size_t binLength, unsigned long nowMs) {
+  if (jsonLength < 2 || json[0] != '{' || json[jsonLength - 1] != '}') return false;
+  if (binLength == 0 || binLength > 255) return false;
+  size_t sep = count_ ? 1 : 0;
+  if (jsonLength_ + sep + jsonLength > kJsonCapacity) return false;
+  if (binLength_ + 1 + binLength > kBinaryCapacity) return false;
+
+  if (count_ == 0) firstMs_ = nowMs;
+  if (sep) json_[jsonLength_++] = ',';
+  memcpy(json_ + jsonLength_, json, jsonLength);
+  jsonLength_ += jsonLength;
+  bin_[binLength_++] = (uint8_t)binLength;
+  memcpy(bin_ + binLength_, bin, binLength);
+  binLength_ += binLength;
+  count_++;
+  return true;
+}
+
+size_t EventQueue::buildJson(char* out, size_t capacity) const {
+  if (count_ == 0 || capacity < jsonLength_ + kJsonOverhead) return 0;
+  unsigned long seq = (unsigned long)nextSeq();
+  unsigned long t = (unsigned long)firstMs_;
+  int n;
+  if (count_ == 1) {
+    // 去掉事件最後的 '}'，接上 seq / t
+    memcpy(out, json_, jsonLength_ - 1);
+    n = snprintf(out + jsonLength_ - 1, capacity - (jsonLength_ - 1), ",\"seq\":%lu,\"t\":%lu}", seq, t);
+    return n < 0 ? 0 : jsonLength_ - 1 + (size_t)n;
+  }
+  n = snprintf(out, capacity, "{\"type\":\"events\",\"seq\":%lu,\"t\":%lu,\"events\":[", seq, t);
+  if (n < 0) return 0;
+  size_t len = (size_t)n;
+  memcpy(out + len, json_, jsonLength_);
+  len += jsonLength_;
+  out[len++] = ']';
+  out[len++] = '}';
+  out[len] = '\0';
+  return len;
+}
+
+size_t EventQueue::buildBinary(uint8_t* out, size_t capacity) const {
+  if (count_ == 0 || capacity < binLength_ + kBinaryOverhead) return 0;
+  uint32_t seq = nextSeq();
+  uint32_t t = (uint32_t)firstMs_;
+  out[0] = wsbin::OP_EVENTS;
+  wsbin::writeU32(out + 1, seq);
+  wsbin::writeU32(out + 5, t);
+  memcpy(out + kBinaryOverhead, bin_, binLength_);
+  return kBinaryOverhead + binLength_;
+}
+
+void EventQueue::clear() {
+  jsonLength_ = 0;
+  binLength_ = 0;
+  count_ = 0;
+}
@@ -0,0 +1,55 @@
+#pragma once
+// ===== 往顯示端送的事件佇列 =====
+// 一次掃卡會產生好幾個事件（show_context + nfc_hold_start ...），以前每個都是一次 broadcastTXT = 一次 TCP send。
+// 現在 loop() 裡產生的事件先 push 進來，loop() 結束時合成「一個」frame 送出，
+// frame 帶遞增的 seq 跟裝置時間（millis），前端可以看出有沒有漏 / 亂序。
+//
+// JSON：
+//   只有一個事件 → 事件本身多兩個欄位：{"type":"nfc_hold_end","seq":43,"t":123456}
+//   兩個以上     → {"type":"events","seq":42,"t":123400,"events":[{...},{...}]}
+// 二進位（ws_binary.h 的 OP_EVENTS）：
+//   [0x20][seq u32][t u32][len][事件 bytes][len][事件 bytes]...
+// t 是這個 frame 第一個事件發生的時間，不是送出的時間
+
+#include <stddef.h>
+#include <stdint.h>
+
+class EventQueue {
+ public:
+  static const size_t kJsonCapacity = 384;
+  static const size_t kBinaryCapacity = 64;
+  // 組好的 frame 最多比事件內容多這麼多（header + 結尾）
+  static const size_t kJsonOverhead = 64;
+  static const size_t kBinaryOverhead = 9;
+
+  // json 必須是完整的 {...} 物件；塞不下回 false（呼叫端先送出目前的 frame 再 push）
+  bool push(const char* json, size_t jsonLength, const uint8_t* bin, size_t binLength, unsigned long nowMs);
+
+  bool empty() const { return count_ == 0; }
+  uint8_t count() const { return count_; }
+
+  // 下一個 frame 的 seq 從 1 開始；送出後呼叫 commit()（seq 前進 + 清空），clear() 只清空
+  uint32_t nextSeq() const { return seq_ + 1; }
+  // 這個 frame 第一個事件的時間（frame 的 t）
+  unsigned long firstMs() const { return firstMs_; }
+  size_t buildJson(char* out, size_t capacity) const;
+  size_t buildBinary(uint8_t* out, size_t capacity) const;
+  void commit() {
+    seq_++;
+    clear();
+  }
+  void clear();
+  // 不經過佇列、自己組的 frame（燒錄結果）也佔一個 seq：回傳它的 seq 並前進。佇列要是空的
+  uint32_t takeSeq() { return ++seq_; }
+  // 開機時從 journal 最後一個 seq 接著編（見 scan_journal.h），重開機 seq 不會倒回去
+  void resumeAfter(uint32_t seq) { seq_ = seq; }
+
+ private:
+  char json_[kJsonCapacity];
+  size_t jsonLength_ = 0;
+  uint8_t bin_[kBinaryCapacity];
+  size_t binLength_ = 0;
+  uint8_t count_ = 0;
+  uint32_t seq_ = 0;
+  unsigned long firstMs_ = 0;
+};
@@ -0,0 +1,227 @@
+// ⚠ 自動產生，請勿手改 — 來源 data/quotes.json + src/main.cpp 的 QUOTE_BASE_URL
+//   重新產生：python scripts/gen_quote_ndef_images.py（PlatformIO build 時也會自動跑）
+#pragma once
+
+#include "../quote_ndef_image.h"
+
+#define QUOTE_NDEF_BASE_URL "https://thekingofchickensoup.framer.website/quotes/quote"
+#define QUOTE_NDEF_FIRST 1
+#define QUOTE_NDEF_COUNT 200
+#define QUOTE_NDEF_STRIDE 60
+
+// QUOTE_NDEF_LENGTHS[n - QUOTE_NDEF_FIRST] = 編號 n 的 image 長度（4 的倍數，0 = 沒有這個編號）
+constexpr uint8_t QUOTE_NDEF_LENGTHS[QUOTE_NDEF_COUNT] PROGMEM = {
+  60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+  60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+  60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+  60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+  60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+  60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+  60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+  60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+  60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+  60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+};
+
+constexpr uint8_t QUOTE_NDEF_IMAGES[QUOTE_NDEF_COUNT][QUOTE_NDEF_STRIDE] PROGMEM = {
+  {0x03, 0x36, 0xD1, 0x01, 0x32, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0xFE, 0x00, 0x00, 0x00},  // #1
+  {0x03, 0x36, 0xD1, 0x01, 0x32, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x32, 0xFE, 0x00, 0x00, 0x00},  // #2
+  {0x03, 0x36, 0xD1, 0x01, 0x32, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x33, 0xFE, 0x00, 0x00, 0x00},  // #3
+  {0x03, 0x36, 0xD1, 0x01, 0x32, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x34, 0xFE, 0x00, 0x00, 0x00},  // #4
+  {0x03, 0x36, 0xD1, 0x01, 0x32, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x35, 0xFE, 0x00, 0x00, 0x00},  // #5
+  {0x03, 0x36, 0xD1, 0x01, 0x32, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x36, 0xFE, 0x00, 0x00, 0x00},  // #6
+  {0x03, 0x36, 0xD1, 0x01, 0x32, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x37, 0xFE, 0x00, 0x00, 0x00},  // #7
+  {0x03, 0x36, 0xD1, 0x01, 0x32, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x38, 0xFE, 0x00, 0x00, 0x00},  // #8
+  {0x03, 0x36, 0xD1, 0x01, 0x32, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x39, 0xFE, 0x00, 0x00, 0x00},  // #9
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x30, 0xFE, 0x00, 0x00},  // #10
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x31, 0xFE, 0x00, 0x00},  // #11
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x32, 0xFE, 0x00, 0x00},  // #12
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x33, 0xFE, 0x00, 0x00},  // #13
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x34, 0xFE, 0x00, 0x00},  // #14
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x35, 0xFE, 0x00, 0x00},  // #15
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x36, 0xFE, 0x00, 0x00},  // #16
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x37, 0xFE, 0x00, 0x00},  // #17
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x38, 0xFE, 0x00, 0x00},  // #18
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x39, 0xFE, 0x00, 0x00},  // #19
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x32, 0x30, 0xFE, 0x00, 0x00},  // #20
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x32, 0x31, 0xFE, 0x00, 0x00},  // #21
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x32, 0x32, 0xFE, 0x00, 0x00},  // #22
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x32, 0x33, 0xFE, 0x00, 0x00},  // #23
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x32, 0x34, 0xFE, 0x00, 0x00},  // #24
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x32, 0x35, 0xFE, 0x00, 0x00},  // #25
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x32, 0x36, 0xFE, 0x00, 0x00},  // #26
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x32, 0x37, 0xFE, 0x00, 0x00},  // #27
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x32, 0x38, 0xFE, 0x00, 0x00},  // #28
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x32, 0x39, 0xFE, 0x00, 0x00},  // #29
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x33, 0x30, 0xFE, 0x00, 0x00},  // #30
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x33, 0x31, 0xFE, 0x00, 0x00},  // #31
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x33, 0x32, 0xFE, 0x00, 0x00},  // #32
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x33, 0x33, 0xFE, 0x00, 0x00},  // #33
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x33, 0x34, 0xFE, 0x00, 0x00},  // #34
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x33, 0x35, 0xFE, 0x00, 0x00},  // #35
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x33, 0x36, 0xFE, 0x00, 0x00},  // #36
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x33, 0x37, 0xFE, 0x00, 0x00},  // #37
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x33, 0x38, 0xFE, 0x00, 0x00},  // #38
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x33, 0x39, 0xFE, 0x00, 0x00},  // #39
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x34, 0x30, 0xFE, 0x00, 0x00},  // #40
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x34, 0x31, 0xFE, 0x00, 0x00},  // #41
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x34, 0x32, 0xFE, 0x00, 0x00},  // #42
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x34, 0x33, 0xFE, 0x00, 0x00},  // #43
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x34, 0x34, 0xFE, 0x00, 0x00},  // #44
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x34, 0x35, 0xFE, 0x00, 0x00},  // #45
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x34, 0x36, 0xFE, 0x00, 0x00},  // #46
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x34, 0x37, 0xFE, 0x00, 0x00},  // #47
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x34, 0x38, 0xFE, 0x00, 0x00},  // #48
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x34, 0x39, 0xFE, 0x00, 0x00},  // #49
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x35, 0x30, 0xFE, 0x00, 0x00},  // #50
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x35, 0x31, 0xFE, 0x00, 0x00},  // #51
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x35, 0x32, 0xFE, 0x00, 0x00},  // #52
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x35, 0x33, 0xFE, 0x00, 0x00},  // #53
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x35, 0x34, 0xFE, 0x00, 0x00},  // #54
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x35, 0x35, 0xFE, 0x00, 0x00},  // #55
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x35, 0x36, 0xFE, 0x00, 0x00},  // #56
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x35, 0x37, 0xFE, 0x00, 0x00},  // #57
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x35, 0x38, 0xFE, 0x00, 0x00},  // #58
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x35, 0x39, 0xFE, 0x00, 0x00},  // #59
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x36, 0x30, 0xFE, 0x00, 0x00},  // #60
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x36, 0x31, 0xFE, 0x00, 0x00},  // #61
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x36, 0x32, 0xFE, 0x00, 0x00},  // #62
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x36, 0x33, 0xFE, 0x00, 0x00},  // #63
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x36, 0x34, 0xFE, 0x00, 0x00},  // #64
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x36, 0x35, 0xFE, 0x00, 0x00},  // #65
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x36, 0x36, 0xFE, 0x00, 0x00},  // #66
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x36, 0x37, 0xFE, 0x00, 0x00},  // #67
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x36, 0x38, 0xFE, 0x00, 0x00},  // #68
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x36, 0x39, 0xFE, 0x00, 0x00},  // #69
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x37, 0x30, 0xFE, 0x00, 0x00},  // #70
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x37, 0x31, 0xFE, 0x00, 0x00},  // #71
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x37, 0x32, 0xFE, 0x00, 0x00},  // #72
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x37, 0x33, 0xFE, 0x00, 0x00},  // #73
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x37, 0x34, 0xFE, 0x00, 0x00},  // #74
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x37, 0x35, 0xFE, 0x00, 0x00},  // #75
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x37, 0x36, 0xFE, 0x00, 0x00},  // #76
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x37, 0x37, 0xFE, 0x00, 0x00},  // #77
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x37, 0x38, 0xFE, 0x00, 0x00},  // #78
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x37, 0x39, 0xFE, 0x00, 0x00},  // #79
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x38, 0x30, 0xFE, 0x00, 0x00},  // #80
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x38, 0x31, 0xFE, 0x00, 0x00},  // #81
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x38, 0x32, 0xFE, 0x00, 0x00},  // #82
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x38, 0x33, 0xFE, 0x00, 0x00},  // #83
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x38, 0x34, 0xFE, 0x00, 0x00},  // #84
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x38, 0x35, 0xFE, 0x00, 0x00},  // #85
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x38, 0x36, 0xFE, 0x00, 0x00},  // #86
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x38, 0x37, 0xFE, 0x00, 0x00},  // #87
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x38, 0x38, 0xFE, 0x00, 0x00},  // #88
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x38, 0x39, 0xFE, 0x00, 0x00},  // #89
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x39, 0x30, 0xFE, 0x00, 0x00},  // #90
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x39, 0x31, 0xFE, 0x00, 0x00},  // #91
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x39, 0x32, 0xFE, 0x00, 0x00},  // #92
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x39, 0x33, 0xFE, 0x00, 0x00},  // #93
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x39, 0x34, 0xFE, 0x00, 0x00},  // #94
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x39, 0x35, 0xFE, 0x00, 0x00},  // #95
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x39, 0x36, 0xFE, 0x00, 0x00},  // #96
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x39, 0x37, 0xFE, 0x00, 0x00},  // #97
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x39, 0x38, 0xFE, 0x00, 0x00},  // #98
+  {0x03, 0x37, 0xD1, 0x01, 0x33, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x39, 0x39, 0xFE, 0x00, 0x00},  // #99
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x30, 0x30, 0xFE, 0x00},  // #100
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x30, 0x31, 0xFE, 0x00},  // #101
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x30, 0x32, 0xFE, 0x00},  // #102
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x30, 0x33, 0xFE, 0x00},  // #103
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x30, 0x34, 0xFE, 0x00},  // #104
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x30, 0x35, 0xFE, 0x00},  // #105
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x30, 0x36, 0xFE, 0x00},  // #106
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x30, 0x37, 0xFE, 0x00},  // #107
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x30, 0x38, 0xFE, 0x00},  // #108
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x30, 0x39, 0xFE, 0x00},  // #109
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x31, 0x30, 0xFE, 0x00},  // #110
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x31, 0x31, 0xFE, 0x00},  // #111
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x31, 0x32, 0xFE, 0x00},  // #112
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x31, 0x33, 0xFE, 0x00},  // #113
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x31, 0x34, 0xFE, 0x00},  // #114
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x31, 0x35, 0xFE, 0x00},  // #115
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x31, 0x36, 0xFE, 0x00},  // #116
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x31, 0x37, 0xFE, 0x00},  // #117
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x31, 0x38, 0xFE, 0x00},  // #118
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x31, 0x39, 0xFE, 0x00},  // #119
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x32, 0x30, 0xFE, 0x00},  // #120
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x32, 0x31, 0xFE, 0x00},  // #121
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x32, 0x32, 0xFE, 0x00},  // #122
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x32, 0x33, 0xFE, 0x00},  // #123
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x32, 0x34, 0xFE, 0x00},  // #124
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x32, 0x35, 0xFE, 0x00},  // #125
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x32, 0x36, 0xFE, 0x00},  // #126
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x32, 0x37, 0xFE, 0x00},  // #127
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x32, 0x38, 0xFE, 0x00},  // #128
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x32, 0x39, 0xFE, 0x00},  // #129
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x33, 0x30, 0xFE, 0x00},  // #130
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x33, 0x31, 0xFE, 0x00},  // #131
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x33, 0x32, 0xFE, 0x00},  // #132
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x33, 0x33, 0xFE, 0x00},  // #133
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x33, 0x34, 0xFE, 0x00},  // #134
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x33, 0x35, 0xFE, 0x00},  // #135
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x33, 0x36, 0xFE, 0x00},  // #136
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x33, 0x37, 0xFE, 0x00},  // #137
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x33, 0x38, 0xFE, 0x00},  // #138
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x33, 0x39, 0xFE, 0x00},  // #139
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x34, 0x30, 0xFE, 0x00},  // #140
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x34, 0x31, 0xFE, 0x00},  // #141
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x34, 0x32, 0xFE, 0x00},  // #142
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x34, 0x33, 0xFE, 0x00},  // #143
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x34, 0x34, 0xFE, 0x00},  // #144
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x34, 0x35, 0xFE, 0x00},  // #145
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x34, 0x36, 0xFE, 0x00},  // #146
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x34, 0x37, 0xFE, 0x00},  // #147
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x34, 0x38, 0xFE, 0x00},  // #148
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x34, 0x39, 0xFE, 0x00},  // #149
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x35, 0x30, 0xFE, 0x00},  // #150
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x35, 0x31, 0xFE, 0x00},  // #151
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x35, 0x32, 0xFE, 0x00},  // #152
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x35, 0x33, 0xFE, 0x00},  // #153
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x35, 0x34, 0xFE, 0x00},  // #154
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x35, 0x35, 0xFE, 0x00},  // #155
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x35, 0x36, 0xFE, 0x00},  // #156
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x35, 0x37, 0xFE, 0x00},  // #157
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x35, 0x38, 0xFE, 0x00},  // #158
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x35, 0x39, 0xFE, 0x00},  // #159
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x36, 0x30, 0xFE, 0x00},  // #160
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x36, 0x31, 0xFE, 0x00},  // #161
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x36, 0x32, 0xFE, 0x00},  // #162
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x36, 0x33, 0xFE, 0x00},  // #163
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x36, 0x34, 0xFE, 0x00},  // #164
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x36, 0x35, 0xFE, 0x00},  // #165
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x36, 0x36, 0xFE, 0x00},  // #166
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x36, 0x37, 0xFE, 0x00},  // #167
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x36, 0x38, 0xFE, 0x00},  // #168
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x36, 0x39, 0xFE, 0x00},  // #169
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x37, 0x30, 0xFE, 0x00},  // #170
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x37, 0x31, 0xFE, 0x00},  // #171
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x37, 0x32, 0xFE, 0x00},  // #172
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x37, 0x33, 0xFE, 0x00},  // #173
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x37, 0x34, 0xFE, 0x00},  // #174
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x37, 0x35, 0xFE, 0x00},  // #175
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x37, 0x36, 0xFE, 0x00},  // #176
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x37, 0x37, 0xFE, 0x00},  // #177
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x37, 0x38, 0xFE, 0x00},  // #178
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x37, 0x39, 0xFE, 0x00},  // #179
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x38, 0x30, 0xFE, 0x00},  // #180
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x38, 0x31, 0xFE, 0x00},  // #181
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x38, 0x32, 0xFE, 0x00},  // #182
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x38, 0x33, 0xFE, 0x00},  // #183
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x38, 0x34, 0xFE, 0x00},  // #184
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x38, 0x35, 0xFE, 0x00},  // #185
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x38, 0x36, 0xFE, 0x00},  // #186
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x38, 0x37, 0xFE, 0x00},  // #187
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x38, 0x38, 0xFE, 0x00},  // #188
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x38, 0x39, 0xFE, 0x00},  // #189
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x39, 0x30, 0xFE, 0x00},  // #190
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x39, 0x31, 0xFE, 0x00},  // #191
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x39, 0x32, 0xFE, 0x00},  // #192
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x39, 0x33, 0xFE, 0x00},  // #193
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x39, 0x34, 0xFE, 0x00},  // #194
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x39, 0x35, 0xFE, 0x00},  // #195
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x39, 0x36, 0xFE, 0x00},  // #196
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x39, 0x37, 0xFE, 0x00},  // #197
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x39, 0x38, 0xFE, 0x00},  // #198
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x31, 0x39, 0x39, 0xFE, 0x00},  // #199
+  {0x03, 0x38, 0xD1, 0x01, 0x34, 0x55, 0x04, 0x74, 0x68, 0x65, 0x6B, 0x69, 0x6E, 0x67, 0x6F, 0x66, 0x63, 0x68, 0x69, 0x63, 0x6B, 0x65, 0x6E, 0x73, 0x6F, 0x75, 0x70, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x72, 0x2E, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x32, 0x30, 0x30, 0xFE, 0x00},  // #200
+};
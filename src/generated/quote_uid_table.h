@@ -0,0 +1,123 @@
+// ⚠ 自動產生，請勿手改 — 來源 data/quotes-selected.json
+//   重新產生：python scripts/gen_quote_uid_table.py（PlatformIO build 時也會自動跑）
+#pragma once
+
+#include "../quote_uid_index.h"
+
+#define QUOTE_UID_COUNT 100
+
+// 依 uid 排序（memcmp 順序），quote_uid_index.cpp 用二分搜尋
+constexpr QuoteUidEntry QUOTE_UID_TABLE[QUOTE_UID_COUNT] PROGMEM = {
+  {{0x04, 0x12, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 164},
+  {{0x04, 0x14, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 163},
+  {{0x04, 0x15, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 162},
+  {{0x04, 0x1A, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 158},
+  {{0x04, 0x1B, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 156},
+  {{0x04, 0x1C, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 153},
+  {{0x04, 0x1D, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 152},
+  {{0x04, 0x23, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 151},
+  {{0x04, 0x24, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 150},
+  {{0x04, 0x25, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 142},
+  {{0x04, 0x2B, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 133},
+  {{0x04, 0x2C, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 132},
+  {{0x04, 0x2D, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 130},
+  {{0x04, 0x2E, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 128},
+  {{0x04, 0x34, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 126},
+  {{0x04, 0x35, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 125},
+  {{0x04, 0x36, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 123},
+  {{0x04, 0x37, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 122},
+  {{0x04, 0x3C, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 115},
+  {{0x04, 0x3D, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 112},
+  {{0x04, 0x3E, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 109},
+  {{0x04, 0x3F, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 104},
+  {{0x04, 0x45, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 103},
+  {{0x04, 0x46, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 100},
+  {{0x04, 0x47, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 95},
+  {{0x04, 0x48, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 94},
+  {{0x04, 0x4D, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 93},
+  {{0x04, 0x4E, 0x6F, 0x97, 0xCC, 0x2A, 0x81}, 91},
+  {{0x04, 0x56, 0x6C, 0x97, 0xCC, 0x2A, 0x81}, 90},
+  {{0x04, 0x82, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 2},
+  {{0x04, 0x8A, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 7},
+  {{0x04, 0x8B, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 5},
+  {{0x04, 0x8C, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 4},
+  {{0x04, 0x8D, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 1},
+  {{0x04, 0x8F, 0x36, 0x20, 0xBF, 0x2A, 0x81}, 40},
+  {{0x04, 0x93, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 12},
+  {{0x04, 0x94, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 11},
+  {{0x04, 0x95, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 10},
+  {{0x04, 0x96, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 8},
+  {{0x04, 0x9B, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 19},
+  {{0x04, 0x9C, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 18},
+  {{0x04, 0x9D, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 17},
+  {{0x04, 0x9E, 0x68, 0x97, 0xCC, 0x2A, 0x81}, 141},
+  {{0x04, 0x9E, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 13},
+  {{0x04, 0xA4, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 26},
+  {{0x04, 0xA5, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 25},
+  {{0x04, 0xA6, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 22},
+  {{0x04, 0xA7, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 21},
+  {{0x04, 0xAC, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 32},
+  {{0x04, 0xAD, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 30},
+  {{0x04, 0xAE, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 29},
+  {{0x04, 0xAF, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 28},
+  {{0x04, 0xB4, 0xC6, 0x23, 0xBF, 0x2A, 0x81}, 52},
+  {{0x04, 0xB6, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 39},
+  {{0x04, 0xB7, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 37},
+  {{0x04, 0xB8, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 33},
+  {{0x04, 0xBD, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 47},
+  {{0x04, 0xBE, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 45},
+  {{0x04, 0xBF, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 43},
+  {{0x04, 0xC1, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 42},
+  {{0x04, 0xC6, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 51},
+  {{0x04, 0xC7, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 50},
+  {{0x04, 0xC8, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 49},
+  {{0x04, 0xC9, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 48},
+  {{0x04, 0xCE, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 57},
+  {{0x04, 0xCF, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 54},
+  {{0x04, 0xD1, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 145},
+  {{0x04, 0xD2, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 146},
+  {{0x04, 0xD7, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 199},
+  {{0x04, 0xD8, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 198},
+  {{0x04, 0xD8, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 62},
+  {{0x04, 0xD9, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 196},
+  {{0x04, 0xD9, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 60},
+  {{0x04, 0xDA, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 195},
+  {{0x04, 0xDA, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 58},
+  {{0x04, 0xDF, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 66},
+  {{0x04, 0xE1, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 194},
+  {{0x04, 0xE1, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 64},
+  {{0x04, 0xE2, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 191},
+  {{0x04, 0xE3, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 189},
+  {{0x04, 0xE3, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 63},
+  {{0x04, 0xE8, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 188},
+  {{0x04, 0xE8, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 83},
+  {{0x04, 0xE9, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 185},
+  {{0x04, 0xE9, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 80},
+  {{0x04, 0xEA, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 183},
+  {{0x04, 0xEA, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 74},
+  {{0x04, 0xEB, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 182},
+  {{0x04, 0xEB, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 71},
+  {{0x04, 0xF1, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 180},
+  {{0x04, 0xF2, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 176},
+  {{0x04, 0xF2, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 3},
+  {{0x04, 0xF3, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 175},
+  {{0x04, 0xF3, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 88},
+  {{0x04, 0xF4, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 174},
+  {{0x04, 0xF4, 0xD5, 0x22, 0xBF, 0x2A, 0x81}, 87},
+  {{0x04, 0xF9, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 171},
+  {{0x04, 0xFA, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 170},
+  {{0x04, 0xFB, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 166},
+  {{0x04, 0xFC, 0x6E, 0x97, 0xCC, 0x2A, 0x81}, 165},
+};
+
+constexpr bool quoteUidTableSorted() {
+  for (int i = 1; i < QUOTE_UID_COUNT; i++) {
+    int c = 0;
+    for (int k = 0; k < 7 && c == 0; k++) {
+      c = (int)QUOTE_UID_TABLE[i - 1].uid[k] - (int)QUOTE_UID_TABLE[i].uid[k];
+    }
+    if (c >= 0) return false;
+  }
+  return true;
+}
+static_assert(quoteUidTableSorted(), "QUOTE_UID_TABLE 必須依 UID 嚴格遞增");
@@ -0,0 +1,29 @@
+#pragma once
+// ===== 硬體抽象層 (HAL) =====
+// main.cpp 只 include 這個檔案，不直接碰 ESP8266 core / PN532 / WebSockets / NeoPixelBus 的 header。
+//   [env:nodemcuv2] → 接到真的 library；src/hal/esp8266/ 是我們自己寫、直接碰硬體的部分（PN532 SPI 傳輸層）
+//   [env:native]    → 接到 src/hal/native/：虛擬時鐘 + 腳本化 PN532 + 假 WebSocket server，
+//                     setup()/loop() 原封不動在 Linux 上跑（見 sim_main.cpp 的 benchmark）
+// 兩邊的型別與函數名稱一致（millis / Serial / WebSocketsServer / NfcAdapter / NeoPixelBus ...），
+// 所以 firmware 邏輯只有一份
+
+#ifdef ARDUINO
+
+#include <ESP8266WiFi.h>
+#include <WebSocketsServer.h>
+#include <SPI.h>
+#include <PN532_SPI.h>
+#include <PN532.h>
+#include <NfcAdapter.h>
+#include <string.h>
+#include <NeoPixelBus.h>
+#include <Ticker.h>
+#include <LittleFS.h>
+#include "hal/esp8266/pn532_spi_transport.h"
+
+#else
+
+#include "hal/native/native_hal.h"
+#include "hal/native/pn532_sim_transport.h"
+
+#endif
@@ -0,0 +1,72 @@
+#include "pn532_spi_transport.h"
+
+namespace {
+
+// PN532 SPI 的第一個 byte 決定這次 CS 視窗要做什麼
+const uint8_t PN532_SPI_STATREAD = 0x02;
+const uint8_t PN532_SPI_DATAWRITE = 0x01;
+const uint8_t PN532_SPI_DATAREAD = 0x03;
+
+// 跟 Seeed PN532_SPI 一樣：LSB first、mode 0、2MHz（它用的 SPI_CLOCK_DIV8）
+const SPISettings PN532_SPI_SETTINGS(2000000, LSBFIRST, SPI_MODE0);
+
+// CS 拉低後給 PN532 的準備時間。Seeed 用 delay(2) 是為了從 power-down 喚醒，
+// SAMConfig 之後 PN532 一直在 normal mode，不需要等那麼久
+const uint16_t PN532_CS_SETUP_US = 100;
+
+}  // namespace
+
+void Pn532SpiTransport::begin() {
+  pinMode(ss_, OUTPUT);
+  digitalWrite(ss_, HIGH);
+  if (irq_ >= 0) pinMode(irq_, INPUT_PULLUP);
+}
+
+void Pn532SpiTransport::select() {
+  spi_.beginTransaction(PN532_SPI_SETTINGS);
+  digitalWrite(ss_, LOW);
+}
+
+void Pn532SpiTransport::deselect() {
+  digitalWrite(ss_, HIGH);
+  spi_.endTransaction();
+}
+
+bool Pn532SpiTransport::ready() {
+  if (irq_ >= 0) return digitalRead(irq_) == LOW;
+  select();
+  spi_.transfer(PN532_SPI_STATREAD);
+  uint8_t status = spi_.transfer(0x00);
+  deselect();
+  return (status & 0x01) != 0;
+}
+
+void Pn532SpiTransport::writeFrame(const uint8_t* frame, uint8_t length) {
+  select();
+  delayMicroseconds(PN532_CS_SETUP_US);
+  spi_.transfer(PN532_SPI_DATAWRITE);
+  for (uint8_t i = 0; i < length; i++) spi_.transfer(frame[i]);
+  deselect();
+}
+
+uint8_t Pn532SpiTransport::readFrame(uint8_t* buffer, uint8_t maxLength) {
+  if (maxLength < 6) return 0;
+  select();
+  spi_.transfer(PN532_SPI_DATAREAD);
+  uint8_t n = 0;
+  // header：00 00 FF LEN LCS
+  while (n < 5) buffer[n++] = spi_.transfer(0x00);
+
+  uint8_t rest;
+  if (buffer[0] != 0x00 || buffer[1] != 0x00 || buffer[2] != 0xFF) {
+    rest = 0;   // 不是 frame，交給 Pn532Async 判斷失敗
+  } else if ((buffer[3] == 0x00 && buffer[4] == 0xFF) || (buffer[3] == 0xFF && buffer[4] == 0x00)) {
+    rest = 1;   // ACK / NACK：只剩 postamble
+  } else {
+    rest = buffer[3] + 2;   // data + DCS + postamble
+  }
+  if (rest > maxLength - n) rest = maxLength - n;
+  while (rest-- > 0) buffer[n++] = spi_.transfer(0x00);
+  deselect();
+  return n;
+}
@@ -0,0 +1,30 @@
+#pragma once
+// ===== PN532 SPI 傳輸層（ESP8266 實機）=====
+// 跟 Seeed 的 PN532_SPI 共用同一條 SPI 與 CS 腳；兩邊不會同時有指令在跑
+// （要用 Seeed 同步 API 之前 main.cpp 會先 Pn532Async::cancel()）
+//
+// ready()：有接 IRQ 腳就直接讀腳位（PN532 有資料時拉 LOW，不佔 SPI）；
+//          沒接（irqPin = -1）就讀一次 SPI status byte，約 2 byte 的傳輸時間
+
+#include <Arduino.h>
+#include <SPI.h>
+
+#include "../../pn532_async.h"
+
+class Pn532SpiTransport : public Pn532Transport {
+ public:
+  Pn532SpiTransport(SPIClass& spi, uint8_t ss, int8_t irqPin = -1) : spi_(spi), ss_(ss), irq_(irqPin) {}
+
+  void begin() override;
+  bool ready() override;
+  void writeFrame(const uint8_t* frame, uint8_t length) override;
+  uint8_t readFrame(uint8_t* buffer, uint8_t maxLength) override;
+
+ private:
+  void select();
+  void deselect();
+
+  SPIClass& spi_;
+  uint8_t ss_;
+  int8_t irq_;
+};
@@ -0,0 +1,578 @@
+#include "msg_harness.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+
+#include "native_hal.h"
+#include "sim.h"
+#include "../../json_reader.h"
+
+#if defined(__SANITIZE_ADDRESS__)
+#include <sanitizer/common_interface_defs.h>
+#endif
+
+void setup();
+void loop();
+void handleSerialCommands();
+void webSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length);
+extern int currentQuoteNumber;   // main.cpp，檢查 quoteNumber 的邊界情況有照 JSON 讀
+
+namespace msgharness {
+
+namespace {
+
+// 三個顯示端：二進位、JSON、訂了全部主題的 JSON（stats / led 也會送，輸出的 frame 比較多種）
+const uint8_t kBinaryClient = 0;
+const uint8_t kJsonClient = 1;
+const uint8_t kAllTopicsClient = 2;
+
+// 一個正常的展場 session：顯示端（js/nfc.js、js/main.js）+ hub 的心跳 + scripts/nfc_batch_write.py
+const char* const kRecordedTraffic[] = {
+  // 顯示端 JSON 連上：燈條 timeline、補拿斷線期間的事件
+  "ws:{\"type\":\"led_timeline\",\"keys\":\"e6a03cb300018813e6a03cb3ff000000\"}",
+  "ws:{\"type\":\"replay\",\"after\":0}",
+  "ws:{\"type\":\"subscribe\",\"topics\":\"scan,led\"}",
+  "ws:{\"type\":\"led_mode\",\"mode\":\"idle\"}",
+  // 抽到 #42 → 等掃描 → 掃錯瓶、掃對瓶 hold 一半拿走再放回 → 揭曉
+  "ws:{\"type\":\"update_current_quote\",\"quoteNumber\":42}",
+  "ws:{\"type\":\"led_mode\",\"mode\":\"await_scan\"}",
+  "ws:{\"type\":\"led_progress\",\"value\":0}",
+  "ws:{\"type\":\"hold_target\",\"quoteNumber\":42,\"ms\":5000}",
+  "ws:{\"type\":\"log_scan\",\"uid\":\"04:14:6F:97:CC:2A:81\",\"match\":\"#163\"}",
+  "ws:{\"type\":\"log_scan\",\"uid\":\"04:12:6F:97:CC:2A:81\",\"match\":\"#42\"}",
+  "ws:{\"type\":\"led_play\",\"offset\":0}",
+  "ws:{\"type\":\"led_stop\"}",
+  "ws:{\"type\":\"led_play\",\"offset\":1850}",
+  "ws:{\"type\":\"led_seek\",\"ms\":2500}",
+  "ws:{\"type\":\"led_progress\",\"value\":0.42}",
+  "ws:{\"type\":\"led_mode\",\"mode\":\"revealed\"}",
+  "ws:{\"type\":\"hold_target\",\"quoteNumber\":-1}",
+  "ws:{\"type\":\"log_scan\",\"uid\":\"(wildcard)\",\"match\":\"萬用卡\"}",
+  "ws:{\"type\":\"emulate_ndef\",\"url\":\"https://sccddegreeshow2026.com/the-pest\"}",
+  // hub / 維運頁
+  "ws:{\"type\":\"heartbeat\"}",
+  "ws:{\"type\":\"stats\"}",
+  "ws:{\"type\":\"unsubscribe\",\"topics\":\"led\"}",
+  // 二進位顯示端（?proto=bin）同一段流程
+  "bin:84ffffe6a03cb300018813e6a03cb3ff000000",
+  "bin:8100",
+  "bin:832a00",
+  "bin:8101",
+  "bin:820000",
+  "bin:882a008813",
+  "bin:8500000000",
+  "bin:82b836",
+  "bin:87",
+  "bin:853a070000",
+  "bin:86c4090000",
+  "bin:8102",
+  "bin:88ffff0000",
+  "bin:80",
+  // nfc_batch_write.py
+  "serial:STATUS",
+  "serial:QUEUE:https://sccddegreeshow2026.com/the-pest",
+  "serial:QUEUE:https://sccddegreeshow2026.com/deconstruction",
+  "serial:QUEUE:https://sccddegreeshow2026.com/azuki-maru",
+  "serial:START",
+  "serial:STATUS",
+  "serial:STOP",
+  "serial:STATS",
+  "serial:CANCEL",
+  "serial:WRITE:https://sccddegreeshow2026.com/azuki-maru",
+  "serial:STATUS",
+  "serial:CANCEL",
+};
+
+// 以前 indexOf / substring 版本出過事的形狀，fuzz 的種子裡固定放著
+const char* const kEdgeSeeds[] = {
+  "ws:{\"type\":\"update_current_quote\",\"quoteNumber\":12 }",
+  "ws:{\"type\":\"update_current_quote\",\"quoteNumber\":12,\"from\":\"hub\"}",
+  "ws:{ \"quoteNumber\" : -7 , \"type\" : \"update_current_quote\" }",
+  "ws:{\"type\":\"log_scan\",\"uid\":\"04:8D\",\"match\":\"say \\\"hi\\\" \\\\ \\u00e9\"}",
+  "ws:{\"type\":\"emulate_ndef\",\"url\":\"https://example.com/\\\"quoted\\\"\"}",
+  "ws:{\"type\":\"hold_target\",\"quoteNumber\":99999999999999999999}",
+  "ws:{\"type\":\"led_timeline\",\"keys\":\"e6a\",\"loop_from\":0,\"loop_to\":1}",
+  "ws:{\"type\":\"subscribe\",\"topics\":\",,,scan,,\"}",
+  "ws:{\"type\":\"replay\",\"after\":4294967295}",
+  "bin:84000100",
+  "bin:20",
+  "serial:WRITE:   ",
+  "serial:QUEUE:",
+};
+
+// 變異時插進去的 token：JSON 的結構字元、跳脫、邊界數字、handler 認得的 key
+const char* const kDictionary[] = {
+  "\"", "\\", "\\\"", "\\u", "\\u0000", "\\ud800", "\\uDFFF", "{", "}", "[", "]", ":", ",", " ", "\t",
+  "-", "0", "-0", "1e999", "-1e-999", "2147483648", "-2147483649", "99999999999999999999", "0.5", "NaN",
+  "true", "false", "null", "{}", "[[[[[[", "]]]]]]", "\"type\"", "\"quoteNumber\"", "\"uid\"", "\"url\"",
+  "\"after\"", "\"ms\"", "\"value\"", "\"keys\"", "\"topics\"", "\"mode\"", "\"offset\"", "\"loop_from\"",
+  "WRITE:", "QUEUE:", "START", "STOP", "CANCEL", "STATUS", "STATS", "STATS_RESET", "https://", "http://www.",
+  "\r", "\n", "\r\n", "\xff", "\xe8\xac", "%s%n%x",
+};
+
+bool parseLine(const std::string& line, Message* out) {
+  size_t colon = line.find(':');
+  if (colon == std::string::npos) return false;
+  std::string kind = line.substr(0, colon), body = line.substr(colon + 1);
+  if (kind == "ws") {
+    *out = {CH_WS_TEXT, body};
+  } else if (kind == "serial") {
+    *out = {CH_SERIAL, body};
+  } else if (kind == "bin") {
+    if (body.size() % 2 != 0) return false;
+    std::string bytes;
+    for (size_t i = 0; i < body.size(); i += 2) {
+      char* end;
+      std::string pair = body.substr(i, 2);
+      long v = strtol(pair.c_str(), &end, 16);
+      if (*end != '\0') return false;
+      bytes.push_back((char)v);
+    }
+    *out = {CH_WS_BINARY, bytes};
+  } else {
+    return false;
+  }
+  return true;
+}
+
+std::vector<Message> parseTable(const char* const* lines, size_t count) {
+  std::vector<Message> out;
+  for (size_t i = 0; i < count; i++) {
+    Message m;
+    if (parseLine(lines[i], &m)) out.push_back(m);
+  }
+  return out;
+}
+
+// 跟 sim_main.cpp 一樣的 xorshift：同一個 seed 每次產生一樣的輸入
+uint32_t g_rng = 1;
+uint32_t nextRand() {
+  g_rng ^= g_rng << 13;
+  g_rng ^= g_rng >> 17;
+  g_rng ^= g_rng << 5;
+  return g_rng;
+}
+uint32_t randBelow(uint32_t n) { return n ? nextRand() % n : 0; }
+
+int g_failed = 0;
+
+void expect(bool ok, const char* what) {
+  printf("  [%s] %s\n", ok ? "ok" : "FAIL", what);
+  if (!ok) g_failed++;
+}
+
+void runLoopFor(uint64_t us) {
+  uint64_t end = sim::nowMicros() + us;
+  while (sim::nowMicros() < end) {
+    loop();
+    sim::advanceMicros(sim::timing().loopOverheadUs);
+  }
+}
+
+void bootFirmware() {
+  setup();
+  while (WiFi.status() != WL_CONNECTED) {
+    loop();
+    sim::advanceMicros(sim::timing().loopOverheadUs);
+  }
+  sim::wsConnect(kBinaryClient, "/?proto=bin");
+  sim::wsConnect(kJsonClient, "/");
+  sim::wsConnect(kAllTopicsClient, "/?topics=scan,led,stats,write");
+  runLoopFor(50000);
+  sim::wsOutbox().clear();
+  sim::serialOutput().clear();
+}
+
+// 跟 WebSockets library 一樣：text payload 後面有 '\0'，binary 沒有。
+// 每則都配一塊剛好大小的 heap，ASan 才抓得到多讀一個 byte
+void deliver(const Message& m) {
+  size_t n = m.bytes.size();
+  switch (m.channel) {
+    case CH_WS_TEXT: {
+      uint8_t* payload = new uint8_t[n + 1];
+      memcpy(payload, m.bytes.data(), n);
+      payload[n] = 0;
+      webSocketEvent(kJsonClient, WStype_TEXT, payload, n);
+      delete[] payload;
+      break;
+    }
+    case CH_WS_BINARY: {
+      uint8_t* payload = new uint8_t[n ? n : 1];
+      memcpy(payload, m.bytes.data(), n);
+      webSocketEvent(kBinaryClient, WStype_BIN, payload, n);
+      delete[] payload;
+      break;
+    }
+    default:
+      sim::serialInput(m.bytes.data(), n);
+      sim::serialInput("\n");
+      handleSerialCommands();
+      break;
+  }
+}
+
+std::string hexDump(const std::string& bytes) {
+  std::string out;
+  char hex[4];
+  for (unsigned char c : bytes) {
+    snprintf(hex, sizeof(hex), "%02x", c);
+    out += hex;
+  }
+  return out;
+}
+
+const char* const kChannelNames[CH_COUNT] = {"ws", "bin", "serial"};
+
+const Message* g_current = nullptr;
+uint32_t g_currentRun = 0;
+
+// 重現用：印成 --traffic 的一行
+void printCurrent(const char* why) {
+  if (!g_current) return;
+  const Message& m = *g_current;
+  fprintf(stderr, "\n!! %s at fuzz run %u; input as a --traffic line:\n%s:%s\n", why, (unsigned)g_currentRun,
+          kChannelNames[m.channel], m.channel == CH_WS_BINARY ? hexDump(m.bytes).c_str() : m.bytes.c_str());
+}
+
+#if defined(__SANITIZE_ADDRESS__)
+void onSanitizerDeath() { printCurrent("sanitizer report"); }
+#endif
+
+const size_t kMaxInput = 2048;
+
+std::string mutate(const std::string& input, const std::vector<Message>& seeds, Channel channel) {
+  std::string s = input;
+  uint32_t rounds = 1 + randBelow(4);
+  for (uint32_t r = 0; r < rounds; r++) {
+    size_t at = randBelow((uint32_t)s.size() + 1);
+    switch (randBelow(8)) {
+      case 0:
+        if (!s.empty()) s[at % s.size()] ^= (char)(1 << randBelow(8));
+        break;
+      case 1: {
+        static const uint8_t kBytes[] = {0x00, 0xFF, 0x7F, 0x80, '"', '\\', '}', '0'};
+        if (!s.empty()) s[at % s.size()] = (char)kBytes[randBelow(sizeof(kBytes))];
+        break;
+      }
+      case 2:
+        s.insert(at, kDictionary[randBelow(sizeof(kDictionary) / sizeof(kDictionary[0]))]);
+        break;
+      case 3:
+        s.erase(at, 1 + randBelow(8));
+        break;
+      case 4: {
+        size_t n = 1 + randBelow(16);
+        s.insert(at, s.substr(at, n));
+        break;
+      }
+      case 5:
+        s.resize(at);
+        break;
+      case 6: {
+        // 跟同一個通道的另一則接起來
+        const Message& other = seeds[randBelow((uint32_t)seeds.size())];
+        if (other.channel != channel || other.bytes.empty()) break;
+        s = s.substr(0, at) + other.bytes.substr(randBelow((uint32_t)other.bytes.size()));
+        break;
+      }
+      default: {
+        // 很長的重複：長度欄位、buffer 邊界
+        std::string unit = s.empty() ? std::string("A") : s.substr(at % s.size(), 1 + randBelow(4));
+        uint32_t times = 1 + randBelow(600);
+        std::string block;
+        for (uint32_t i = 0; i < times && block.size() < kMaxInput; i++) block += unit;
+        s.insert(at, block);
+        break;
+      }
+    }
+  }
+  if (s.size() > kMaxInput) s.resize(kMaxInput);
+  return s;
+}
+
+// firmware 送給顯示端的每個 text frame 都要是合法 JSON（JsonReader 會驗過整包）
+bool outboxIsValid(size_t from, std::string* bad) {
+  const std::vector<sim::WsFrame>& out = sim::wsOutbox();
+  for (size_t i = from; i < out.size(); i++) {
+    if (out[i].binary) continue;
+    std::string copy = out[i].text;
+    JsonReader r;
+    if (!r.parse(&copy[0], copy.size()) || !r.getString("type")) {
+      *bad = out[i].text;
+      return false;
+    }
+  }
+  return true;
+}
+
+std::string messageName(const Message& m) {
+  char name[48];
+  if (m.channel == CH_WS_BINARY) {
+    snprintf(name, sizeof(name), "bin 0x%02X", m.bytes.empty() ? 0 : (uint8_t)m.bytes[0]);
+    return name;
+  }
+  if (m.channel == CH_SERIAL) {
+    size_t colon = m.bytes.find(':');
+    return "serial " + m.bytes.substr(0, colon == std::string::npos ? m.bytes.size() : colon + 1);
+  }
+  std::string copy = m.bytes;
+  JsonReader r;
+  const char* type = r.parse(&copy[0], copy.size()) ? r.getString("type") : nullptr;
+  return std::string("ws ") + (type ? type : "?");
+}
+
+// 每則訊息最多幾次 heap 配置（照 sim::noteHeapAlloc 的 ESP8266 規則算）
+// 三個通道都是 0：會超過 64 bytes 的 log / 回覆行（「收到訊息」、BATCH_STOPPED ...）都走 serialPrintf 的 stack buffer
+const uint32_t kAllocBudget[CH_COUNT] = {0, 0, 0};
+
+}  // namespace
+
+const std::vector<Message>& recordedTraffic() {
+  static const std::vector<Message> traffic =
+      parseTable(kRecordedTraffic, sizeof(kRecordedTraffic) / sizeof(kRecordedTraffic[0]));
+  return traffic;
+}
+
+bool loadTraffic(const char* path, std::vector<Message>* out) {
+  FILE* f = fopen(path, "rb");
+  if (!f) {
+    printf("can't open %s\n", path);
+    return false;
+  }
+  out->clear();
+  std::string line;
+  int lineNo = 0;
+  bool ok = true;
+  for (int c = fgetc(f);; c = fgetc(f)) {
+    if (c != EOF && c != '\n') {
+      line.push_back((char)c);
+      continue;
+    }
+    lineNo++;
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    Message m;
+    if (!line.empty() && line[0] != '#') {
+      if (parseLine(line, &m)) {
+        out->push_back(m);
+      } else {
+        printf("%s:%d: not ws:/bin:/serial: (%s)\n", path, lineNo, line.c_str());
+        ok = false;
+      }
+    }
+    line.clear();
+    if (c == EOF) break;
+  }
+  fclose(f);
+  return ok && !out->empty();
+}
+
+int runFuzz(const std::vector<Message>& traffic, unsigned seed, uint32_t runs) {
+  g_rng = seed ? seed : 1;
+  g_failed = 0;
+  std::vector<Message> seeds = traffic;
+  std::vector<Message> edges = parseTable(kEdgeSeeds, sizeof(kEdgeSeeds) / sizeof(kEdgeSeeds[0]));
+  seeds.insert(seeds.end(), edges.begin(), edges.end());
+#if defined(__SANITIZE_ADDRESS__)
+  __sanitizer_set_death_callback(onSanitizerDeath);
+  printf("fuzz: ASan / UBSan build\n");
+#else
+  printf("fuzz: plain build (build with -fsanitize=address,undefined to catch out-of-bounds reads)\n");
+#endif
+  bootFirmware();
+
+  printf("edge cases\n");
+  Message m = {CH_WS_TEXT, "{\"type\":\"update_current_quote\",\"quoteNumber\":12 }"};
+  deliver(m);
+  expect(currentQuoteNumber == 12, "quoteNumber followed by a space");
+  m.bytes = "{\"type\":\"update_current_quote\",\"quoteNumber\":13,\"from\":\"hub\"}";
+  deliver(m);
+  expect(currentQuoteNumber == 13, "quoteNumber followed by another field");
+  m.bytes = "{\"type\":\"update_current_quote\",\"quoteNumber\":\"14\"}";
+  deliver(m);
+  expect(currentQuoteNumber == 13, "quoteNumber as a string is ignored");
+  m.bytes = "{\"type\":\"update_current_quote\",\"quoteNumber\":15";
+  deliver(m);
+  expect(currentQuoteNumber == 13, "truncated message is ignored");
+  size_t mark = sim::serialOutput().size();
+  m.bytes = "{\"type\":\"log_scan\",\"uid\":\"04:8D\",\"match\":\"say \\\"hi\\\"\"}";
+  deliver(m);
+  expect(sim::serialOutput().find("say \"hi\"", mark) != std::string::npos,
+         "string with an escaped quote is read to the real end");
+  mark = sim::serialOutput().size();
+  deliver({CH_SERIAL, "QUEUE:https://" + std::string(400, 'a')});
+  deliver({CH_SERIAL, "STATUS"});
+  expect(sim::serialOutput().find("ERR:line_too_long", mark) != std::string::npos &&
+             sim::serialOutput().find("IDLE", mark) != std::string::npos,
+         "serial line longer than the buffer is dropped whole, next command still works");
+
+  printf("mutations (seed %u, %u runs, %zu seeds)\n", seed, (unsigned)runs, seeds.size());
+  uint32_t perChannel[CH_COUNT] = {};
+  size_t framesChecked = 0;
+  for (g_currentRun = 1; g_currentRun <= runs && !g_failed; g_currentRun++) {
+    const Message& base = seeds[randBelow((uint32_t)seeds.size())];
+    Message input = {base.channel, mutate(base.bytes, seeds, base.channel)};
+    // 偶爾把 JSON 當二進位送、二進位當 JSON 送
+    if (randBelow(16) == 0) input.channel = input.channel == CH_WS_TEXT ? CH_WS_BINARY : CH_WS_TEXT;
+    perChannel[input.channel]++;
+    g_current = &input;
+    size_t from = sim::wsOutbox().size();
+    deliver(input);
+    std::string bad;
+    if (!outboxIsValid(from, &bad)) {
+      printCurrent("invalid JSON sent to a display");
+      fprintf(stderr, "frame: %s\n", bad.c_str());
+      g_failed++;
+    }
+    framesChecked += sim::wsOutbox().size() - from;
+    g_current = nullptr;
+
+    // 讓 task 跑一下（flushEvents、heartbeat、stats 推送），frame 一樣要合法
+    if (g_currentRun % 64 == 0) {
+      from = sim::wsOutbox().size();
+      runLoopFor(20000);
+      if (!outboxIsValid(from, &bad)) {
+        fprintf(stderr, "\n!! invalid JSON from a task after fuzz run %u: %s\n", (unsigned)g_currentRun, bad.c_str());
+        g_failed++;
+      }
+      framesChecked += sim::wsOutbox().size() - from;
+      sim::wsOutbox().clear();
+      sim::serialOutput().clear();
+    }
+    if (g_currentRun % 2000 == 0) {
+      sim::wsDisconnect(kAllTopicsClient);
+      sim::wsConnect(kAllTopicsClient, "/?topics=scan,led,stats,write");
+    }
+  }
+  printf("  %u ws / %u bin / %u serial inputs, %zu frames checked\n", (unsigned)perChannel[CH_WS_TEXT],
+         (unsigned)perChannel[CH_WS_BINARY], (unsigned)perChannel[CH_SERIAL], framesChecked);
+  expect(!g_failed, "no crash, every frame sent is valid JSON");
+
+  // 被亂打一通之後還是正常服務
+  printf("still serving\n");
+  runLoopFor(50000);
+  mark = sim::serialOutput().size();
+  deliver({CH_SERIAL, "CANCEL"});
+  deliver({CH_SERIAL, "STATUS"});
+  expect(sim::serialOutput().find("IDLE", mark) != std::string::npos, "serial: CANCEL + STATUS -> IDLE");
+  size_t from = sim::wsOutbox().size();
+  deliver({CH_WS_TEXT, "{\"type\":\"heartbeat\"}"});
+  deliver({CH_WS_TEXT, "{\"type\":\"update_current_quote\",\"quoteNumber\":42}"});
+  bool heartbeat = false;
+  for (size_t i = from; i < sim::wsOutbox().size(); i++) {
+    heartbeat = heartbeat || sim::wsOutbox()[i].text.find("\"heartbeat\"") != std::string::npos;
+  }
+  expect(heartbeat && currentQuoteNumber == 42, "ws: heartbeat answered, current quote updated");
+
+  printf("\n%s (%d failed)\n", g_failed ? "FUZZ FAILED" : "fuzz passed", g_failed);
+  return g_failed ? 1 : 0;
+}
+
+int runBench(const std::vector<Message>& traffic, uint32_t passes, uint32_t minMsgsPerSec) {
+  g_failed = 0;
+  bootFirmware();
+
+  struct Row {
+    Channel channel;
+    uint32_t count = 0;
+    uint64_t ns = 0;
+    uint64_t virtualUs = 0;
+    uint32_t allocs = 0;
+    uint32_t maxAllocs = 0;
+  };
+  std::map<std::string, Row> rows;
+  std::vector<std::string> names;
+  for (const Message& m : traffic) names.push_back(messageName(m));
+
+  using Clock = std::chrono::steady_clock;
+  uint64_t totalNs = 0;
+  uint32_t totalMessages = 0, totalAllocs = 0;
+  // 第 0 輪暖身（第一次走到的路徑、lazy 初始化），不算
+  for (uint32_t pass = 0; pass <= passes; pass++) {
+    for (size_t i = 0; i < traffic.size(); i++) {
+      uint32_t allocsBefore = sim::heapAllocations();
+      uint64_t virtualBefore = sim::nowMicros();
+      Clock::time_point start = Clock::now();
+      deliver(traffic[i]);
+      uint64_t ns = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+      if (pass == 0) continue;
+      uint32_t allocs = sim::heapAllocations() - allocsBefore;
+      Row& row = rows[names[i]];
+      row.channel = traffic[i].channel;
+      row.count++;
+      row.ns += ns;
+      row.virtualUs += sim::nowMicros() - virtualBefore;
+      row.allocs += allocs;
+      row.maxAllocs = std::max(row.maxAllocs, allocs);
+      totalNs += ns;
+      totalMessages++;
+      totalAllocs += allocs;
+    }
+    // 輪跟輪之間讓 firmware 把事件送掉、清掉模擬器收集的輸出（都不算在時間裡）
+    runLoopFor(20000);
+    sim::wsOutbox().clear();
+    sim::serialOutput().clear();
+  }
+
+  printf("\n=== message path throughput (%u passes of %zu recorded messages, host time) ===\n", (unsigned)passes,
+         traffic.size());
+  printf("%-28s %8s %10s %12s %11s %10s\n", "message", "n", "ns/msg", "msgs/s", "allocs/msg", "virt us");
+  for (const auto& entry : rows) {
+    const Row& r = entry.second;
+    double ns = (double)r.ns / r.count;
+    printf("%-28s %8u %10.0f %12.0f %11.2f %10.1f\n", entry.first.c_str(), (unsigned)r.count, ns,
+           ns > 0 ? 1e9 / ns : 0.0, (double)r.allocs / r.count, (double)r.virtualUs / r.count);
+  }
+  double rate = totalNs ? totalMessages * 1e9 / totalNs : 0.0;
+  printf("%-28s %8u %10.0f %12.0f %11.2f\n\n", "total", (unsigned)totalMessages,
+         totalMessages ? (double)totalNs / totalMessages : 0.0, rate,
+         totalMessages ? (double)totalAllocs / totalMessages : 0.0);
+
+  for (const auto& entry : rows) {
+    if (entry.second.maxAllocs <= kAllocBudget[entry.second.channel]) continue;
+    printf("!! %s: %u heap allocations in one message (budget %u)\n", entry.first.c_str(),
+           (unsigned)entry.second.maxAllocs, (unsigned)kAllocBudget[entry.second.channel]);
+    g_failed++;
+  }
+  if (minMsgsPerSec && rate < minMsgsPerSec) {
+    printf("!! %.0f msgs/s is below --min-msgs-per-s %u\n", rate, (unsigned)minMsgsPerSec);
+    g_failed++;
+  }
+  printf("%s\n", g_failed ? "MSG BENCH FAILED" : "msg bench passed");
+  return g_failed ? 1 : 0;
+}
+
+}  // namespace msgharness
+
+// ===== libFuzzer 入口 =====
+// clang 才有 libFuzzer：
+//   clang++ -std=gnu++17 -g -O1 -fsanitize=fuzzer,address,undefined -D NFC_LIBFUZZER -D NFC_INLIST_TIMEOUT_MS=200 -Isrc/hal/native -Isrc $(find src -name '*.cpp' -not -path '*esp8266*') -o msg_fuzzer
+//   ./msg_fuzzer corpus/
+// 第一個 byte 選通道（% 3：ws / bin / serial），後面是訊息本身；sim_main.cpp 的 main() 不編進來
+#ifdef NFC_LIBFUZZER
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  static bool booted = false;
+  if (!booted) {
+    msgharness::bootFirmware();
+    booted = true;
+  }
+  if (size == 0) return 0;
+  msgharness::Message m = {(msgharness::Channel)(data[0] % msgharness::CH_COUNT),
+                           std::string((const char*)data + 1, size - 1)};
+  size_t from = sim::wsOutbox().size();
+  msgharness::deliver(m);
+  std::string bad;
+  if (!msgharness::outboxIsValid(from, &bad)) {
+    fprintf(stderr, "invalid JSON sent to a display: %s\n", bad.c_str());
+    abort();
+  }
+  // 模擬器的輸出緩衝不要一直長
+  if (sim::wsOutbox().size() > 4096) sim::wsOutbox().clear();
+  if (sim::serialOutput().size() > (1u << 20)) sim::serialOutput().clear();
+  return 0;
+}
+#endif
@@ -0,0 +1,43 @@
+#pragma once
+// ===== 訊息路徑的 fuzz / throughput benchmark =====
+// webSocketEvent()（JSON / 二進位）跟 handleSerialCommands() 吃的都是外面送進來的 bytes：
+// 展場的顯示端、hub、燒錄腳本，或是網路上任何連得到 port 81 的東西。
+// 這裡不碰 PN532 / WiFi，直接把訊息丟給 handler，用來在燒進展場的機器之前抓到
+//   - 當機 / 越界讀寫（用 -fsanitize=address,undefined 編的時候 ASan / UBSan 會直接停下來）
+//   - firmware 送出去的 JSON 壞掉（每個 text frame 都拿 JsonReader 驗過）
+//   - 變慢、多出 heap 配置（每種訊息的 msgs/s、每則幾次 heap 配置，超過預算 exit 1）
+//
+// 錄下來的流量：一個正常的展場 session（顯示端 JSON + 二進位、hub 轉送、nfc_batch_write.py 的 Serial 指令），
+// 一行一則，格式跟 --traffic 讀的檔案一樣：
+//   ws:<JSON>        顯示端送的 text frame
+//   bin:<hex>        二進位 frame（ws_binary.h）
+//   serial:<一行>    USB Serial 指令（不含換行）
+// 空行、# 開頭的行略過。
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace msgharness {
+
+enum Channel : uint8_t { CH_WS_TEXT, CH_WS_BINARY, CH_SERIAL, CH_COUNT };
+
+struct Message {
+  Channel channel;
+  std::string bytes;
+};
+
+// 內建的錄製流量
+const std::vector<Message>& recordedTraffic();
+// 讀 --traffic 的檔案；格式不對的行印出來並回 false
+bool loadTraffic(const char* path, std::vector<Message>* out);
+
+// 以錄製流量當種子做變異 fuzz（同一個 seed 每次跑的輸入一樣），壞掉 exit 1
+int runFuzz(const std::vector<Message>& seeds, unsigned seed, uint32_t runs);
+// 錄製流量重播 passes 次，印每種訊息的 msgs/s、每則的 heap 配置與虛擬時間；
+// 配置超過預算，或整體低於 minMsgsPerSec（0 = 不檢查）exit 1
+int runBench(const std::vector<Message>& traffic, uint32_t passes, uint32_t minMsgsPerSec);
+
+}  // namespace msgharness
@@ -0,0 +1,584 @@
+// ===== native HAL 實作 + 模擬狀態 =====
+// 所有「花時間」的硬體操作都換算成虛擬時間推進，數字來自 sim::timing()
+
+#include "native_hal.h"
+
+#include "ndef_encoder.h"
+
+#include <deque>
+#include <map>
+
+HardwareSerial Serial;
+EspClass ESP;
+ESP8266WiFiClass WiFi;
+SPIClass SPI;
+FS LittleFS;
+
+namespace sim {
+
+namespace {
+
+uint64_t g_now = 0;
+bool g_inTicker = false;
+Timing g_timing;
+
+struct TickerSlot {
+  int id;
+  uint32_t periodUs;
+  uint64_t nextUs;
+  void (*cb)();
+};
+std::vector<TickerSlot> g_tickers;
+int g_nextTickerId = 0;
+
+std::vector<TagWindow> g_tags;
+NfcCounters g_nfc;
+Pn532Fault g_pn532Fault = PN532_FAULT_NONE;
+std::map<std::string, std::vector<uint8_t>> g_tagMemory;   // UID bytes → 4 × kTagPages
+NdefWriteFault g_ndefWriteFault = NDEF_WRITE_OK;
+
+struct WsEvent {
+  uint8_t num;
+  WStype_t type;
+  std::string text;
+};
+std::deque<WsEvent> g_wsInbox;
+std::vector<WsFrame> g_wsOutbox;
+bool g_wsClients[WEBSOCKETS_SERVER_CLIENT_MAX] = {};
+
+std::deque<char> g_serialIn;
+bool g_serialEcho = false;
+std::string g_serialOut;
+uint64_t g_serialFifoEmptyAt = 0;   // TX FIFO 排空的時間點
+const uint32_t kSerialFifo = 128;
+
+uint64_t g_wifiConnectedAt = UINT64_MAX;
+uint64_t g_wifiFailAt = UINT64_MAX;   // 直連找不到 AP：這之後 status 回 WL_NO_SSID_AVAIL
+bool g_wifiLost = false;
+uint32_t g_wifiStaticIp = 0;          // WiFi.config 設的固定 IP（0 = DHCP）
+uint8_t g_wifiBssid[6] = {};
+int32_t g_wifiChannel = 0;
+WifiAp g_wifiAp;
+WifiCounters g_wifiCounters;
+uint32_t g_rtcMem[128] = {};
+uint32_t g_ledShows = 0;
+uint32_t g_heapAllocs = 0;
+std::map<std::string, std::string> g_flashFiles;
+FlashCounters g_flash;
+
+uint32_t connectedClients() {
+  uint32_t n = 0;
+  for (bool c : g_wsClients) n += c ? 1 : 0;
+  return n;
+}
+
+}  // namespace
+
+uint64_t nowMicros() { return g_now; }
+
+void advanceTo(uint64_t target) {
+  if (target <= g_now) return;
+  if (g_inTicker) { g_now = target; return; }
+  for (;;) {
+    TickerSlot* due = nullptr;
+    for (TickerSlot& t : g_tickers) {
+      if (t.nextUs <= target && (!due || t.nextUs < due->nextUs)) due = &t;
+    }
+    if (!due) break;
+    if (due->nextUs > g_now) g_now = due->nextUs;
+    due->nextUs += due->periodUs;
+    void (*cb)() = due->cb;
+    g_inTicker = true;
+    cb();
+    g_inTicker = false;
+    // callback 自己吃掉的時間會把 target 往後推（CPU 被搶走）
+    if (g_now > target) target = g_now;
+  }
+  g_now = target;
+}
+
+void advanceMicros(uint64_t us) { advanceTo(g_now + us); }
+
+int addTicker(uint32_t periodUs, void (*cb)()) {
+  int id = g_nextTickerId++;
+  g_tickers.push_back({id, periodUs, g_now + periodUs, cb});
+  return id;
+}
+
+void removeTicker(int id) {
+  for (size_t i = 0; i < g_tickers.size(); i++) {
+    if (g_tickers[i].id == id) { g_tickers.erase(g_tickers.begin() + i); return; }
+  }
+}
+
+Timing& timing() { return g_timing; }
+
+void scheduleTag(const uint8_t* uid, uint8_t uidLength, uint64_t enterUs, uint64_t leaveUs) {
+  TagWindow w;
+  memcpy(w.uid, uid, uidLength);
+  w.uidLength = uidLength;
+  w.enterUs = enterUs;
+  w.leaveUs = leaveUs;
+  g_tags.push_back(w);
+}
+
+void clearTags() { g_tags.clear(); }
+
+const TagWindow* tagAt(uint64_t us) {
+  for (const TagWindow& w : g_tags) {
+    if (w.enterUs <= us && us < w.leaveUs) return &w;
+  }
+  return nullptr;
+}
+
+size_t tagsAt(uint64_t us, const TagWindow** out, size_t max) {
+  size_t n = 0;
+  for (const TagWindow& w : g_tags) {
+    if (n < max && w.enterUs <= us && us < w.leaveUs) out[n++] = &w;
+  }
+  return n;
+}
+
+const TagWindow* nextTagBetween(uint64_t fromUs, uint64_t untilUs) {
+  const TagWindow* best = nullptr;
+  for (const TagWindow& w : g_tags) {
+    if (w.enterUs >= fromUs && w.enterUs < untilUs && (!best || w.enterUs < best->enterUs)) best = &w;
+  }
+  return best;
+}
+
+NfcCounters& nfcCounters() { return g_nfc; }
+
+void pn532FailNext(Pn532Fault fault) { g_pn532Fault = fault; }
+Pn532Fault takePn532Fault() {
+  Pn532Fault f = g_pn532Fault;
+  g_pn532Fault = PN532_FAULT_NONE;
+  return f;
+}
+
+void wsConnect(uint8_t num, const char* url) { g_wsInbox.push_back({num, WStype_CONNECTED, url}); }
+void wsDisconnect(uint8_t num) { g_wsInbox.push_back({num, WStype_DISCONNECTED, ""}); }
+void wsSendText(uint8_t num, const char* text) { g_wsInbox.push_back({num, WStype_TEXT, text}); }
+void wsSendBinary(uint8_t num, const uint8_t* data, size_t length) {
+  g_wsInbox.push_back({num, WStype_BIN, std::string((const char*)data, length)});
+}
+std::vector<WsFrame>& wsOutbox() { return g_wsOutbox; }
+
+void serialInput(const char* text) {
+  for (const char* p = text; *p; p++) g_serialIn.push_back(*p);
+}
+void serialInput(const char* bytes, size_t length) {
+  for (size_t i = 0; i < length; i++) g_serialIn.push_back(bytes[i]);
+}
+void setSerialEcho(bool echo) { g_serialEcho = echo; }
+std::string& serialOutput() { return g_serialOut; }
+
+uint8_t* tagPages(const uint8_t* uid, uint8_t uidLength) {
+  std::vector<uint8_t>& pages = g_tagMemory[std::string((const char*)uid, uidLength)];
+  if (pages.empty()) {
+    pages.assign(4 * kTagPages, 0x00);
+    memcpy(&pages[0], uid, uidLength < 8 ? uidLength : 8);
+    const uint8_t cc[4] = { 0xE1, 0x10, 0x12, 0x00 };   // NDEF 1.0，144 bytes，可讀寫
+    const uint8_t emptyNdef[4] = { 0x03, 0x00, 0xFE, 0x00 };
+    memcpy(&pages[3 * 4], cc, 4);
+    memcpy(&pages[4 * 4], emptyNdef, 4);
+  }
+  return &pages[0];
+}
+
+bool setTagNdef(const uint8_t* uid, uint8_t uidLength, const std::string& message) {
+  uint8_t* data = tagPages(uid, uidLength) + 4 * 4;
+  size_t room = 4 * (kTagPages - 4);
+  size_t header = message.size() < 0xFF ? 2 : 4;
+  if (header + message.size() + 1 > room) return false;
+  size_t n = 0;
+  data[n++] = 0x03;
+  if (header == 2) {
+    data[n++] = (uint8_t)message.size();
+  } else {
+    data[n++] = 0xFF;
+    data[n++] = (uint8_t)(message.size() >> 8);
+    data[n++] = (uint8_t)message.size();
+  }
+  memcpy(data + n, message.data(), message.size());
+  n += message.size();
+  data[n++] = 0xFE;
+  return true;
+}
+
+bool tagNdef(const uint8_t* uid, uint8_t uidLength, std::string* message) {
+  auto it = g_tagMemory.find(std::string((const char*)uid, uidLength));
+  if (it == g_tagMemory.end()) return false;
+  const uint8_t* data = &it->second[4 * 4];
+  size_t room = 4 * (kTagPages - 4);
+  if (data[0] != 0x03) return false;
+  size_t header = data[1] == 0xFF ? 4 : 2;
+  size_t length = header == 2 ? data[1] : ((size_t)data[2] << 8 | data[3]);
+  if (length == 0 || header + length > room) return false;
+  message->assign((const char*)data + header, length);
+  return true;
+}
+
+bool tagUri(const uint8_t* uid, uint8_t uidLength, std::string* uri) {
+  std::string bytes;
+  if (!tagNdef(uid, uidLength, &bytes)) return false;
+  NdefMessage message((const byte*)bytes.data(), (int)bytes.size());
+  if (message.getRecordCount() < 1) return false;
+  NdefRecord record = message.getRecord(0);
+  uint8_t type = 0;
+  if (record.getTnf() != 0x01 || record.getTypeLength() != 1 || record.getPayloadLength() < 1) return false;
+  record.getType(&type);
+  if (type != 'U') return false;
+  std::string payload(record.getPayloadLength(), '\0');
+  record.getPayload((byte*)&payload[0]);
+  const char* prefix = ndef::uriPrefixText((uint8_t)payload[0]);
+  if (!prefix) return false;
+  if (uri) *uri = prefix + payload.substr(1);
+  return true;
+}
+
+void clearTagMemory() { g_tagMemory.clear(); }
+void ndefFailNextWrite(NdefWriteFault fault) { g_ndefWriteFault = fault; }
+NdefWriteFault takeNdefWriteFault() {
+  NdefWriteFault f = g_ndefWriteFault;
+  g_ndefWriteFault = NDEF_WRITE_OK;
+  return f;
+}
+
+void noteLedShow(uint32_t costUs) {
+  g_ledShows++;
+  advanceMicros(costUs);
+}
+uint32_t ledShowCount() { return g_ledShows; }
+
+void noteHeapAlloc() { g_heapAllocs++; }
+uint32_t heapAllocations() { return g_heapAllocs; }
+
+FlashCounters& flashCounters() { return g_flash; }
+std::string* flashFile(const char* path) {
+  auto it = g_flashFiles.find(path);
+  return it == g_flashFiles.end() ? nullptr : &it->second;
+}
+void flashErase() { g_flashFiles.clear(); }
+
+WifiAp& wifiAp() { return g_wifiAp; }
+void wifiDrop() {
+  if (g_now < g_wifiConnectedAt) return;
+  g_wifiConnectedAt = UINT64_MAX;
+  g_wifiLost = true;
+}
+WifiCounters& wifiCounters() { return g_wifiCounters; }
+void rtcErase() { memset(g_rtcMem, 0, sizeof(g_rtcMem)); }
+
+}  // namespace sim
+
+// ===== Arduino core =====
+unsigned long millis() { return (unsigned long)(sim::nowMicros() / 1000); }
+unsigned long micros() { return (unsigned long)sim::nowMicros(); }
+void delay(unsigned long ms) { sim::advanceMicros((uint64_t)ms * 1000); }
+void yield() {}
+
+int HardwareSerial::available() { return (int)sim::g_serialIn.size(); }
+
+int HardwareSerial::read() {
+  if (sim::g_serialIn.empty()) return -1;
+  char c = sim::g_serialIn.front();
+  sim::g_serialIn.pop_front();
+  return (unsigned char)c;
+}
+
+size_t HardwareSerial::write(const char* s, size_t n) {
+  using namespace sim;
+  if (g_serialEcho) fwrite(s, 1, n, stdout);
+  g_serialOut.append(s, n);
+  // FIFO 還塞得下就不阻塞；塞不下就等到有空位（跟 ESP8266 core 的 uart_write 一樣）
+  const uint64_t charUs = g_timing.serialUsPerChar;
+  uint64_t start = g_serialFifoEmptyAt > g_now ? g_serialFifoEmptyAt : g_now;
+  uint64_t emptyAt = start + n * charUs;
+  uint64_t mustWaitUntil = emptyAt > kSerialFifo * charUs ? emptyAt - kSerialFifo * charUs : 0;
+  g_serialFifoEmptyAt = emptyAt;
+  if (mustWaitUntil > g_now) advanceTo(mustWaitUntil);
+  return n;
+}
+
+size_t HardwareSerial::printf(const char* fmt, ...) {
+  char buf[512];
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  if (n < 0) return 0;
+  // ESP8266 core 的 Print::printf 只有 64 bytes 的 stack 暫存，超過就 new char[n + 1]
+  if (n >= 64) sim::noteHeapAlloc();
+  if ((size_t)n >= sizeof(buf)) n = sizeof(buf) - 1;
+  return write(buf, (size_t)n);
+}
+
+uint32_t EspClass::getFreeHeap() { return 40000; }
+uint32_t EspClass::getMaxFreeBlockSize() { return 36000; }
+uint8_t EspClass::getHeapFragmentation() { return 10; }
+
+bool EspClass::rtcUserMemoryRead(uint32_t offset, uint32_t* data, size_t size) {
+  if (offset * 4 + size > sizeof(sim::g_rtcMem)) return false;
+  memcpy(data, (uint8_t*)sim::g_rtcMem + offset * 4, size);
+  return true;
+}
+
+bool EspClass::rtcUserMemoryWrite(uint32_t offset, uint32_t* data, size_t size) {
+  if (offset * 4 + size > sizeof(sim::g_rtcMem)) return false;
+  memcpy((uint8_t*)sim::g_rtcMem + offset * 4, data, size);
+  return true;
+}
+
+// ===== WiFi =====
+wl_status_t ESP8266WiFiClass::begin(const char* ssid, const char* pass, int32_t channel, const uint8_t* bssid,
+                                    bool connect) {
+  (void)ssid; (void)pass;
+  sim::g_wifiLost = false;
+  sim::g_wifiFailAt = UINT64_MAX;
+  sim::g_wifiConnectedAt = UINT64_MAX;
+  if (!connect) return WL_DISCONNECTED;
+  const sim::Timing& tm = sim::g_timing;
+  uint64_t dhcpUs = sim::g_wifiStaticIp ? 0 : (uint64_t)tm.wifiDhcpMs * 1000;
+  if (channel > 0 && bssid) {
+    sim::g_wifiCounters.direct++;
+    if (channel != sim::g_wifiAp.channel || memcmp(bssid, sim::g_wifiAp.bssid, 6) != 0) {
+      sim::g_wifiFailAt = sim::nowMicros() + (uint64_t)tm.wifiJoinMs * 1000;
+      return WL_DISCONNECTED;
+    }
+    sim::g_wifiConnectedAt = sim::nowMicros() + (uint64_t)tm.wifiJoinMs * 1000 + dhcpUs;
+  } else {
+    sim::g_wifiCounters.scans++;
+    uint64_t fullUs = (uint64_t)tm.wifiConnectMs * 1000;
+    sim::g_wifiConnectedAt = sim::nowMicros() + (sim::g_wifiStaticIp ? fullUs - (uint64_t)tm.wifiDhcpMs * 1000 : fullUs);
+  }
+  if (sim::g_wifiStaticIp) sim::g_wifiCounters.staticIp++;
+  memcpy(sim::g_wifiBssid, sim::g_wifiAp.bssid, 6);
+  sim::g_wifiChannel = sim::g_wifiAp.channel;
+  return WL_DISCONNECTED;
+}
+
+bool ESP8266WiFiClass::config(IPAddress localIp, IPAddress gateway, IPAddress subnet, IPAddress dns1) {
+  (void)gateway; (void)subnet; (void)dns1;
+  sim::g_wifiStaticIp = (uint32_t)localIp;
+  return true;
+}
+
+wl_status_t ESP8266WiFiClass::status() {
+  if (sim::nowMicros() >= sim::g_wifiConnectedAt) return WL_CONNECTED;
+  if (sim::nowMicros() >= sim::g_wifiFailAt) return WL_NO_SSID_AVAIL;
+  return sim::g_wifiLost ? WL_CONNECTION_LOST : WL_DISCONNECTED;
+}
+
+IPAddress ESP8266WiFiClass::localIP() {
+  return sim::g_wifiStaticIp ? IPAddress(sim::g_wifiStaticIp) : IPAddress(192, 168, 137, 218);
+}
+
+uint8_t* ESP8266WiFiClass::BSSID() { return sim::g_wifiBssid; }
+int32_t ESP8266WiFiClass::channel() { return sim::g_wifiChannel; }
+
+// ===== LittleFS =====
+File FS::open(const char* path, const char* mode) {
+  std::string* data = sim::flashFile(path);
+  if (mode[0] == 'r') return data ? File(path, false, 0) : File();
+  if (mode[0] == 'w' || !data) sim::g_flashFiles[path].clear();
+  return File(path, true, sim::g_flashFiles[path].size());
+}
+
+bool FS::remove(const char* path) { return sim::g_flashFiles.erase(path) > 0; }
+
+size_t File::write(const uint8_t* data, size_t length) {
+  std::string* file = sim::flashFile(path_.c_str());
+  if (!open_ || !writable_ || !file) return 0;
+  if (file->size() < pos_ + length) file->resize(pos_ + length);
+  memcpy(&(*file)[pos_], data, length);
+  pos_ += length;
+  dirty_ = true;
+  sim::g_flash.bytes += length;
+  return length;
+}
+
+size_t File::read(uint8_t* data, size_t length) {
+  std::string* file = sim::flashFile(path_.c_str());
+  if (!open_ || !file || pos_ >= file->size()) return 0;
+  size_t n = file->size() - pos_ < length ? file->size() - pos_ : length;
+  memcpy(data, file->data() + pos_, n);
+  pos_ += n;
+  return n;
+}
+
+int File::available() {
+  std::string* file = sim::flashFile(path_.c_str());
+  return open_ && file && file->size() > pos_ ? (int)(file->size() - pos_) : 0;
+}
+
+size_t File::size() {
+  std::string* file = sim::flashFile(path_.c_str());
+  return file ? file->size() : 0;
+}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+  size_t base = mode == SeekSet ? 0 : mode == SeekCur ? pos_ : size();
+  if (base + pos > size()) return false;
+  pos_ = base + pos;
+  return true;
+}
+
+void File::close() {
+  if (open_ && dirty_) {
+    sim::g_flash.commits++;
+    sim::advanceMicros(sim::g_timing.flashCommitUs);
+  }
+  open_ = false;
+  dirty_ = false;
+}
+
+// ===== WebSocketsServer =====
+void WebSocketsServer::begin() {}
+
+void WebSocketsServer::loop() {
+  using namespace sim;
+  while (!g_wsInbox.empty()) {
+    WsEvent ev = g_wsInbox.front();
+    g_wsInbox.pop_front();
+    if (ev.num < WEBSOCKETS_SERVER_CLIENT_MAX) {
+      if (ev.type == WStype_CONNECTED) g_wsClients[ev.num] = true;
+      if (ev.type == WStype_DISCONNECTED) g_wsClients[ev.num] = false;
+    }
+    if (cb_) cb_(ev.num, ev.type, (uint8_t*)&ev.text[0], ev.text.size());
+  }
+}
+
+bool WebSocketsServer::sendTXT(uint8_t num, const char* payload, size_t length) {
+  using namespace sim;
+  if (num >= WEBSOCKETS_SERVER_CLIENT_MAX || !g_wsClients[num]) return false;
+  if (length == 0) length = strlen(payload);
+  advanceMicros(g_timing.wsSendUs);
+  g_wsOutbox.push_back({nowMicros(), num, std::string(payload, length), false});
+  return true;
+}
+
+bool WebSocketsServer::sendBIN(uint8_t num, const uint8_t* payload, size_t length) {
+  using namespace sim;
+  if (num >= WEBSOCKETS_SERVER_CLIENT_MAX || !g_wsClients[num]) return false;
+  advanceMicros(g_timing.wsSendUs);
+  g_wsOutbox.push_back({nowMicros(), num, std::string((const char*)payload, length), true});
+  return true;
+}
+
+bool WebSocketsServer::broadcastTXT(const char* payload, size_t length) {
+  using namespace sim;
+  if (length == 0) length = strlen(payload);
+  uint32_t n = connectedClients();
+  advanceMicros((uint64_t)g_timing.wsSendUs * n);
+  g_wsOutbox.push_back({nowMicros(), -1, std::string(payload, length), false});
+  return n > 0;
+}
+
+// ===== PN532 / NDEF =====
+bool PN532::SAMConfig() {
+  sim::advanceMicros(1000);
+  return true;
+}
+
+void NfcAdapter::begin(bool verbose) {
+  (void)verbose;
+  sim::advanceMicros(5000);   // getFirmwareVersion + SAMConfig
+}
+
+bool NfcAdapter::tagPresent(unsigned long timeout) {
+  using namespace sim;
+  g_nfc.inList++;
+  uint64_t start = nowMicros();
+  uint64_t deadline = start + (uint64_t)(timeout ? timeout : g_timing.inListTimeoutMs) * 1000;
+
+  // 卡已經在場上：一次 InListPassiveTarget 就回來
+  // 不在：PN532 一直重試（MxRtyPassiveActivation=0xFF），等到卡放上或 timeout
+  const TagWindow* w = tagAt(start);
+  if (!w) {
+    w = nextTagBetween(start, deadline);
+    if (!w) {
+      advanceTo(deadline);
+      g_nfc.inListTimeouts++;
+      uidLength_ = 0;
+      return false;
+    }
+    advanceTo(w->enterUs);
+  }
+  advanceMicros(g_timing.inListUs);
+  memcpy(uid_, w->uid, w->uidLength);
+  uidLength_ = w->uidLength;
+  return true;
+}
+
+NfcTag NfcAdapter::read() {
+  sim::g_nfc.ndefReads++;
+  sim::advanceMicros(sim::g_timing.ndefReadUs);
+  std::string bytes;
+  if (!sim::tagNdef(uid_, uidLength_, &bytes)) return NfcTag(uid_, uidLength_);
+  return NfcTag(uid_, uidLength_, NdefMessage((const byte*)bytes.data(), (int)bytes.size()));
+}
+
+bool NfcAdapter::write(NdefMessage& message) {
+  using namespace sim;
+  g_nfc.ndefWrites++;
+  advanceMicros(g_timing.ndefWriteUs);
+  NdefWriteFault fault = takeNdefWriteFault();
+  if (tagAt(nowMicros()) == nullptr || fault == NDEF_WRITE_FAIL) return false;
+  std::string bytes = message.bytes();
+  if (fault == NDEF_WRITE_CORRUPT && !bytes.empty()) bytes[bytes.size() - 1] ^= 0x01;
+  return setTagNdef(uid_, uidLength_, bytes);
+}
+
+// ===== NdefMessage：從編好的 bytes 一筆一筆拆 record（SR / IL 都認）=====
+namespace {
+
+// 第 index 筆 record 的位置；格式不對或沒有這筆回 false
+bool ndefRecordAt(const std::string& m, unsigned int index, NdefRecord* out) {
+  size_t pos = 0;
+  for (unsigned int i = 0; pos < m.size(); i++) {
+    uint8_t header = (uint8_t)m[pos];
+    size_t fixed = 2 + ((header & 0x10) ? 1 : 4) + ((header & 0x08) ? 1 : 0);
+    if (pos + fixed > m.size()) return false;
+    size_t typeLength = (uint8_t)m[pos + 1];
+    size_t payloadLength = 0;
+    size_t p = pos + 2;
+    if (header & 0x10) {
+      payloadLength = (uint8_t)m[p++];
+    } else {
+      for (int k = 0; k < 4; k++) payloadLength = payloadLength << 8 | (uint8_t)m[p++];
+    }
+    size_t idLength = (header & 0x08) ? (uint8_t)m[p++] : 0;
+    size_t end = p + typeLength + idLength + payloadLength;
+    if (end > m.size()) return false;
+    if (i == index) {
+      if (out) *out = NdefRecord(header & 0x07, m.substr(p, typeLength), m.substr(p + typeLength + idLength, payloadLength));
+      return true;
+    }
+    if (header & 0x40) return false;   // ME
+    pos = end;
+  }
+  return false;
+}
+
+}  // namespace
+
+void NdefMessage::addUriRecord(const char* uri) {
+  // 這個 fake 只會被用來組單一 record 的 message
+  size_t payload = 1 + strlen(uri);
+  if (payload > 0xFF) return;
+  bytes_.assign({(char)0xD1, 0x01, (char)payload, 'U', 0x00});
+  bytes_ += uri;
+}
+
+unsigned int NdefMessage::getRecordCount() {
+  unsigned int count = 0;
+  while (ndefRecordAt(bytes_, count, nullptr)) count++;
+  return count;
+}
+
+NdefRecord NdefMessage::getRecord(int index) {
+  NdefRecord record;
+  ndefRecordAt(bytes_, (unsigned int)index, &record);
+  return record;
+}
@@ -0,0 +1,338 @@
+#pragma once
+// ===== native 版的 Arduino / ESP8266 / library API =====
+// 只做 main.cpp 用得到的那一小塊，介面跟真的 library 同名同簽名，
+// 行為接到 sim.h 的虛擬時鐘與腳本（見 native_hal.cpp）
+
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+#include "wstring.h"
+#include "sim.h"
+
+// ===== Arduino core =====
+typedef uint8_t byte;
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+// flash 常數：Linux 上沒有 flash / RAM 分別，直接讀
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define memcmp_P memcmp
+#define memcpy_P memcpy
+
+// NodeMCU 腳位（值跟 ESP8266 core 的 pins_arduino.h 一致）
+#define D1 5
+#define D2 4
+#define D4 2
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+
+class HardwareSerial {
+ public:
+  void begin(unsigned long baud) { (void)baud; }
+  int available();
+  int read();
+  size_t write(const char* s, size_t n);
+
+  size_t print(const char* s) { return write(s, strlen(s)); }
+  size_t print(const String& s) { return write(s.c_str(), s.length()); }
+  size_t print(char c) { return write(&c, 1); }
+  size_t print(int v) { return printf("%d", v); }
+  size_t print(unsigned int v) { return printf("%u", v); }
+  size_t print(long v) { return printf("%ld", v); }
+  size_t print(unsigned long v) { return printf("%lu", v); }
+  size_t print(double v) { return printf("%.2f", v); }
+  template <typename T> size_t println(const T& v) { size_t n = print(v); return n + println(); }
+  size_t println() { return write("\r\n", 2); }
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+};
+extern HardwareSerial Serial;
+
+class EspClass {
+ public:
+  uint32_t getFreeHeap();
+  uint32_t getMaxFreeBlockSize();
+  uint8_t getHeapFragmentation();   // 0 ~ 100（%）
+  // 80MHz 的 cycle counter，換算自虛擬時鐘
+  uint32_t getCycleCount() { return (uint32_t)(sim::nowMicros() * 80); }
+  // RTC user memory：offset 以 4 bytes 為單位，共 128 個；size 是 bytes
+  bool rtcUserMemoryRead(uint32_t offset, uint32_t* data, size_t size);
+  bool rtcUserMemoryWrite(uint32_t offset, uint32_t* data, size_t size);
+};
+extern EspClass ESP;
+
+// ===== ESP8266WiFi =====
+enum WiFiMode_t { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 };
+enum WiFiSleepType_t { WIFI_NONE_SLEEP = 0, WIFI_LIGHT_SLEEP = 1, WIFI_MODEM_SLEEP = 2 };
+enum wl_status_t {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_SCAN_COMPLETED = 2,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_WRONG_PASSWORD = 6,
+  WL_DISCONNECTED = 7
+};
+
+class IPAddress {
+ public:
+  IPAddress() : b_{0, 0, 0, 0} {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : b_{a, b, c, d} {}
+  // 跟 ESP8266 core 一樣：uint32_t 是記憶體裡的 4 bytes（第一個 byte 在最低位）
+  IPAddress(uint32_t v) : b_{(uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16), (uint8_t)(v >> 24)} {}
+  operator uint32_t() const {
+    return (uint32_t)b_[0] | ((uint32_t)b_[1] << 8) | ((uint32_t)b_[2] << 16) | ((uint32_t)b_[3] << 24);
+  }
+  uint8_t operator[](int i) const { return b_[i]; }
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", b_[0], b_[1], b_[2], b_[3]);
+    return String(buf);
+  }
+ private:
+  uint8_t b_[4];
+};
+
+class ESP8266WiFiClass {
+ public:
+  bool mode(WiFiMode_t m) { (void)m; return true; }
+  bool setSleepMode(WiFiSleepType_t t) { (void)t; return true; }
+  bool setAutoReconnect(bool v) { (void)v; return true; }
+  bool setAutoConnect(bool v) { (void)v; return true; }
+  void persistent(bool v) { (void)v; }
+  void setOutputPower(float dBm) { (void)dBm; }
+  // channel / bssid 有給 = 不掃描，直接在那個 channel 找那台 AP
+  wl_status_t begin(const char* ssid, const char* pass, int32_t channel = 0, const uint8_t* bssid = nullptr,
+                    bool connect = true);
+  // local_ip = 0.0.0.0 → 回到 DHCP
+  bool config(IPAddress localIp, IPAddress gateway, IPAddress subnet, IPAddress dns1 = IPAddress());
+  wl_status_t status();
+  IPAddress localIP();
+  IPAddress gatewayIP() { return IPAddress(192, 168, 137, 1); }
+  IPAddress subnetMask() { return IPAddress(255, 255, 255, 0); }
+  IPAddress dnsIP(uint8_t n = 0) { (void)n; return IPAddress(192, 168, 137, 1); }
+  uint8_t* BSSID();
+  int32_t channel();
+  bool softAP(const char* ssid, const char* pass) { (void)ssid; (void)pass; return true; }
+  IPAddress softAPIP() { return IPAddress(192, 168, 4, 1); }
+};
+extern ESP8266WiFiClass WiFi;
+
+// ===== LittleFS（ESP8266 core 的 FS.h）=====
+// 檔案放在 sim 的記憶體裡（sim::flashFile）；寫過的檔 close() 才算一次 flash commit（花 flashCommitUs）
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class File {
+ public:
+  File() {}
+  File(const char* path, bool writable, size_t pos) : path_(path), open_(true), writable_(writable), pos_(pos) {}
+  operator bool() const { return open_; }
+  size_t write(const uint8_t* data, size_t length);
+  size_t read(uint8_t* data, size_t length);
+  int available();
+  size_t size();
+  size_t position() const { return pos_; }
+  bool seek(uint32_t pos, SeekMode mode = SeekSet);
+  void close();
+ private:
+  std::string path_;
+  bool open_ = false;
+  bool writable_ = false;
+  bool dirty_ = false;
+  size_t pos_ = 0;
+};
+
+class FS {
+ public:
+  bool begin() { return true; }
+  // mode："r" / "w"（清空）/ "a"（接在後面）
+  File open(const char* path, const char* mode);
+  bool exists(const char* path) { return sim::flashFile(path) != nullptr; }
+  bool remove(const char* path);
+};
+extern FS LittleFS;
+
+// ===== Ticker =====
+class Ticker {
+ public:
+  ~Ticker() { detach(); }
+  void attach_ms(uint32_t ms, void (*cb)()) { detach(); id_ = sim::addTicker(ms * 1000, cb); }
+  void detach() { if (id_ >= 0) sim::removeTicker(id_); id_ = -1; }
+ private:
+  int id_ = -1;
+};
+
+// ===== WebSockets (links2004) =====
+// ESP8266 上 library 的預設值
+#define WEBSOCKETS_SERVER_CLIENT_MAX (5)
+
+enum WStype_t {
+  WStype_ERROR,
+  WStype_DISCONNECTED,
+  WStype_CONNECTED,
+  WStype_TEXT,
+  WStype_BIN,
+  WStype_PING,
+  WStype_PONG
+};
+
+class WebSocketsServer {
+ public:
+  typedef void (*WebSocketServerEvent)(uint8_t num, WStype_t type, uint8_t* payload, size_t length);
+
+  explicit WebSocketsServer(uint16_t port) { (void)port; }
+  void begin();
+  void loop();
+  void onEvent(WebSocketServerEvent cb) { cb_ = cb; }
+
+  bool sendTXT(uint8_t num, const char* payload, size_t length = 0);
+  bool sendTXT(uint8_t num, const String& payload) { return sendTXT(num, payload.c_str(), payload.length()); }
+  bool broadcastTXT(const char* payload, size_t length = 0);
+  bool broadcastTXT(const String& payload) { return broadcastTXT(payload.c_str(), payload.length()); }
+  bool sendBIN(uint8_t num, const uint8_t* payload, size_t length);
+  IPAddress remoteIP(uint8_t num) { return IPAddress(192, 168, 137, (uint8_t)(100 + num)); }
+
+ private:
+  WebSocketServerEvent cb_ = nullptr;
+};
+
+// ===== PN532 (Seeed) + NDEF (don) =====
+class SPIClass {};
+extern SPIClass SPI;
+
+class PN532Interface {};
+
+class PN532_SPI : public PN532Interface {
+ public:
+  PN532_SPI(SPIClass& spi, uint8_t ss) { (void)spi; (void)ss; }
+};
+
+class PN532 {
+ public:
+  explicit PN532(PN532Interface& i) { (void)i; }
+  bool SAMConfig();
+};
+
+// 跟 don 的 NDEF library 一樣：message 存的是編好的 bytes，getRecord / encode 都從這裡拆
+// addUriRecord 寫 TNF well-known "U"，payload = identifier code 0x00 + 完整 URI（不縮寫前綴）
+class NdefRecord {
+ public:
+  NdefRecord() {}
+  NdefRecord(uint8_t tnf, const std::string& type, const std::string& payload)
+      : tnf_(tnf), type_(type), payload_(payload) {}
+  uint8_t getTnf() { return tnf_; }
+  unsigned int getTypeLength() { return (unsigned int)type_.size(); }
+  void getType(byte* data) { memcpy(data, type_.data(), type_.size()); }
+  unsigned int getPayloadLength() { return (unsigned int)payload_.size(); }
+  void getPayload(byte* data) { memcpy(data, payload_.data(), payload_.size()); }
+ private:
+  uint8_t tnf_ = 0;
+  std::string type_;
+  std::string payload_;
+};
+
+class NdefMessage {
+ public:
+  NdefMessage() {}
+  NdefMessage(const byte* data, int numBytes) : bytes_((const char*)data, numBytes) {}
+  void addUriRecord(const char* uri);
+  unsigned int getRecordCount();
+  NdefRecord getRecord(int index);
+  int getEncodedSize() { return (int)bytes_.size(); }
+  void encode(byte* data) { memcpy(data, bytes_.data(), bytes_.size()); }
+  const std::string& bytes() const { return bytes_; }
+ private:
+  std::string bytes_;
+};
+
+class NfcTag {
+ public:
+  NfcTag() : uidLength_(0) {}
+  NfcTag(const uint8_t* uid, unsigned int len) : uidLength_(len) { memcpy(uid_, uid, len); }
+  NfcTag(const uint8_t* uid, unsigned int len, const NdefMessage& message)
+      : uidLength_(len), message_(message), hasMessage_(true) { memcpy(uid_, uid, len); }
+  unsigned int getUidLength() { return uidLength_; }
+  void getUid(byte* uid, unsigned int len) { memcpy(uid, uid_, len < uidLength_ ? len : uidLength_); }
+  bool hasNdefMessage() { return hasMessage_; }
+  NdefMessage getNdefMessage() { return message_; }
+ private:
+  uint8_t uid_[7];
+  unsigned int uidLength_;
+  NdefMessage message_;
+  bool hasMessage_ = false;
+};
+
+class NfcAdapter {
+ public:
+  explicit NfcAdapter(PN532Interface& i) { (void)i; }
+  void begin(bool verbose = true);
+  bool tagPresent(unsigned long timeout = 0);
+  NfcTag read();
+  bool write(NdefMessage& message);
+ private:
+  uint8_t uid_[7];
+  uint8_t uidLength_ = 0;
+};
+
+// ===== NeoPixelBus (Makuna) =====
+struct RgbColor {
+  RgbColor(uint8_t r = 0, uint8_t g = 0, uint8_t b = 0) : R(r), G(g), B(b) {}
+  bool operator==(const RgbColor& o) const { return R == o.R && G == o.G && B == o.B; }
+  uint8_t R, G, B;
+};
+
+namespace sim { void noteLedShow(uint32_t costUs); }
+
+struct NeoGrbFeature {};
+// 每顆燈 24 bit × 1.25µs；bit-bang 期間 CPU 被整個佔住，UART1 / DMA 只花塞 FIFO / 編 DMA buffer 的時間
+// kPin = 硬體固定的腳（UART1 TX = GPIO2、I2S data = GPIO3 RX），-1 = 用建構子給的 pin
+struct NeoEsp8266BitBangWs2812xMethod {
+  static constexpr uint32_t kShowUsPerPixel = 30; static constexpr uint32_t kShowLatchUs = 50;
+  static constexpr sim::LedDriver kDriver = sim::LED_DRIVER_BITBANG; static constexpr int8_t kPin = -1;
+};
+struct NeoEsp8266Uart1Ws2812xMethod {
+  static constexpr uint32_t kShowUsPerPixel = 1; static constexpr uint32_t kShowLatchUs = 0;
+  static constexpr sim::LedDriver kDriver = sim::LED_DRIVER_UART; static constexpr int8_t kPin = 2;
+};
+struct NeoEsp8266DmaWs2812xMethod {
+  static constexpr uint32_t kShowUsPerPixel = 1; static constexpr uint32_t kShowLatchUs = 0;
+  static constexpr sim::LedDriver kDriver = sim::LED_DRIVER_I2S_DMA; static constexpr int8_t kPin = 3;
+};
+
+template <typename T_COLOR_FEATURE, typename T_METHOD>
+class NeoPixelBus {
+ public:
+  explicit NeoPixelBus(uint16_t count, uint8_t pin = 0)
+      : count_(count < 64 ? count : 64), pin_(T_METHOD::kPin >= 0 ? (uint8_t)T_METHOD::kPin : pin) {}
+  void Begin() {}
+  // 送出去的 GRB 波形交給 sim::recordLedShow() 錄下來（ws2812_recorder.cpp）
+  void Show() {
+    uint8_t grb[64 * 3];
+    for (uint16_t i = 0; i < count_; i++) {
+      grb[i * 3] = pixels_[i].G;
+      grb[i * 3 + 1] = pixels_[i].R;
+      grb[i * 3 + 2] = pixels_[i].B;
+    }
+    sim::recordLedShow(T_METHOD::kDriver, pin_, grb, count_ * 3);
+    sim::noteLedShow(count_ * T_METHOD::kShowUsPerPixel + T_METHOD::kShowLatchUs);
+  }
+  void ClearTo(RgbColor c) { for (uint16_t i = 0; i < count_; i++) pixels_[i] = c; }
+  void SetPixelColor(uint16_t i, RgbColor c) { if (i < count_) pixels_[i] = c; }
+  RgbColor GetPixelColor(uint16_t i) const { return i < count_ ? pixels_[i] : RgbColor(); }
+  uint16_t PixelCount() const { return count_; }
+ private:
+  uint16_t count_;
+  uint8_t pin_;
+  RgbColor pixels_[64];
+};
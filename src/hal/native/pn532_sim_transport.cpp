@@ -0,0 +1,420 @@
+// ===== 假 PN532：frame 層級的行為 + 時間模型 =====
+
+#include "pn532_sim_transport.h"
+
+namespace {
+
+const uint8_t kAck[6] = { 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00 };
+const uint8_t kErrorFrame[8] = { 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x7F, 0x81, 0x00 };
+const uint8_t kCmdInList = 0x4A;
+const uint8_t kCmdInDataExchange = 0x40;
+const uint8_t kCmdInCommunicateThru = 0x42;
+const uint8_t kNtagWrite = 0xA2;
+const uint8_t kNtagFastRead = 0x3A;
+const uint8_t kStatusOk = 0x00;
+const uint8_t kStatusTimeout = 0x01;   // 卡沒回（被拿走）
+const uint8_t kStatusNak = 0x14;       // PN532 把 NTAG 的 NAK 回報成 mifare authentication error
+const uint32_t kRfTimeoutUs = 5000;
+const uint8_t kCmdTgInitAsTarget = 0x8C;
+const uint8_t kCmdTgGetData = 0x86;
+const uint8_t kCmdTgSetData = 0x8E;
+const uint8_t kStatusReleased = 0x29;  // target 被 initiator 放掉（手機拿走）
+const uint8_t kIsoDepOverhead = 3;     // I-block 的 PCB + CRC
+
+// ===== 手機（Android 讀 Type 4 tag）=====
+struct PhoneWindow {
+  uint64_t enterUs;
+  uint64_t leaveUs;
+};
+std::vector<PhoneWindow> g_phones;
+sim::PhoneRead g_phoneRead;
+
+enum PhoneStep : uint8_t { STEP_SELECT_APP, STEP_SELECT_CC, STEP_READ_CC, STEP_SELECT_NDEF, STEP_READ_NLEN,
+                           STEP_READ_BODY, STEP_DONE };
+
+// 目前這次 ISO-DEP 連線（TgInitAsTarget 回應時開始）
+struct PhoneSession {
+  const PhoneWindow* window = nullptr;
+  PhoneStep step = STEP_DONE;
+  uint16_t mle = 0;
+  uint16_t fileId = 0;
+  uint16_t nlen = 0;
+  uint64_t nextApduUs = 0;   // 下一個 C-APDU 準備好的時間
+} g_session;
+
+// us 之後（含）手機在場上、ISO-DEP 建得起來的最早時間；沒有回 nullptr
+const PhoneWindow* nextPhone(uint64_t us, uint64_t* activateUs) {
+  const PhoneWindow* best = nullptr;
+  for (const PhoneWindow& w : g_phones) {
+    uint64_t at = (us > w.enterUs ? us : w.enterUs) + sim::timing().phoneActivateUs;
+    if (at >= w.leaveUs) continue;
+    if (!best || at < *activateUs) {
+      best = &w;
+      *activateUs = at;
+    }
+  }
+  return best;
+}
+
+std::string hex(const uint8_t* data, size_t length) {
+  static const char digits[] = "0123456789ABCDEF";
+  std::string out;
+  for (size_t i = 0; i < length; i++) {
+    out += digits[data[i] >> 4];
+    out += digits[data[i] & 0x0F];
+  }
+  return out;
+}
+
+// 這一步要送的 C-APDU
+uint8_t phoneApdu(uint8_t* out) {
+  static const uint8_t kSelectApp[] = { 0x00, 0xA4, 0x04, 0x00, 0x07, 0xD2, 0x76, 0x00, 0x00, 0x85, 0x01, 0x01, 0x00 };
+  uint8_t n = 0;
+  switch (g_session.step) {
+    case STEP_SELECT_APP:
+      memcpy(out, kSelectApp, sizeof(kSelectApp));
+      return sizeof(kSelectApp);
+    case STEP_SELECT_CC:
+    case STEP_SELECT_NDEF: {
+      uint16_t id = g_session.step == STEP_SELECT_CC ? 0xE103 : g_session.fileId;
+      const uint8_t select[] = { 0x00, 0xA4, 0x00, 0x0C, 0x02, (uint8_t)(id >> 8), (uint8_t)id };
+      memcpy(out, select, sizeof(select));
+      return sizeof(select);
+    }
+    case STEP_READ_CC:
+    case STEP_READ_NLEN:
+    case STEP_READ_BODY: {
+      uint16_t offset = 0;
+      uint16_t le = g_session.step == STEP_READ_CC ? 15 : 2;
+      if (g_session.step == STEP_READ_BODY) {
+        offset = (uint16_t)(2 + g_phoneRead.ndef.size());
+        le = g_session.nlen - (uint16_t)g_phoneRead.ndef.size();
+        if (le > g_session.mle) le = g_session.mle;
+      }
+      out[n++] = 0x00;
+      out[n++] = 0xB0;
+      out[n++] = (uint8_t)(offset >> 8);
+      out[n++] = (uint8_t)offset;
+      out[n++] = (uint8_t)le;
+      return n;
+    }
+    default:
+      return 0;
+  }
+}
+
+// 手機收到 R-APDU：SW 不是 90 00 就放棄
+void phoneResponse(const uint8_t* r, uint8_t length, uint64_t atUs) {
+  g_phoneRead.transcript.push_back("< " + hex(r, length));
+  if (length < 2 || r[length - 2] != 0x90 || r[length - 1] != 0x00) {
+    g_session.step = STEP_DONE;
+    return;
+  }
+  const uint8_t* data = r;
+  uint8_t dataLength = length - 2;
+  g_session.nextApduUs = atUs + sim::timing().phoneTurnaroundUs;
+  switch (g_session.step) {
+    case STEP_SELECT_APP: g_session.step = STEP_SELECT_CC; break;
+    case STEP_SELECT_CC: g_session.step = STEP_READ_CC; break;
+    case STEP_READ_CC:
+      if (dataLength < 15 || data[7] != 0x04) {
+        g_session.step = STEP_DONE;
+        break;
+      }
+      g_session.mle = (uint16_t)(data[3] << 8 | data[4]);
+      g_session.fileId = (uint16_t)(data[9] << 8 | data[10]);
+      g_session.step = g_session.mle ? STEP_SELECT_NDEF : STEP_DONE;
+      break;
+    case STEP_SELECT_NDEF: g_session.step = STEP_READ_NLEN; break;
+    case STEP_READ_NLEN:
+      if (dataLength != 2) {
+        g_session.step = STEP_DONE;
+        break;
+      }
+      g_session.nlen = (uint16_t)(data[0] << 8 | data[1]);
+      g_session.step = g_session.nlen ? STEP_READ_BODY : STEP_DONE;
+      break;
+    case STEP_READ_BODY:
+      if (dataLength == 0) {
+        g_session.step = STEP_DONE;
+        break;
+      }
+      g_phoneRead.ndef.append((const char*)data, dataLength);
+      if (g_phoneRead.ndef.size() >= g_session.nlen) {
+        g_phoneRead.completeUs = atUs;
+        g_session.step = STEP_DONE;
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+}  // namespace
+
+namespace sim {
+
+void schedulePhone(uint64_t enterUs, uint64_t leaveUs) { g_phones.push_back({enterUs, leaveUs}); }
+void clearPhones() {
+  g_phones.clear();
+  g_session = PhoneSession();
+}
+const PhoneRead& lastPhoneRead() { return g_phoneRead; }
+
+}  // namespace sim
+
+// 回應什麼時候 ready；InList 沒卡 = 永遠（PN532 一直重試到 host 中止）
+uint64_t Pn532SpiTransport::responseAt(const sim::TagWindow** tags, uint8_t* count) const {
+  *count = 0;
+  if (command_ == kCmdInDataExchange || command_ == kCmdInCommunicateThru || command_ == kCmdTgGetData ||
+      command_ == kCmdTgSetData) {
+    return replyAt_;
+  }
+  if (command_ == kCmdTgInitAsTarget) {
+    // 等手機靠近（沒有就一直等，跟 InList 一樣由 host 中止）
+    uint64_t at = 0;
+    return nextPhone(commandAt_, &at) ? at : UINT64_MAX;
+  }
+  if (command_ != kCmdInList) return ackAt_ + 500;
+  // 指令到的時候場上有卡就從那時開始選，沒有就等第一張放上來
+  uint64_t at = commandAt_;
+  if (!sim::tagAt(at)) {
+    const sim::TagWindow* w = sim::nextTagBetween(commandAt_, UINT64_MAX);
+    if (!w) return UINT64_MAX;
+    at = w->enterUs;
+  }
+  *count = (uint8_t)sim::tagsAt(at, tags, maxTargets_);
+  uint64_t us = (uint64_t)*count * sim::timing().inListUs;
+  if (*count < maxTargets_) us += sim::timing().inListEmptyPollUs;
+  return at + us;
+}
+
+bool Pn532SpiTransport::ready() {
+  // 沒接 IRQ 就是一次 SPI status read；有接也算一次 GPIO 讀取，原地 poll 的迴圈才會往前走
+  sim::advanceMicros(irq_ < 0 ? 2 * sim::timing().spiByteUs : 1);
+  uint64_t now = sim::nowMicros();
+  if (phase_ == PHASE_ACK) return now >= ackAt_;
+  if (phase_ == PHASE_RESPONSE) {
+    const sim::TagWindow* tags[Pn532Async::kMaxTargets];
+    uint8_t count;
+    return now >= responseAt(tags, &count);
+  }
+  return false;
+}
+
+void Pn532SpiTransport::writeFrame(const uint8_t* frame, uint8_t length) {
+  sim::advanceMicros((uint64_t)(1 + length) * sim::timing().spiByteUs);
+
+  if (length == sizeof(kAck) && memcmp(frame, kAck, sizeof(kAck)) == 0) {
+    if (phase_ != PHASE_IDLE && command_ == kCmdInList) sim::nfcCounters().inListTimeouts++;
+    phase_ = PHASE_IDLE;
+    return;
+  }
+
+  // 00 00 FF LEN LCS D4 CMD ... DCS 00；任何一項不對，PN532 就當沒收到
+  if (length < 9 || frame[0] != 0x00 || frame[1] != 0x00 || frame[2] != 0xFF) return;
+  uint8_t len = frame[3];
+  if ((uint8_t)(len + frame[4]) != 0 || len < 2 || 5 + len + 2 > length || frame[5] != 0xD4) return;
+  uint8_t sum = 0;
+  for (uint8_t i = 0; i <= len; i++) sum += frame[5 + i];
+  if (sum != 0) return;
+
+  fault_ = sim::takePn532Fault();
+  if (fault_ == sim::PN532_FAULT_NO_ACK) {
+    phase_ = PHASE_IDLE;
+    return;
+  }
+  command_ = frame[6];
+  commandAt_ = sim::nowMicros();
+  ackAt_ = commandAt_ + sim::timing().pn532AckUs;
+  phase_ = PHASE_ACK;
+  if (command_ == kCmdInList) {
+    sim::nfcCounters().inList++;
+    maxTargets_ = len >= 3 && frame[7] >= 2 ? 2 : 1;
+    targetLength_ = 0;   // 新的 InList 把之前選到的卡放掉
+  } else if (command_ == kCmdInDataExchange || command_ == kCmdInCommunicateThru) {
+    exchange(frame + 7, len - 2);
+  } else if (command_ == kCmdTgInitAsTarget) {
+    targetLength_ = 0;   // 切成 target，之前選到的卡放掉
+  } else if (command_ == kCmdTgGetData) {
+    targetGetData();
+  } else if (command_ == kCmdTgSetData) {
+    targetSetData(frame + 7, len - 2);
+  }
+}
+
+void Pn532SpiTransport::targetGetData() {
+  using namespace sim;
+  replyLength_ = 0;
+  const PhoneWindow* w = g_session.window;
+  if (!w || g_session.step == STEP_DONE || commandAt_ >= w->leaveUs) {
+    // 讀完 / 放棄的手機不再送東西：等它拿走
+    reply_[replyLength_++] = kStatusReleased;
+    replyAt_ = w && w->leaveUs > ackAt_ ? w->leaveUs : ackAt_;
+    return;
+  }
+  uint8_t apdu[16];
+  uint8_t n = phoneApdu(apdu);
+  uint64_t at = (g_session.nextApduUs > ackAt_ ? g_session.nextApduUs : ackAt_) +
+                (uint64_t)(n + kIsoDepOverhead) * timing().rfByteUs;
+  if (at >= w->leaveUs) {
+    reply_[replyLength_++] = kStatusReleased;
+    replyAt_ = w->leaveUs;
+    return;
+  }
+  g_phoneRead.transcript.push_back("> " + hex(apdu, n));
+  reply_[replyLength_++] = kStatusOk;
+  memcpy(reply_ + replyLength_, apdu, n);
+  replyLength_ += n;
+  replyAt_ = at;
+}
+
+void Pn532SpiTransport::targetSetData(const uint8_t* params, uint8_t length) {
+  using namespace sim;
+  replyLength_ = 0;
+  const PhoneWindow* w = g_session.window;
+  uint64_t at = ackAt_ + (uint64_t)(length + kIsoDepOverhead) * timing().rfByteUs;
+  if (!w || at >= w->leaveUs) {
+    reply_[replyLength_++] = kStatusTimeout;
+    replyAt_ = ackAt_ + kRfTimeoutUs;
+    return;
+  }
+  phoneResponse(params, length, at);
+  reply_[replyLength_++] = kStatusOk;
+  replyAt_ = at;
+}
+
+void Pn532SpiTransport::exchange(const uint8_t* params, uint8_t length) {
+  using namespace sim;
+  // InDataExchange 多一個 Tg byte
+  if (command_ == kCmdInDataExchange) {
+    params++;
+    length = length ? length - 1 : 0;
+  }
+  replyLength_ = 0;
+  const TagWindow* tag = tagAt(commandAt_);
+  bool present = targetLength_ && tag && tag->uidLength == targetLength_ &&
+                 memcmp(tag->uid, target_, targetLength_) == 0;
+  uint64_t rf = (uint64_t)(length + 2) * timing().rfByteUs;   // 指令 + CRC
+  if (!present || length < 1) {
+    reply_[replyLength_++] = kStatusTimeout;
+    replyAt_ = ackAt_ + kRfTimeoutUs;
+    return;
+  }
+
+  uint8_t* pages = tagPages(target_, targetLength_);
+  if (params[0] == kNtagWrite && length == 6 && params[1] >= 4 && params[1] < kTagPages) {
+    nfcCounters().ntagPageWrites++;
+    NdefWriteFault fault = takeNdefWriteFault();
+    replyAt_ = ackAt_ + rf + timing().ntagProgramUs;
+    if (fault == NDEF_WRITE_FAIL) {
+      reply_[replyLength_++] = kStatusNak;
+      return;
+    }
+    memcpy(pages + params[1] * 4, params + 2, 4);
+    if (fault == NDEF_WRITE_CORRUPT) pages[params[1] * 4 + 3] ^= 0x01;
+    reply_[replyLength_++] = kStatusOk;
+    return;
+  }
+  if (params[0] == kNtagFastRead && length == 3 && params[1] <= params[2] && params[2] < kTagPages &&
+      (params[2] - params[1] + 1) * 4 + 1 <= (int)sizeof(reply_) - 2) {
+    nfcCounters().ntagFastReads++;
+    uint8_t bytes = (uint8_t)((params[2] - params[1] + 1) * 4);
+    replyAt_ = ackAt_ + rf + (uint64_t)(bytes + 2) * timing().rfByteUs;
+    reply_[replyLength_++] = kStatusOk;
+    memcpy(reply_ + replyLength_, pages + params[1] * 4, bytes);
+    replyLength_ += bytes;
+    return;
+  }
+  // 其他指令 / 超出範圍：NTAG 回 NAK
+  replyAt_ = ackAt_ + rf + 2 * timing().rfByteUs;
+  reply_[replyLength_++] = kStatusNak;
+}
+
+uint8_t Pn532SpiTransport::buildResponse(uint8_t* out, uint8_t maxLength) {
+  if (fault_ == sim::PN532_FAULT_ERROR_FRAME) {
+    memcpy(out, kErrorFrame, sizeof(kErrorFrame));
+    return sizeof(kErrorFrame);
+  }
+
+  uint8_t data[2 + sizeof(reply_)];
+  uint8_t n = 0;
+  data[n++] = 0xD5;
+  data[n++] = (uint8_t)(command_ + 1);
+  if (command_ == kCmdInDataExchange || command_ == kCmdInCommunicateThru || command_ == kCmdTgGetData ||
+      command_ == kCmdTgSetData) {
+    memcpy(data + n, reply_, replyLength_);
+    n += replyLength_;
+  } else if (command_ == kCmdTgInitAsTarget) {
+    // 手機的 ISO-DEP 建好了：開始一次新的讀取
+    uint64_t at = 0;
+    const PhoneWindow* w = nextPhone(commandAt_, &at);
+    g_session = PhoneSession();
+    g_session.window = w;
+    g_session.step = STEP_SELECT_APP;
+    g_session.nextApduUs = at + sim::timing().phoneTurnaroundUs;
+    g_phoneRead = sim::PhoneRead();
+    g_phoneRead.enterUs = w->enterUs;
+    g_phoneRead.activatedUs = at;
+    data[n++] = 0x08;   // Mode：ISO 14443-4 PICC，106 kbps
+    data[n++] = 0xE0;   // 手機的第一個指令：RATS
+    data[n++] = 0x80;
+  } else if (command_ == kCmdInList) {
+    const sim::TagWindow* tags[Pn532Async::kMaxTargets];
+    uint8_t count;
+    responseAt(tags, &count);
+    memcpy(target_, tags[0]->uid, tags[0]->uidLength);
+    targetLength_ = tags[0]->uidLength;
+    data[n++] = count;                  // NbTg
+    for (uint8_t i = 0; i < count; i++) {
+      const sim::TagWindow* tag = tags[i];
+      bool ntag = tag->uidLength == 7;
+      data[n++] = (uint8_t)(i + 1);     // Tg
+      data[n++] = 0x00;                 // SENS_RES
+      data[n++] = ntag ? 0x44 : 0x04;
+      data[n++] = ntag ? 0x00 : 0x08;   // SEL_RES：NTAG21x = 0x00，MIFARE Classic 1K = 0x08
+      data[n++] = tag->uidLength;
+      memcpy(data + n, tag->uid, tag->uidLength);
+      n += tag->uidLength;
+    }
+  }
+
+  uint8_t len = n;
+  uint8_t total = 0;
+  out[total++] = 0x00;
+  out[total++] = 0x00;
+  out[total++] = 0xFF;
+  out[total++] = len;
+  out[total++] = (uint8_t)(~len + 1);
+  uint8_t sum = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    out[total++] = data[i];
+    sum += data[i];
+  }
+  uint8_t dcs = (uint8_t)(~sum + 1);
+  if (fault_ == sim::PN532_FAULT_BAD_CHECKSUM) dcs ^= 0x5A;
+  out[total++] = dcs;
+  out[total++] = 0x00;
+  return total > maxLength ? maxLength : total;
+}
+
+uint8_t Pn532SpiTransport::readFrame(uint8_t* buffer, uint8_t maxLength) {
+  uint8_t n = 0;
+  uint64_t now = sim::nowMicros();
+  const sim::TagWindow* tags[Pn532Async::kMaxTargets];
+  uint8_t count;
+  if (phase_ == PHASE_ACK && now >= ackAt_) {
+    n = sizeof(kAck) > maxLength ? maxLength : sizeof(kAck);
+    memcpy(buffer, kAck, n);
+    phase_ = PHASE_RESPONSE;
+  } else if (phase_ == PHASE_RESPONSE && now >= responseAt(tags, &count)) {
+    n = buildResponse(buffer, maxLength);
+    phase_ = PHASE_IDLE;
+  } else {
+    // 沒東西可讀：真的 PN532 會吐垃圾，這裡吐 0
+    n = maxLength < 5 ? maxLength : 5;
+    memset(buffer, 0, n);
+  }
+  sim::advanceMicros((uint64_t)(1 + n) * sim::timing().spiByteUs);
+  return n;
+}
@@ -0,0 +1,51 @@
+#pragma once
+// ===== 假 PN532（Pn532Async 的 native 傳輸層）=====
+// 跟實機的 Pn532SpiTransport 同名同建構子，但 SPI 另一端是一顆用 sim.h 卡片腳本驅動的 PN532：
+//   - 解析 host 寫來的 frame（checksum 錯就當沒收到，跟真的一樣不回 ACK）
+//   - pn532AckUs 後 ACK ready；InListPassiveTarget 在卡放上後回應（沒卡就一直等）：
+//     每選到一張 inListUs，MaxTg = 2 卻只有一張時再加 inListEmptyPollUs
+//   - InList 選到的第一張卡是 Tg 1：InDataExchange 的 NTAG WRITE、InCommunicateThru 的 FAST_READ
+//     直接讀寫 sim::tagPages()，時間依 rfByteUs / ntagProgramUs 算；卡拿走了就回 RF timeout 錯誤
+//   - TgInitAsTarget / TgGetData / TgSetData：PN532 當 Type 4 tag，另一端是 sim::schedulePhone() 排的 Android 手機
+//   - host 寫 ACK frame = 中止目前指令
+//   - SPI 傳輸依 spiByteUs 推進虛擬時間
+//   - sim::pn532FailNext() 可以讓下一個指令掉 ACK / 回壞 frame
+
+#include "native_hal.h"
+#include "../../pn532_async.h"
+
+class Pn532SpiTransport : public Pn532Transport {
+ public:
+  Pn532SpiTransport(SPIClass& spi, uint8_t ss, int8_t irqPin = -1) : irq_(irqPin) { (void)spi; (void)ss; }
+
+  void begin() override {}
+  bool ready() override;
+  void writeFrame(const uint8_t* frame, uint8_t length) override;
+  uint8_t readFrame(uint8_t* buffer, uint8_t maxLength) override;
+
+ private:
+  enum Phase : uint8_t { PHASE_IDLE, PHASE_ACK, PHASE_RESPONSE };
+
+  // InList 的回應時間 + 選到的卡（最多 maxTargets_ 張）
+  uint64_t responseAt(const sim::TagWindow** tags, uint8_t* count) const;
+  uint8_t buildResponse(uint8_t* out, uint8_t maxLength);
+  // NTAG 指令：在收到指令時就執行完，回應 data 存在 reply_，replyAt_ 之後 ready
+  void exchange(const uint8_t* params, uint8_t length);
+  // target 模式：TgGetData = 手機的下一個 C-APDU，TgSetData = 把 R-APDU 交給手機；跟 exchange() 一樣先算好 reply_
+  void targetGetData();
+  void targetSetData(const uint8_t* params, uint8_t length);
+
+  int8_t irq_;
+  Phase phase_ = PHASE_IDLE;
+  uint8_t command_ = 0;
+  uint8_t maxTargets_ = 1;     // InList 的 MaxTg
+  uint64_t commandAt_ = 0;
+  uint64_t ackAt_ = 0;
+  sim::Pn532Fault fault_ = sim::PN532_FAULT_NONE;
+
+  uint8_t target_[7];          // 最近一次 InList 選到的卡
+  uint8_t targetLength_ = 0;   // 0 = 沒有
+  uint8_t reply_[160];
+  uint8_t replyLength_ = 0;
+  uint64_t replyAt_ = 0;
+};
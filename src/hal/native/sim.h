@@ -0,0 +1,211 @@
+#pragma once
+// ===== native 模擬環境控制介面 =====
+// 給 sim_main.cpp（benchmark / 情境腳本）用來：
+//   - 推進虛擬時鐘（millis / micros / delay / Ticker 全部跟著它走）
+//   - 排程「哪張卡在什麼時間放上 / 拿走」給假的 PN532
+//   - 模擬 WebSocket 客戶端連線、送訊息，並收集 firmware 送出的每個 frame
+//   - 注入 Serial 輸入
+// firmware 本身（main.cpp）完全不知道這個檔案存在
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+namespace sim {
+
+// ===== 虛擬時鐘 =====
+uint64_t nowMicros();
+// 推進時間；途中到期的 Ticker 會在各自的時間點被呼叫
+// 在 Ticker callback 裡面呼叫時只會單純加時間（模擬 callback 佔掉的 CPU）
+void advanceMicros(uint64_t us);
+void advanceTo(uint64_t us);
+
+// Ticker 註冊表（假的 Ticker 用）
+int addTicker(uint32_t periodUs, void (*cb)());
+void removeTicker(int id);
+
+// ===== 硬體時間模型 =====
+// 數字是依 PN532 datasheet / library 行為估的，可以從 sim_main 的參數覆蓋
+struct Timing {
+  uint32_t loopOverheadUs = 100;       // 每輪 loop() 外框架的 yield / WiFi stack 開銷
+  uint32_t inListUs = 4000;            // InListPassiveTarget 偵測到卡 + SPI 來回（每選到一張）
+  uint32_t inListEmptyPollUs = 1000;   // MaxTg = 2 但只有一張卡：PN532 多做一輪 REQA 等不到第二張
+  uint32_t inListTimeoutMs = 1000;     // 沒卡時 readPassiveTargetID 的預設 timeout
+  uint32_t ndefReadUs = 18000;         // nfc.read()：判斷卡種 + 逐頁讀 NDEF
+  uint32_t ndefWriteUs = 45000;        // nfc.write()：逐頁寫入
+  uint32_t wsSendUs = 600;             // 每個 client 一次 TCP send
+  uint32_t wifiConnectMs = 3500;       // WiFi.begin() 完整掃描到拿到 IP
+  uint32_t wifiJoinMs = 300;           // 指定 channel + BSSID：不用掃描，auth + assoc
+  uint32_t wifiDhcpMs = 1000;          // 連上 AP 之後等 DHCP lease（WiFi.config 固定 IP 就省掉）
+  uint32_t serialUsPerChar = 87;       // 115200 baud，FIFO 滿了才會阻塞
+  uint32_t spiByteUs = 5;              // PN532 SPI 2MHz，一個 byte 含 CS / 函數開銷
+  uint32_t pn532AckUs = 500;           // 指令寫完到 ACK ready
+  uint32_t rfByteUs = 85;              // 106 kbps Type A：8 bit + parity ≈ 85µs / byte（NTAG 指令 + 回應）
+  uint32_t ntagProgramUs = 4100;       // NTAG21x 一頁 EEPROM 燒寫（datasheet t_prog）
+  uint32_t phoneActivateUs = 15000;    // 手機進場到 ISO-DEP 建好（Android 的 polling + anticollision + RATS）
+  uint32_t phoneTurnaroundUs = 2500;   // Android 收到 R-APDU 到送出下一個 C-APDU
+  uint32_t flashCommitUs = 3000;       // LittleFS 寫過的檔 close()：program 幾頁 + metadata commit
+};
+Timing& timing();
+
+// ===== PN532：卡片腳本 =====
+struct TagWindow {
+  uint8_t uid[7];
+  uint8_t uidLength;
+  uint64_t enterUs;
+  uint64_t leaveUs;
+};
+void scheduleTag(const uint8_t* uid, uint8_t uidLength, uint64_t enterUs, uint64_t leaveUs);
+void clearTags();
+const TagWindow* tagAt(uint64_t us);
+// us 時在場上的卡（依排程順序），最多 max 張；回傳張數
+size_t tagsAt(uint64_t us, const TagWindow** out, size_t max);
+// [fromUs, untilUs) 之間第一張放上來的卡（模擬 InListPassiveTarget 阻塞等卡）
+const TagWindow* nextTagBetween(uint64_t fromUs, uint64_t untilUs);
+
+struct NfcCounters {
+  uint32_t inList = 0;
+  uint32_t inListTimeouts = 0;
+  uint32_t ndefReads = 0;
+  uint32_t ndefWrites = 0;
+  uint32_t ntagPageWrites = 0;   // 假 PN532 收到的 NTAG WRITE（一頁一次）
+  uint32_t ntagFastReads = 0;
+};
+NfcCounters& nfcCounters();
+
+// 卡片記憶體：依 UID 記著一張 NTAG213 的 45 頁（page 3 = CC，page 4 起是 NDEF 區）
+// 第一次碰到的卡是出廠狀態：CC = E1 10 12 00、page 4 = 空的 NDEF TLV
+// 假 PN532 的 NTAG WRITE / FAST_READ 跟 NfcAdapter::read / write 都讀寫這塊
+const uint8_t kTagPages = 45;
+uint8_t* tagPages(const uint8_t* uid, uint8_t uidLength);   // 4 × kTagPages bytes
+// NDEF message（沒有外框）包成 TLV 寫進 page 4 起 / 讀回來；放不下或不是 NDEF TLV 回 false
+bool setTagNdef(const uint8_t* uid, uint8_t uidLength, const std::string& message);
+bool tagNdef(const uint8_t* uid, uint8_t uidLength, std::string* message);
+// 第一筆 record 是 URI 的話，把前綴碼展開成完整網址
+bool tagUri(const uint8_t* uid, uint8_t uidLength, std::string* uri);
+void clearTagMemory();
+
+// 寫卡故障注入：只影響下一次寫入（nfc.write()，或假 PN532 收到的下一個 NTAG WRITE）
+enum NdefWriteFault : uint8_t {
+  NDEF_WRITE_OK,
+  NDEF_WRITE_FAIL,      // write() 回 false / WRITE 被 NAK
+  NDEF_WRITE_CORRUPT    // 回成功，但卡上的內容跟寫的不一樣（讀回驗證才抓得到）
+};
+void ndefFailNextWrite(NdefWriteFault fault);
+NdefWriteFault takeNdefWriteFault();
+
+// Pn532Async 用的假 PN532（pn532_sim_transport.h）故障注入：只影響下一個指令
+enum Pn532Fault : uint8_t {
+  PN532_FAULT_NONE,
+  PN532_FAULT_NO_ACK,         // 指令被吃掉，連 ACK 都沒有
+  PN532_FAULT_BAD_CHECKSUM,   // 回應的 DCS 錯
+  PN532_FAULT_ERROR_FRAME     // 回 application error frame
+};
+void pn532FailNext(Pn532Fault fault);
+Pn532Fault takePn532Fault();
+
+// ===== PN532 target 模式：觀眾的 Android 手機（Type 4 tag 模擬，見 type4_emulator.h）=====
+// 手機在 [enterUs, leaveUs) 靠近：假 PN532 的 TgInitAsTarget 在手機靠近 + phoneActivateUs 之後回來
+// （REQA / anticollision / RATS-ATS 由 PN532 自己回）。之後手機照 Android 讀 Type 4 tag 的流程送 C-APDU：
+//   SELECT NDEF AID → SELECT CC → READ CC → SELECT NDEF file → READ NLEN → 依 CC 的 MLe 分段讀完 message
+// 收到 R-APDU 之後 phoneTurnaroundUs 再送下一個；讀完或 SW 不是 90 00 就不再送，拿走時 TgGetData 回 0x29（released）
+struct PhoneRead {
+  uint64_t enterUs = 0;
+  uint64_t activatedUs = 0;
+  uint64_t completeUs = 0;               // 0 = 沒讀完
+  std::string ndef;                      // 讀到的 NDEF message（不含 NLEN）
+  std::vector<std::string> transcript;   // "> 00A40400..." / "< 9000"（十六進位大寫）
+};
+void schedulePhone(uint64_t enterUs, uint64_t leaveUs);
+void clearPhones();
+// 最近一次 ISO-DEP 建好的那支手機讀到什麼
+const PhoneRead& lastPhoneRead();
+
+// ===== WebSocket =====
+// 這些事件會在 firmware 下一次呼叫 webSocket.loop() 時送進 onEvent callback
+// url 是 client 連線時要求的路徑，firmware 在 WStype_CONNECTED 的 payload 收到（例如 "/?proto=bin"）
+void wsConnect(uint8_t num, const char* url = "/");
+void wsDisconnect(uint8_t num);
+void wsSendText(uint8_t num, const char* text);
+void wsSendBinary(uint8_t num, const uint8_t* data, size_t length);
+
+struct WsFrame {
+  uint64_t atUs;
+  int num;            // -1 = broadcast
+  std::string text;   // binary frame 也放這裡（raw bytes）
+  bool binary;
+};
+std::vector<WsFrame>& wsOutbox();
+
+// ===== Serial =====
+void serialInput(const char* text);
+void serialInput(const char* bytes, size_t length);   // 可以帶 '\0'（msg_harness 的 fuzz 用）
+void setSerialEcho(bool echo);   // true = firmware 的 Serial 輸出印到 stdout
+// firmware 印過的所有東西（clear() 之後重新累積）
+std::string& serialOutput();
+
+// ===== heap =====
+// firmware 在實機上會 malloc 幾次（照 ESP8266 core 的規則記：String 超過 SSO / 長大、
+// Serial.printf 超過 64 bytes 的暫存）；模擬器自己的 std::vector / std::string 不算
+uint32_t heapAllocations();
+void noteHeapAlloc();
+
+// ===== flash（LittleFS）=====
+// 假的 LittleFS 把檔案放在記憶體裡：firmware 重新 setup() 也還在（跟真的 flash 一樣），flashErase() 才清掉
+struct FlashCounters {
+  uint32_t commits = 0;   // 寫過的檔 close() 幾次 = 真的動到 flash 幾次
+  uint32_t bytes = 0;
+};
+FlashCounters& flashCounters();
+// 檔案內容（selftest 拿來弄壞 / 截斷記錄）；沒有這個檔回 nullptr
+std::string* flashFile(const char* path);
+void flashErase();
+
+// ===== WiFi / RTC =====
+// 假的 AP：WiFi.begin 指定的 channel / BSSID 跟它不一樣 = 直連失敗（WL_NO_SSID_AVAIL）
+struct WifiAp {
+  uint8_t bssid[6] = {0x2C, 0x3A, 0xE8, 0x41, 0x7B, 0x10};
+  int32_t channel = 6;
+};
+WifiAp& wifiAp();
+void wifiDrop();   // AP 那邊斷線（status 變 WL_CONNECTION_LOST，要重新 begin）
+struct WifiCounters {
+  uint32_t scans = 0;     // 完整掃描的 begin
+  uint32_t direct = 0;    // 指定 channel + BSSID 的 begin
+  uint32_t staticIp = 0;  // 用 WiFi.config 固定 IP 連上的次數
+};
+WifiCounters& wifiCounters();
+// RTC user memory（512 bytes）：reset / 當機還在，斷電才清掉
+void rtcErase();
+
+// ===== LED =====
+uint32_t ledShowCount();
+
+// WS2812 波形錄製（ws2812_recorder.cpp）：假 NeoPixelBus 每次 Show() 都依 method 把 GRB bytes
+// 編成實際會出現在 data pin 上的波形（一個 bit = 一段 high + 一段 low），每支 pin 留最後一幀
+enum LedDriver : uint8_t {
+  LED_DRIVER_BITBANG,   // CPU 數 cycle 拉 GPIO：800kHz，T0H 400 / T1H 800ns，會被 NMI 拉長
+  LED_DRIVER_UART,      // UART 3.2Mbaud 6N1 反相，一個 byte 兩個 bit：0 = 1000、1 = 1110（312.5ns 一格）
+  LED_DRIVER_I2S_DMA    // I2S 3.2MHz，DMA 從 buffer 直接送，一個 bit 4 格，形狀跟 UART 一樣
+};
+struct LedBit {
+  uint32_t highNs;
+  uint32_t lowNs;   // 最後一個 bit 的 low 含 reset（latch）
+};
+void recordLedShow(LedDriver driver, uint8_t pin, const uint8_t* bytes, size_t length);
+const std::vector<LedBit>& ledWaveform(uint8_t pin);
+// 下一次 bit-bang Show() 的第 bit 個 bit 送到一半被 NMI 佔走 stallNs（high 被拉長）；UART / DMA 不受影響
+void ledInjectNmi(uint32_t bit, uint32_t stallNs);
+
+// WS2812B 時序檢查 + 解碼回 bytes；第一個不合規的 bit 放在 badBit / reason
+struct Ws2812Report {
+  bool ok = false;
+  std::vector<uint8_t> bytes;
+  size_t badBit = SIZE_MAX;
+  const char* reason = "";
+  uint32_t maxT0H = 0, minT1H = UINT32_MAX, maxLowNs = 0, resetNs = 0;
+};
+Ws2812Report verifyWs2812(const std::vector<LedBit>& wave);
+
+}  // namespace sim
@@ -0,0 +1,104 @@
+// ===== WS2812 波形錄製 + 時序檢查 =====
+// 假 NeoPixelBus 的 Show() 把要送的 GRB bytes 交給 recordLedShow()，這裡依驅動方式換算成
+// data pin 上真正的 high / low 長度；verifyWs2812() 再用 WS2812B datasheet 的容許範圍解回 bytes。
+// 用來確認「換驅動方式之後送出去的還是同一幀」，以及 bit-bang 被 NMI 打斷時會壞在哪裡
+
+#include "sim.h"
+
+#include <map>
+
+namespace sim {
+
+namespace {
+
+// bit-bang（NeoPixelBus 的 800kHz 時序）
+const uint32_t kBitBangT0H = 400, kBitBangT0L = 850;
+const uint32_t kBitBangT1H = 800, kBitBangT1L = 450;
+const uint32_t kBitBangResetNs = 50000;
+// UART / I2S：3.2MHz 一格 312.5ns，一個 bit 四格
+const uint32_t kSlot1Ns = 313, kSlot3Ns = 937;
+const uint32_t kHardwareResetNs = 300000;
+
+// WS2812B 容許範圍（datasheet ±150ns，再放寬到實際燈珠量得到的邊界）
+const uint32_t kT0HMin = 200, kT0HMax = 500;
+const uint32_t kT1HMin = 550, kT1HMax = 1200;
+const uint32_t kLowMin = 200;
+const uint32_t kLowMax = 5000;     // 超過就被燈珠當成 reset，後面的 bit 跑到下一幀
+const uint32_t kResetMin = 50000;
+
+std::map<uint8_t, std::vector<LedBit>> g_waves;
+uint32_t g_nmiBit = UINT32_MAX;
+uint32_t g_nmiStallNs = 0;
+
+}  // namespace
+
+void recordLedShow(LedDriver driver, uint8_t pin, const uint8_t* bytes, size_t length) {
+  std::vector<LedBit>& wave = g_waves[pin];
+  wave.clear();
+  for (size_t i = 0; i < length * 8; i++) {
+    bool one = bytes[i / 8] & (0x80 >> (i % 8));
+    LedBit bit;
+    if (driver == LED_DRIVER_BITBANG) {
+      bit = one ? LedBit{kBitBangT1H, kBitBangT1L} : LedBit{kBitBangT0H, kBitBangT0L};
+    } else {
+      bit = one ? LedBit{kSlot3Ns, kSlot1Ns} : LedBit{kSlot1Ns, kSlot3Ns};
+    }
+    wave.push_back(bit);
+  }
+  if (driver == LED_DRIVER_BITBANG && g_nmiBit < wave.size()) wave[g_nmiBit].highNs += g_nmiStallNs;
+  if (driver == LED_DRIVER_BITBANG) g_nmiBit = UINT32_MAX;
+  if (!wave.empty()) wave.back().lowNs += driver == LED_DRIVER_BITBANG ? kBitBangResetNs : kHardwareResetNs;
+}
+
+const std::vector<LedBit>& ledWaveform(uint8_t pin) { return g_waves[pin]; }
+
+void ledInjectNmi(uint32_t bit, uint32_t stallNs) {
+  g_nmiBit = bit;
+  g_nmiStallNs = stallNs;
+}
+
+Ws2812Report verifyWs2812(const std::vector<LedBit>& wave) {
+  Ws2812Report r;
+  if (wave.empty() || wave.size() % 8) {
+    r.reason = "not a whole number of bytes";
+    return r;
+  }
+  uint8_t byte = 0;
+  for (size_t i = 0; i < wave.size(); i++) {
+    const LedBit& b = wave[i];
+    bool last = i + 1 == wave.size();
+    bool one;
+    if (b.highNs >= kT0HMin && b.highNs <= kT0HMax) {
+      one = false;
+      if (b.highNs > r.maxT0H) r.maxT0H = b.highNs;
+    } else if (b.highNs >= kT1HMin && b.highNs <= kT1HMax) {
+      one = true;
+      if (b.highNs < r.minT1H) r.minT1H = b.highNs;
+    } else if (r.badBit == SIZE_MAX) {
+      r.badBit = i;
+      r.reason = b.highNs < kT0HMin ? "high too short" : b.highNs > kT1HMax ? "high too long" : "high between T0H and T1H";
+      one = b.highNs > kT0HMax;
+    } else {
+      one = b.highNs > kT0HMax;
+    }
+    if (!last) {
+      if ((b.lowNs < kLowMin || b.lowNs > kLowMax) && r.badBit == SIZE_MAX) {
+        r.badBit = i;
+        r.reason = b.lowNs < kLowMin ? "low too short" : "low long enough to latch mid-frame";
+      }
+      if (b.lowNs > r.maxLowNs) r.maxLowNs = b.lowNs;
+    } else {
+      r.resetNs = b.lowNs;
+      if (b.lowNs < kResetMin && r.badBit == SIZE_MAX) {
+        r.badBit = i;
+        r.reason = "reset too short";
+      }
+    }
+    byte = (uint8_t)(byte << 1 | (one ? 1 : 0));
+    if (i % 8 == 7) r.bytes.push_back(byte);
+  }
+  r.ok = r.badBit == SIZE_MAX;
+  return r;
+}
+
+}  // namespace sim
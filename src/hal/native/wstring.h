@@ -0,0 +1,103 @@
+#pragma once
+// ===== Arduino String 的 native 版 =====
+// 只實作 firmware 有用到的那幾個 method，行為對齊 ESP8266 core 的 WString
+// 底層直接用 std::string，不追求省記憶體（這裡是 Linux）
+// 但照 ESP8266 core 的規則記下「實機上這裡會不會 malloc」：內容超過 SSO 的 11 個字、
+// 又比目前的 buffer 大，就記一次 sim::noteHeapAlloc()（--ws-selftest 用來檢查掃卡路徑不碰 heap）
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string>
+#include <utility>
+
+namespace sim { void noteHeapAlloc(); }
+
+#define HEX 16
+#define DEC 10
+
+class String {
+ public:
+  String() {}
+  String(const char* s) : s_(s ? s : "") { track(); }
+  String(const std::string& s) : s_(s) { track(); }
+  explicit String(char c) : s_(1, c) {}
+  String(const String& o) : s_(o.s_) { track(); }
+  String(String&& o) : s_(std::move(o.s_)), capacity_(o.capacity_) { o.capacity_ = kSsoCapacity; }
+  String& operator=(const String& o) { s_ = o.s_; track(); return *this; }
+  String& operator=(String&& o) { s_.swap(o.s_); std::swap(capacity_, o.capacity_); return *this; }
+  String(int v, unsigned char base = DEC) { fromLong(v, base); }
+  String(unsigned int v, unsigned char base = DEC) { fromULong(v, base); }
+  String(long v, unsigned char base = DEC) { fromLong(v, base); }
+  String(unsigned long v, unsigned char base = DEC) { fromULong(v, base); }
+  String(unsigned char v, unsigned char base = DEC) { fromULong(v, base); }
+
+  unsigned int length() const { return (unsigned int)s_.size(); }
+  const char* c_str() const { return s_.c_str(); }
+  char operator[](unsigned int i) const { return i < s_.size() ? s_[i] : 0; }
+  char charAt(unsigned int i) const { return (*this)[i]; }
+
+  String& operator+=(const String& o) { s_ += o.s_; track(); return *this; }
+  String& operator+=(const char* o) { if (o) s_ += o; track(); return *this; }
+  String& operator+=(char c) { s_ += c; track(); return *this; }
+  String& operator+=(int v) { return *this += String(v); }
+
+  bool operator==(const String& o) const { return s_ == o.s_; }
+  bool operator==(const char* o) const { return s_ == (o ? o : ""); }
+  bool operator!=(const String& o) const { return !(*this == o); }
+  bool operator!=(const char* o) const { return !(*this == o); }
+
+  int indexOf(char c, unsigned int from = 0) const { return wrap(s_.find(c, from)); }
+  int indexOf(const char* p, unsigned int from = 0) const { return wrap(s_.find(p, from)); }
+  int indexOf(const String& p, unsigned int from = 0) const { return wrap(s_.find(p.s_, from)); }
+
+  bool startsWith(const String& p) const { return s_.compare(0, p.s_.size(), p.s_) == 0; }
+  bool startsWith(const char* p) const { return startsWith(String(p)); }
+
+  String substring(unsigned int from) const { return substring(from, length()); }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) { unsigned int t = from; from = to; to = t; }
+    if (from >= s_.size()) return String();
+    if (to > s_.size()) to = (unsigned int)s_.size();
+    return String(s_.substr(from, to - from));
+  }
+
+  void trim() {
+    size_t b = s_.find_first_not_of(" \t\r\n");
+    if (b == std::string::npos) { s_.clear(); return; }
+    size_t e = s_.find_last_not_of(" \t\r\n");
+    s_ = s_.substr(b, e - b + 1);
+  }
+  void toUpperCase() { for (char& c : s_) if (c >= 'a' && c <= 'z') c -= 32; }
+  long toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+  float toFloat() const { return strtof(s_.c_str(), nullptr); }
+
+ private:
+  static int wrap(size_t p) { return p == std::string::npos ? -1 : (int)p; }
+  void fromLong(long v, unsigned char base) {
+    if (base == DEC) { s_ = std::to_string(v); track(); return; }
+    fromULong((unsigned long)v, base);
+  }
+  void fromULong(unsigned long v, unsigned char base) {
+    // Arduino 的 String(x, HEX) 是小寫、不補零
+    static const char digits[] = "0123456789abcdef";
+    char buf[33];
+    int i = 32;
+    buf[i] = 0;
+    do { buf[--i] = digits[v % base]; v /= base; } while (v);
+    s_ = &buf[i];
+    track();
+  }
+  void track() {
+    if (s_.size() <= capacity_) return;
+    capacity_ = s_.size();
+    sim::noteHeapAlloc();
+  }
+
+  static const size_t kSsoCapacity = 11;
+  std::string s_;
+  size_t capacity_ = kSsoCapacity;
+};
+
+inline String operator+(const String& a, const String& b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, const char* b) { String r(a); r += b; return r; }
+inline String operator+(const char* a, const String& b) { String r(a); r += b; return r; }
@@ -0,0 +1,96 @@
+#include "hold_tracker.h"
+
+#include <string.h>
+
+void HoldTracker::arm(int16_t quoteNumber, uint32_t requiredMs) {
+  armed_ = true;
+  completed_ = false;
+  target_ = quoteNumber;
+  requiredMs_ = requiredMs ? requiredMs : 1;
+  tracking_ = false;
+  paused_ = false;
+  inGrace_ = false;
+  bankedMs_ = 0;
+  reportDue_ = false;
+}
+
+void HoldTracker::disarm() {
+  armed_ = false;
+  completed_ = false;
+  tracking_ = false;
+}
+
+bool HoldTracker::matches(int quoteNumber, bool wildcard) const {
+  if (!armed_ || completed_) return false;
+  return wildcard || target_ == kAnyQuote || (quoteNumber > 0 && quoteNumber == target_);
+}
+
+void HoldTracker::enter(const uint8_t* uid, uint8_t uidLength, unsigned long atMs) {
+  if (!armed_ || completed_ || uidLength > kMaxUid) return;
+  bool same = tracking_ && uidLength == uidLength_ && memcmp(uid, uid_, uidLength) == 0;
+  if (same && inGrace_) {
+    // grace 內放回來：當作沒拿走過，中間那段照算
+    inGrace_ = false;
+    return;
+  }
+  if (tracking_ && !same) {
+    // 另一瓶還在上面（或 grace 中）就不理；原本那瓶已經暫停 = 換瓶子，從頭算
+    if (!paused_) return;
+    bankedMs_ = 0;
+  }
+  memcpy(uid_, uid, uidLength);
+  uidLength_ = uidLength;
+  tracking_ = true;
+  paused_ = false;
+  inGrace_ = false;
+  startMs_ = atMs;
+  reportDue_ = true;
+}
+
+void HoldTracker::leave(const uint8_t* uid, uint8_t uidLength, unsigned long atMs) {
+  if (!tracking_ || paused_ || inGrace_ || completed_) return;
+  if (uidLength != uidLength_ || memcmp(uid, uid_, uidLength) != 0) return;
+  inGrace_ = true;
+  leftMs_ = atMs;
+}
+
+HoldTracker::Event HoldTracker::poll(unsigned long nowMs) {
+  if (!armed_ || completed_ || !tracking_ || paused_) return EV_NONE;
+  if (inGrace_) {
+    if (nowMs - leftMs_ >= graceMs_) {
+      // 真的拿走了：算到最後一次看到為止，保留累積（至少差 1ms，放回來要再 poll 到才算完成）
+      uint32_t held = bankedMs_ + (uint32_t)(leftMs_ - startMs_);
+      bankedMs_ = held >= requiredMs_ ? requiredMs_ - 1 : held;
+      inGrace_ = false;
+      paused_ = true;
+      lastReportMs_ = nowMs;
+      return EV_PAUSED;
+    }
+  } else if (heldMs(nowMs) >= requiredMs_) {
+    completed_ = true;
+    lastReportMs_ = nowMs;
+    return EV_COMPLETE;
+  }
+  if (reportDue_ || nowMs - lastReportMs_ >= progressIntervalMs_) {
+    reportDue_ = false;
+    lastReportMs_ = nowMs;
+    return EV_PROGRESS;
+  }
+  return EV_NONE;
+}
+
+uint32_t HoldTracker::heldMs(unsigned long nowMs) const {
+  if (completed_) return requiredMs_;
+  if (!tracking_ || paused_) return bankedMs_;
+  uint32_t held = bankedMs_ + (uint32_t)(nowMs - startMs_);
+  // grace 中還不知道卡會不會回來：不會顯示成已經滿了
+  uint32_t cap = inGrace_ ? requiredMs_ - 1 : requiredMs_;
+  return held > cap ? cap : held;
+}
+
+uint16_t HoldTracker::progress16(unsigned long nowMs) const {
+  if (!armed_) return 0;
+  if (completed_) return 65535;
+  if (!tracking_ || paused_) return 0;
+  return (uint16_t)((uint64_t)heldMs(nowMs) * 65535u / requiredMs_);
+}
@@ -0,0 +1,77 @@
+#pragma once
+// ===== 「拿著瓶子 5 秒」在 firmware 裡計時 =====
+// 以前 5 秒是瀏覽器用 nfc_hold_start / nfc_hold_end 自己算：網路延遲、分頁在背景被節流都會讓它忽長忽短，
+// 燈條的琥珀進度還要瀏覽器再用 led_progress 推回來。現在前端進入「等掃描」時先告訴 firmware 要等哪一瓶
+// （hold_target），之後全部在這裡：
+//
+//   放上 / 拿走的時間是 taskNfc 的 poll 看到的時間（拿走 = 最後一次看到，不是 TagPresence 判定離場的時候）
+//   拿走後 graceMs 內又放回來 = 讀卡閃斷，中間那段照算，前端看不出來
+//   超過 grace 才算暫停：已經累積的時間保留（觀眾放回去接著算），跟以前前端的行為一樣
+//   進行中每 progressIntervalMs 最多回報一次（hold_progress），累積滿 requiredMs 送一次 hold_complete，
+//   之後不再追蹤，直到下一次 arm()
+//
+// 燈條的琥珀進度條直接讀 progress16()，不用等前端。
+// 只追一張卡：兩瓶同時放上時先放的那瓶算數。
+
+#include <stddef.h>
+#include <stdint.h>
+
+class HoldTracker {
+ public:
+  static const uint8_t kMaxUid = 7;
+  static const int16_t kAnyQuote = 0;   // hold_target 0 = 任何一張卡都算
+
+  enum Event : uint8_t {
+    EV_NONE,
+    EV_PROGRESS,   // 該回報進度了（包括剛放上、剛從暫停恢復）
+    EV_PAUSED,     // 拿走超過 grace，暫停（也要回報一次，前端的進度條才知道停了）
+    EV_COMPLETE    // 累積滿了；之後不再追蹤，直到下一次 arm()
+  };
+
+  HoldTracker(unsigned long graceMs, unsigned long progressIntervalMs)
+      : graceMs_(graceMs), progressIntervalMs_(progressIntervalMs) {}
+
+  // 開始等 quoteNumber 那一瓶（kAnyQuote = 任何卡），累積歸零
+  void arm(int16_t quoteNumber, uint32_t requiredMs);
+  void disarm();
+
+  bool armed() const { return armed_; }
+  int16_t target() const { return target_; }
+  // 這張卡的雞湯編號（沒登錄 = 0）/ 是不是萬用卡，算不算數
+  bool matches(int quoteNumber, bool wildcard) const;
+
+  // taskNfc：符合 target 的卡放上（atMs = poll 看到的時間）/ 任何卡拿走（atMs = 最後一次看到）
+  void enter(const uint8_t* uid, uint8_t uidLength, unsigned long atMs);
+  void leave(const uint8_t* uid, uint8_t uidLength, unsigned long atMs);
+  // 定期呼叫：grace 到期、該回報進度、滿了
+  Event poll(unsigned long nowMs);
+
+  // 卡在上面（含 grace 中）
+  bool holding() const { return tracking_ && !paused_; }
+  uint32_t heldMs(unsigned long nowMs) const;
+  uint32_t requiredMs() const { return requiredMs_; }
+  // 給燈條：拿著的時候是累積比例（Q16），暫停 / 沒在 hold 是 0；完成後停在滿
+  uint16_t progress16(unsigned long nowMs) const;
+  const uint8_t* uid() const { return uid_; }
+  uint8_t uidLength() const { return uidLength_; }
+
+ private:
+  unsigned long graceMs_;
+  unsigned long progressIntervalMs_;
+
+  bool armed_ = false;
+  bool completed_ = false;
+  int16_t target_ = kAnyQuote;
+  uint32_t requiredMs_ = 0;
+
+  bool tracking_ = false;       // 有一張卡在 hold（放著、grace 中或暫停）
+  bool paused_ = false;
+  bool inGrace_ = false;
+  uint8_t uid_[kMaxUid] = {};
+  uint8_t uidLength_ = 0;
+  uint32_t bankedMs_ = 0;       // 之前幾段已經累積的
+  unsigned long startMs_ = 0;   // 這一段從什麼時候開始
+  unsigned long leftMs_ = 0;    // grace 中：最後一次看到
+  unsigned long lastReportMs_ = 0;
+  bool reportDue_ = false;
+};
@@ -0,0 +1,162 @@
+#include "hot_path_profiler.h"
+
+#include "hal.h"
+
+namespace {
+
+const char* const PROBE_NAMES[HotPathProfiler::PROF_COUNT] = {
+  "loop", "ws_loop", "nfc_poll", "nfc_write", "ws_send", "led_frame", "led_jitter",
+};
+
+// cycles → "12.3"（µs，小數一位）
+struct Micros {
+  unsigned whole;
+  unsigned tenth;
+};
+Micros toMicros(uint32_t cycles) {
+  uint64_t tenths = (uint64_t)cycles * 10 / PROFILER_CPU_MHZ;
+  return { (unsigned)(tenths / 10), (unsigned)(tenths % 10) };
+}
+
+}  // namespace
+
+void CycleHistogram::reset() {
+  memset(buckets_, 0, sizeof(buckets_));
+  count_ = 0;
+  total_ = 0;
+  min_ = UINT32_MAX;
+  max_ = 0;
+}
+
+// 2^k ≤ cycles < 2^(k+1) 那個區間，再看下一個 bit 分前半 / 後半
+uint8_t CycleHistogram::bucketOf(uint32_t cycles) {
+  if (cycles < (1u << (kMinOctave + 1))) return cycles < (3u << (kMinOctave - 1)) ? 0 : 1;
+  uint8_t octave = 31 - __builtin_clz(cycles);
+  if (octave >= kMinOctave + kOctaves) return kBuckets - 1;
+  uint8_t half = (cycles >> (octave - 1)) & 1;
+  return (uint8_t)((octave - kMinOctave) * 2 + half);
+}
+
+uint32_t CycleHistogram::bucketUpperBound(uint8_t bucket) {
+  if (bucket >= kBuckets - 1) return UINT32_MAX;
+  uint8_t octave = kMinOctave + bucket / 2;
+  uint32_t lower = (1u << octave) + (bucket & 1) * (1u << (octave - 1));
+  return lower + (1u << (octave - 1)) - 1;
+}
+
+uint32_t CycleHistogram::percentileCycles(uint16_t permille) const {
+  uint32_t sampled = 0;
+  for (uint32_t n : buckets_) sampled += n;
+  if (sampled == 0) return max_;
+  // 第 ceil(sampled × permille / 1000) 個樣本落在哪一格
+  uint32_t rank = (uint32_t)(((uint64_t)sampled * permille + 999) / 1000);
+  if (rank == 0) rank = 1;
+  uint32_t seen = 0;
+  for (uint8_t i = 0; i < kBuckets; i++) {
+    seen += buckets_[i];
+    if (seen >= rank) {
+      uint32_t upper = bucketUpperBound(i);
+      return upper < max_ ? upper : max_;
+    }
+  }
+  return max_;
+}
+
+const char* HotPathProfiler::probeName(Probe probe) {
+  return probe < PROF_COUNT ? PROBE_NAMES[probe] : "unknown";
+}
+
+void HotPathProfiler::begin(unsigned long nowMs) {
+  // 一次 probe = 前後兩次 getCycleCount + record()；拿一個不用的直方圖量 64 次
+  CycleHistogram scratch(3);
+  uint32_t start = ESP.getCycleCount();
+  for (uint32_t i = 0; i < 64; i++) {
+    uint32_t c0 = ESP.getCycleCount();
+    scratch.record(ESP.getCycleCount() - c0 + i * 97);
+  }
+  recordCost_ = (ESP.getCycleCount() - start) / 64;
+  reset(nowMs);
+}
+
+void HotPathProfiler::reset(unsigned long nowMs) {
+  for (CycleHistogram& h : histograms_) h.reset();
+  startMs_ = nowMs;
+  heapSamples_ = 0;
+  freeHeapMin_ = UINT32_MAX;
+  maxBlockMin_ = UINT32_MAX;
+  fragmentationMax_ = 0;
+  takeHeapSample(nowMs);
+}
+
+void HotPathProfiler::takeHeapSample(unsigned long nowMs) {
+  lastHeapSampleMs_ = nowMs;
+  heapSamples_++;
+  uint32_t freeHeap = ESP.getFreeHeap();
+  uint32_t maxBlock = ESP.getMaxFreeBlockSize();
+  uint8_t fragmentation = ESP.getHeapFragmentation();
+  if (freeHeap < freeHeapMin_) freeHeapMin_ = freeHeap;
+  if (maxBlock < maxBlockMin_) maxBlockMin_ = maxBlock;
+  if (fragmentation > fragmentationMax_) fragmentationMax_ = fragmentation;
+}
+
+uint32_t HotPathProfiler::overheadPermille(unsigned long nowMs) const {
+  uint64_t elapsed = (uint64_t)(nowMs - startMs_) * 1000 * PROFILER_CPU_MHZ;
+  if (elapsed == 0) return 0;
+  uint64_t records = 0;
+  for (const CycleHistogram& h : histograms_) records += h.count();
+  // heap 取樣要走一遍 heap，算它 50 次 record
+  records += (uint64_t)heapSamples_ * 50;
+  return (uint32_t)(records * recordCost_ * 1000 / elapsed);
+}
+
+size_t HotPathProfiler::formatLine(Probe probe, char* out, size_t capacity) const {
+  const CycleHistogram& h = histograms_[probe];
+  Micros mn = toMicros(h.minCycles()), avg = toMicros(h.avgCycles()), p99 = toMicros(h.percentileCycles(990)),
+         mx = toMicros(h.maxCycles());
+  int n = snprintf(out, capacity, "STATS:%s:n=%lu,min_us=%u.%u,avg_us=%u.%u,p99_us=%u.%u,max_us=%u.%u",
+                   probeName(probe), (unsigned long)h.count(), mn.whole, mn.tenth, avg.whole, avg.tenth, p99.whole,
+                   p99.tenth, mx.whole, mx.tenth);
+  return n < 0 ? 0 : ((size_t)n < capacity ? (size_t)n : capacity - 1);
+}
+
+size_t HotPathProfiler::formatHeapLine(unsigned long nowMs, char* out, size_t capacity) const {
+  int n = snprintf(out, capacity,
+                   "STATS:heap:free_min=%lu,block_min=%lu,frag_max=%u,overhead_permille=%lu,window_ms=%lu",
+                   (unsigned long)freeHeapMin_, (unsigned long)maxBlockMin_, (unsigned)fragmentationMax_,
+                   (unsigned long)overheadPermille(nowMs), (unsigned long)(nowMs - startMs_));
+  return n < 0 ? 0 : ((size_t)n < capacity ? (size_t)n : capacity - 1);
+}
+
+size_t HotPathProfiler::writeJson(unsigned long nowMs, char* out, size_t capacity) const {
+  size_t used = 0;
+  // 每段 snprintf 之後把 used 夾在 capacity 以內；最後不夠放就回 0
+  auto append = [&](int n) {
+    if (n < 0 || used + (size_t)n >= capacity) {
+      used = capacity;
+      return false;
+    }
+    used += (size_t)n;
+    return true;
+  };
+  if (!append(snprintf(out, capacity, "{\"type\":\"stats\",\"window_ms\":%lu,\"overhead_permille\":%lu,\"probes\":{",
+                       (unsigned long)(nowMs - startMs_), (unsigned long)overheadPermille(nowMs)))) {
+    return 0;
+  }
+  for (uint8_t i = 0; i < PROF_COUNT; i++) {
+    const CycleHistogram& h = histograms_[i];
+    Micros mn = toMicros(h.minCycles()), avg = toMicros(h.avgCycles()), p99 = toMicros(h.percentileCycles(990)),
+           mx = toMicros(h.maxCycles());
+    if (!append(snprintf(out + used, capacity - used,
+                         "%s\"%s\":{\"n\":%lu,\"min_us\":%u.%u,\"avg_us\":%u.%u,\"p99_us\":%u.%u,\"max_us\":%u.%u}",
+                         i ? "," : "", PROBE_NAMES[i], (unsigned long)h.count(), mn.whole, mn.tenth, avg.whole,
+                         avg.tenth, p99.whole, p99.tenth, mx.whole, mx.tenth))) {
+      return 0;
+    }
+  }
+  if (!append(snprintf(out + used, capacity - used,
+                       "},\"heap\":{\"free_min\":%lu,\"block_min\":%lu,\"frag_max\":%u}}",
+                       (unsigned long)freeHeapMin_, (unsigned long)maxBlockMin_, (unsigned)fragmentationMax_))) {
+    return 0;
+  }
+  return used;
+}
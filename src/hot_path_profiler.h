@@ -0,0 +1,121 @@
+#pragma once
+// ===== 熱路徑 profiler（cycle counter + 固定 bucket 直方圖）=====
+// 以前只有 "[scan] no tag (heap=…)" 那一行心跳，看不出時間花在哪。現在 loop() 與裡面幾個熱點
+// 各自用 ESP.getCycleCount() 量一次，丟進固定大小的直方圖：
+//
+//   loop        整個 loop()（scheduler.runOnce + flushEvents）
+//   ws_loop     webSocket.loop()
+//   nfc_poll    nfcReader.poll()（以前的 nfc.tagPresent()：InList 不再阻塞，這裡只有 SPI status / 讀 frame）
+//   nfc_write   ntagWriter.write()（以前的 nfc.read() + nfc.write()：NTAG 讀 CC、寫頁、讀回）
+//   ws_send     flushEvents() 的 broadcastTXT / sendBIN
+//   led_frame   updateLeds() 一幀（render + Show）
+//   led_jitter  LED Ticker 實際間隔跟 LED_FRAME_MS 差多少
+//
+// 直方圖每個 2 倍區間切兩格（32 cycles ~ 6.7 s，48 格），p99 取那一格的上界，誤差 < 50%；
+// min / max / 平均是精確值。heap 剩餘 / 最大連續區塊 / 碎片率每 kHeapSampleMs 取樣一次記極值。
+// Serial 的 STATS 指令、WebSocket 的 {"type":"stats"} 都是讀這裡（格式見 formatLine / writeJson）。
+//
+// 開銷：一次 record() 是幾個加法 + 比大小；呼叫很密的 probe（loop / ws_loop / nfc_poll）
+// 直方圖只每 8 次記一次（min / max / 平均還是每次都算）。begin() 量一次 record() 的成本，
+// overheadPermille() 用「記了幾次 × 每次成本 ÷ 經過的 cycle」估算，STATS 會一起印出來。
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef PROFILER_CPU_MHZ
+#define PROFILER_CPU_MHZ 80
+#endif
+
+class CycleHistogram {
+ public:
+  static const uint8_t kMinOctave = 5;    // 2^5 = 32 cycles = 0.4µs 以下都算第 0 格
+  static const uint8_t kOctaves = 24;
+  static const uint8_t kBuckets = 2 * kOctaves;
+
+  explicit CycleHistogram(uint8_t sampleShift = 0) : sampleMask_((1u << sampleShift) - 1) {}
+
+  void record(uint32_t cycles) {
+    count_++;
+    total_ += cycles;
+    if (cycles < min_) min_ = cycles;
+    if (cycles > max_) max_ = cycles;
+    if ((count_ & sampleMask_) == 0) buckets_[bucketOf(cycles)]++;
+  }
+  void reset();
+
+  uint32_t count() const { return count_; }
+  uint32_t minCycles() const { return count_ ? min_ : 0; }
+  uint32_t maxCycles() const { return max_; }
+  uint32_t avgCycles() const { return count_ ? (uint32_t)(total_ / count_) : 0; }
+  // permille = 990 → p99；回傳那一格的上界（不超過 max）
+  uint32_t percentileCycles(uint16_t permille) const;
+
+  static uint8_t bucketOf(uint32_t cycles);
+  static uint32_t bucketUpperBound(uint8_t bucket);
+
+ private:
+  uint32_t buckets_[kBuckets] = {};
+  uint32_t count_ = 0;
+  uint64_t total_ = 0;
+  uint32_t min_ = UINT32_MAX;
+  uint32_t max_ = 0;
+  uint32_t sampleMask_;
+};
+
+class HotPathProfiler {
+ public:
+  enum Probe : uint8_t {
+    PROF_LOOP,
+    PROF_WS_LOOP,
+    PROF_NFC_POLL,
+    PROF_NFC_WRITE,
+    PROF_WS_SEND,
+    PROF_LED_FRAME,
+    PROF_LED_JITTER,
+    PROF_COUNT
+  };
+  static const char* probeName(Probe probe);
+
+  static const unsigned long kHeapSampleMs = 250;
+
+  // 量 record() 的成本 + 開始計時
+  void begin(unsigned long nowMs);
+  void record(Probe probe, uint32_t cycles) { histograms_[probe].record(cycles); }
+  // loop() 裡每輪呼叫；距離上次取樣超過 kHeapSampleMs 才真的讀 heap
+  void sampleHeap(unsigned long nowMs) {
+    if (nowMs - lastHeapSampleMs_ >= kHeapSampleMs) takeHeapSample(nowMs);
+  }
+  // 清掉所有直方圖 / 極值，重新開始一個量測區間
+  void reset(unsigned long nowMs);
+
+  const CycleHistogram& histogram(Probe probe) const { return histograms_[probe]; }
+  uint32_t freeHeapMin() const { return freeHeapMin_; }
+  uint32_t maxBlockMin() const { return maxBlockMin_; }
+  uint8_t fragmentationMax() const { return fragmentationMax_; }
+  uint32_t recordCost() const { return recordCost_; }
+  // 估計的量測開銷（千分比）
+  uint32_t overheadPermille(unsigned long nowMs) const;
+
+  // Serial：STATS:loop:n=..,min_us=..,avg_us=..,p99_us=..,max_us=..（µs 到小數一位）
+  size_t formatLine(Probe probe, char* out, size_t capacity) const;
+  // Serial：STATS:heap:free_min=..,block_min=..,frag_max=..,overhead_permille=..,window_ms=..
+  size_t formatHeapLine(unsigned long nowMs, char* out, size_t capacity) const;
+  // WebSocket：{"type":"stats","window_ms":..,"overhead_permille":..,"probes":{"loop":{...},...},"heap":{...}}
+  size_t writeJson(unsigned long nowMs, char* out, size_t capacity) const;
+
+ private:
+  void takeHeapSample(unsigned long nowMs);
+
+  // 呼叫很密的前三個直方圖每 8 次記一次
+  CycleHistogram histograms_[PROF_COUNT] = {
+    CycleHistogram(3), CycleHistogram(3), CycleHistogram(3), CycleHistogram(),
+    CycleHistogram(),  CycleHistogram(),  CycleHistogram(),
+  };
+  unsigned long startMs_ = 0;
+  unsigned long lastHeapSampleMs_ = 0;
+  uint32_t heapSamples_ = 0;
+  uint32_t freeHeapMin_ = UINT32_MAX;
+  uint32_t maxBlockMin_ = UINT32_MAX;
+  uint8_t fragmentationMax_ = 0;
+  uint32_t recordCost_ = 0;   // 一次 probe（兩次 getCycleCount + record）的 cycle 數
+};
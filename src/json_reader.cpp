@@ -0,0 +1,320 @@
+#include "json_reader.h"
+
+#include <string.h>
+
+namespace {
+
+bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+int hexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// 把 code point 寫成 UTF-8，回傳寫了幾個 byte
+uint8_t writeUtf8(char* out, uint32_t cp) {
+  if (cp < 0x80) { out[0] = (char)cp; return 1; }
+  if (cp < 0x800) {
+    out[0] = (char)(0xC0 | (cp >> 6));
+    out[1] = (char)(0x80 | (cp & 0x3F));
+    return 2;
+  }
+  if (cp < 0x10000) {
+    out[0] = (char)(0xE0 | (cp >> 12));
+    out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    out[2] = (char)(0x80 | (cp & 0x3F));
+    return 3;
+  }
+  out[0] = (char)(0xF0 | (cp >> 18));
+  out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+  out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+  out[3] = (char)(0x80 | (cp & 0x3F));
+  return 4;
+}
+
+}  // namespace
+
+void JsonReader::skipSpace() {
+  while (pos_ < len_) {
+    char c = buf_[pos_];
+    if (c != ' ' && c != '\t' && c != '\r' && c != '\n') break;
+    pos_++;
+  }
+}
+
+bool JsonReader::parse(char* json, size_t length) {
+  buf_ = json;
+  len_ = length;
+  pos_ = 0;
+  count_ = 0;
+
+  // WebSocket payload 後面通常還有一個 '\0'，不算進內容
+  while (len_ > 0 && buf_[len_ - 1] == '\0') len_--;
+
+  skipSpace();
+  if (pos_ >= len_ || buf_[pos_] != '{') return false;
+  pos_++;
+  skipSpace();
+
+  bool ok = false;
+  if (pos_ < len_ && buf_[pos_] == '}') {
+    pos_++;
+    ok = true;
+  } else {
+    while (pos_ < len_) {
+      if (buf_[pos_] != '"') break;
+      const char* key;
+      uint16_t keyLength;
+      if (!parseString(key, keyLength)) break;
+      skipSpace();
+      if (pos_ >= len_ || buf_[pos_] != ':') break;
+      pos_++;
+      skipSpace();
+      if (pos_ >= len_) break;
+
+      Field f;
+      f.key = key;
+      char c = buf_[pos_];
+      size_t start = pos_;
+      if (c == '"') {
+        f.kind = KIND_STRING;
+        if (!parseString(f.value, f.valueLength)) break;
+      } else if (c == '-' || isDigit(c)) {
+        f.kind = KIND_NUMBER;
+        if (!parseNumber()) break;
+        f.value = buf_ + start;
+        f.valueLength = (uint16_t)(pos_ - start);
+      } else if (c == 't' || c == 'f' || c == 'n') {
+        f.kind = KIND_LITERAL;
+        if (!parseLiteral()) break;
+        f.value = buf_ + start;
+        f.valueLength = (uint16_t)(pos_ - start);
+      } else if (c == '{' || c == '[') {
+        f.kind = KIND_NESTED;
+        if (!skipNested()) break;
+        f.value = buf_ + start;
+        f.valueLength = (uint16_t)(pos_ - start);
+      } else {
+        break;
+      }
+      // 超過 kMaxFields 的欄位照樣驗證，只是不記
+      if (count_ < kMaxFields) fields_[count_++] = f;
+
+      skipSpace();
+      if (pos_ >= len_) break;
+      if (buf_[pos_] == ',') {
+        pos_++;
+        skipSpace();
+        continue;
+      }
+      if (buf_[pos_] == '}') {
+        pos_++;
+        ok = true;
+      }
+      break;
+    }
+  }
+
+  if (ok) {
+    skipSpace();
+    ok = (pos_ == len_);
+  }
+  if (!ok) count_ = 0;
+  return ok;
+}
+
+// 進來時 buf_[pos_] == '"'；就地 unescape，結尾 '"' 的位置寫成 '\0'
+bool JsonReader::parseString(const char*& out, uint16_t& outLength) {
+  pos_++;
+  char* dst = buf_ + pos_;
+  out = dst;
+  while (pos_ < len_) {
+    char c = buf_[pos_++];
+    if (c == '"') {
+      outLength = (uint16_t)(dst - out);
+      *dst = '\0';   // dst 一定 <= 剛剛那個 '"' 的位置
+      return true;
+    }
+    if ((unsigned char)c < 0x20) return false;   // JSON 字串不能有裸控制字元
+    if (c != '\\') {
+      *dst++ = c;
+      continue;
+    }
+    if (pos_ >= len_) return false;
+    char e = buf_[pos_++];
+    switch (e) {
+      case '"': *dst++ = '"'; break;
+      case '\\': *dst++ = '\\'; break;
+      case '/': *dst++ = '/'; break;
+      case 'b': *dst++ = '\b'; break;
+      case 'f': *dst++ = '\f'; break;
+      case 'n': *dst++ = '\n'; break;
+      case 'r': *dst++ = '\r'; break;
+      case 't': *dst++ = '\t'; break;
+      case 'u': {
+        uint32_t cp = 0;
+        for (uint8_t i = 0; i < 4; i++) {
+          int h = pos_ < len_ ? hexValue(buf_[pos_++]) : -1;
+          if (h < 0) return false;
+          cp = (cp << 4) | (uint32_t)h;
+        }
+        // surrogate pair：😀 → 一個 code point
+        if (cp >= 0xD800 && cp <= 0xDBFF) {
+          if (pos_ + 6 > len_ || buf_[pos_] != '\\' || buf_[pos_ + 1] != 'u') return false;
+          pos_ += 2;
+          uint32_t lo = 0;
+          for (uint8_t i = 0; i < 4; i++) {
+            int h = hexValue(buf_[pos_++]);
+            if (h < 0) return false;
+            lo = (lo << 4) | (uint32_t)h;
+          }
+          if (lo < 0xDC00 || lo > 0xDFFF) return false;
+          cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+        } else if (cp >= 0xDC00 && cp <= 0xDFFF) {
+          return false;
+        }
+        // 6 個字元的 escape 最多變 3 byte（pair 12 → 4），寫得下
+        dst += writeUtf8(dst, cp);
+        break;
+      }
+      default:
+        return false;
+    }
+  }
+  return false;
+}
+
+// JSON number 文法：-?(0|[1-9]\d*)(\.\d+)?([eE][+-]?\d+)?
+bool JsonReader::parseNumber() {
+  if (buf_[pos_] == '-') pos_++;
+  if (pos_ >= len_ || !isDigit(buf_[pos_])) return false;
+  if (buf_[pos_] == '0') {
+    pos_++;
+  } else {
+    while (pos_ < len_ && isDigit(buf_[pos_])) pos_++;
+  }
+  if (pos_ < len_ && buf_[pos_] == '.') {
+    pos_++;
+    if (pos_ >= len_ || !isDigit(buf_[pos_])) return false;
+    while (pos_ < len_ && isDigit(buf_[pos_])) pos_++;
+  }
+  if (pos_ < len_ && (buf_[pos_] == 'e' || buf_[pos_] == 'E')) {
+    pos_++;
+    if (pos_ < len_ && (buf_[pos_] == '+' || buf_[pos_] == '-')) pos_++;
+    if (pos_ >= len_ || !isDigit(buf_[pos_])) return false;
+    while (pos_ < len_ && isDigit(buf_[pos_])) pos_++;
+  }
+  return true;
+}
+
+bool JsonReader::parseLiteral() {
+  static const char* const kLiterals[] = { "true", "false", "null" };
+  for (const char* lit : kLiterals) {
+    size_t n = strlen(lit);
+    if (pos_ + n <= len_ && memcmp(buf_ + pos_, lit, n) == 0) {
+      pos_ += n;
+      return true;
+    }
+  }
+  return false;
+}
+
+// 巢狀 object / array：只確認括號成對、字串合法，不記內容
+bool JsonReader::skipNested() {
+  char stack[kMaxDepth];
+  uint8_t depth = 0;
+  while (pos_ < len_) {
+    char c = buf_[pos_];
+    if (c == '{' || c == '[') {
+      if (depth >= kMaxDepth) return false;
+      stack[depth++] = (c == '{') ? '}' : ']';
+      pos_++;
+    } else if (c == '}' || c == ']') {
+      if (depth == 0 || stack[depth - 1] != c) return false;
+      depth--;
+      pos_++;
+      if (depth == 0) return true;
+    } else if (c == '"') {
+      const char* s;
+      uint16_t n;
+      if (!parseString(s, n)) return false;
+    } else {
+      pos_++;
+    }
+  }
+  return false;
+}
+
+const JsonReader::Field* JsonReader::find(const char* key) const {
+  for (uint8_t i = 0; i < count_; i++) {
+    if (strcmp(fields_[i].key, key) == 0) return &fields_[i];
+  }
+  return nullptr;
+}
+
+const char* JsonReader::getString(const char* key) const {
+  const Field* f = find(key);
+  return (f && f->kind == KIND_STRING) ? f->value : nullptr;
+}
+
+bool JsonReader::getInt(const char* key, long& out) const {
+  const Field* f = find(key);
+  if (!f || f->kind != KIND_NUMBER) return false;
+  const char* p = f->value;
+  const char* end = p + f->valueLength;
+  bool neg = (*p == '-');
+  if (neg) p++;
+  long v = 0;
+  for (; p < end && isDigit(*p); p++) {
+    if (v > (0x7FFFFFFFL - (*p - '0')) / 10) return false;   // 超過 32-bit long
+    v = v * 10 + (*p - '0');
+  }
+  if (p != end) return false;   // 有小數點 / 指數就不是整數
+  out = neg ? -v : v;
+  return true;
+}
+
+bool JsonReader::getFloat(const char* key, float& out) const {
+  const Field* f = find(key);
+  if (!f || f->kind != KIND_NUMBER) return false;
+  const char* p = f->value;
+  const char* end = p + f->valueLength;
+  bool neg = (*p == '-');
+  if (neg) p++;
+
+  // 整數 + 小數位數先累加在 32-bit 整數，最後只做一次浮點乘法
+  uint32_t mantissa = 0;
+  int exp10 = 0;
+  for (; p < end && isDigit(*p); p++) {
+    if (mantissa < 100000000u) mantissa = mantissa * 10 + (uint32_t)(*p - '0');
+    else exp10++;
+  }
+  if (p < end && *p == '.') {
+    for (p++; p < end && isDigit(*p); p++) {
+      if (mantissa < 100000000u) {
+        mantissa = mantissa * 10 + (uint32_t)(*p - '0');
+        exp10--;
+      }
+    }
+  }
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    p++;
+    bool eneg = false;
+    if (*p == '+' || *p == '-') eneg = (*p++ == '-');
+    int e = 0;
+    for (; p < end && isDigit(*p); p++) {
+      if (e < 100) e = e * 10 + (*p - '0');
+    }
+    exp10 += eneg ? -e : e;
+  }
+
+  float v = (float)mantissa;
+  if (exp10 > 38) exp10 = 38;
+  if (exp10 < -45) exp10 = -45;
+  for (; exp10 > 0; exp10--) v *= 10.0f;
+  for (; exp10 < 0; exp10++) v /= 10.0f;
+  out = neg ? -v : v;
+  return true;
+}
@@ -0,0 +1,49 @@
+#pragma once
+// ===== 就地 (in-place) JSON 讀取器 =====
+// 給 WebSocket 收到的小訊息用：{"type":"led_progress","value":0.42}
+// - 只掃一遍 payload，把頂層 key / value 的位置記在固定大小的陣列裡，完全不配置 heap
+// - 字串直接在 payload buffer 裡 unescape，並把結尾的 '"' 改成 '\0'，
+//   所以 getString() 回傳的指標可以直接當 C 字串用（payload 必須可寫）
+// - 數字自己 parse（newlib 的 strtod 內部會 malloc）
+// - 格式不對（少引號、多逗號、結尾有垃圾…）整包拒絕，不會「剛好 match 到子字串」
+// - 巢狀的 object / array 會被驗證、跳過，但不能用 get 取值
+
+#include <stddef.h>
+#include <stdint.h>
+
+class JsonReader {
+ public:
+  static const uint8_t kMaxFields = 8;
+  static const uint8_t kMaxDepth = 4;
+
+  // 成功回 true；失敗後所有 get 都拿不到東西
+  bool parse(char* json, size_t length);
+
+  // key 不存在或型別不對 → nullptr / false
+  const char* getString(const char* key) const;
+  bool getFloat(const char* key, float& out) const;
+  bool getInt(const char* key, long& out) const;
+  bool has(const char* key) const { return find(key) != nullptr; }
+
+ private:
+  enum Kind : uint8_t { KIND_STRING, KIND_NUMBER, KIND_LITERAL, KIND_NESTED };
+  struct Field {
+    const char* key;
+    const char* value;    // 字串：已 unescape、'\0' 結尾；數字：原文起點
+    uint16_t valueLength;
+    Kind kind;
+  };
+
+  const Field* find(const char* key) const;
+  bool parseString(const char*& out, uint16_t& outLength);
+  bool parseNumber();
+  bool parseLiteral();
+  bool skipNested();
+  void skipSpace();
+
+  char* buf_ = nullptr;
+  size_t len_ = 0;
+  size_t pos_ = 0;
+  Field fields_[kMaxFields];
+  uint8_t count_ = 0;
+};
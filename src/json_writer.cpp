@@ -0,0 +1,151 @@
+#include "json_writer.h"
+
+#include <math.h>
+#include <string.h>
+
+size_t formatUid(const uint8_t* uid, uint8_t uidLength, char* out, size_t capacity) {
+  static const char kHex[] = "0123456789ABCDEF";
+  size_t need = uidLength ? uidLength * 3 : 1;   // 含 '\0'
+  if (need > capacity) return 0;
+  size_t n = 0;
+  for (uint8_t i = 0; i < uidLength; i++) {
+    if (i) out[n++] = ':';
+    out[n++] = kHex[uid[i] >> 4];
+    out[n++] = kHex[uid[i] & 0x0F];
+  }
+  out[n] = '\0';
+  return n;
+}
+
+bool JsonWriter::put(char c) {
+  // 永遠留一格給 finish() 的 '}'、一格給 '\0'
+  if (overflowed_ || used_ + 2 >= capacity_) {
+    overflowed_ = true;
+    return false;
+  }
+  buf_[used_++] = c;
+  return true;
+}
+
+bool JsonWriter::put(const char* text, size_t length) {
+  if (overflowed_ || used_ + length + 2 > capacity_) {
+    overflowed_ = true;
+    return false;
+  }
+  memcpy(buf_ + used_, text, length);
+  used_ += length;
+  return true;
+}
+
+bool JsonWriter::putInt(long value) {
+  char digits[12];
+  uint8_t n = 0;
+  unsigned long v = value < 0 ? 0UL - (unsigned long)value : (unsigned long)value;
+  do {
+    digits[n++] = (char)('0' + v % 10);
+    v /= 10;
+  } while (v);
+  if (value < 0 && !put('-')) return false;
+  while (n) {
+    if (!put(digits[--n])) return false;
+  }
+  return true;
+}
+
+bool JsonWriter::putEscaped(const char* text) {
+  static const char kHex[] = "0123456789abcdef";
+  if (!put('"')) return false;
+  for (const char* p = text ? text : ""; *p; p++) {
+    uint8_t c = (uint8_t)*p;
+    bool ok;
+    if (c == '"' || c == '\\') {
+      char esc[2] = { '\\', (char)c };
+      ok = put(esc, 2);
+    } else if (c == '\n') {
+      ok = put("\\n", 2);
+    } else if (c < 0x20) {
+      char esc[6] = { '\\', 'u', '0', '0', kHex[c >> 4], kHex[c & 0x0F] };
+      ok = put(esc, 6);
+    } else {
+      ok = put((char)c);   // UTF-8 原樣放
+    }
+    if (!ok) return false;
+  }
+  return put('"');
+}
+
+bool JsonWriter::key(const char* name) {
+  if (finished_) {
+    // finish() 之後又 add：把 '}' 拿掉繼續寫
+    used_--;
+    finished_ = false;
+  }
+  if (used_ == 0 && !put('{')) return false;
+  if (!first_ && !put(',')) return false;
+  first_ = false;
+  return putEscaped(name) && put(':');
+}
+
+JsonWriter& JsonWriter::addString(const char* name, const char* value) {
+  if (key(name)) putEscaped(value);
+  return *this;
+}
+
+JsonWriter& JsonWriter::addInt(const char* name, long value) {
+  if (key(name)) putInt(value);
+  return *this;
+}
+
+JsonWriter& JsonWriter::addFloat(const char* name, float value, uint8_t decimals) {
+  if (!key(name)) return *this;
+  if (isnan(value) || isinf(value)) {
+    put("null", 4);
+    return *this;
+  }
+  if (decimals > 4) decimals = 4;
+  long scale = 1;
+  for (uint8_t i = 0; i < decimals; i++) scale *= 10;
+  // 定點：整數部分 + 補零的小數部分；超出 long 的範圍就夾住
+  double scaled = fabs((double)value) * scale + 0.5;
+  if (scaled > 2.0e9) scaled = 2.0e9;
+  unsigned long fixed = (unsigned long)scaled;
+  if (value < 0 && fixed > 0 && !put('-')) return *this;
+  if (!putInt((long)(fixed / scale)) || decimals == 0 || !put('.')) return *this;
+  unsigned long frac = fixed % scale;
+  for (long div = scale / 10; div > 0; div /= 10) {
+    if (!put((char)('0' + frac / div % 10))) break;
+  }
+  return *this;
+}
+
+JsonWriter& JsonWriter::addBool(const char* name, bool value) {
+  if (key(name)) value ? put("true", 4) : put("false", 5);
+  return *this;
+}
+
+JsonWriter& JsonWriter::addUid(const char* name, const uint8_t* uid, uint8_t uidLength) {
+  char text[kUidTextCapacity];
+  if (!formatUid(uid, uidLength, text, sizeof(text))) {
+    overflowed_ = true;
+    return *this;
+  }
+  if (key(name)) put('"') && put(text, strlen(text)) && put('"');
+  return *this;
+}
+
+JsonWriter& JsonWriter::addRaw(const char* name, const char* json, size_t jsonLength) {
+  if (key(name)) put(json, jsonLength);
+  return *this;
+}
+
+const char* JsonWriter::finish() {
+  if (overflowed_) return nullptr;
+  if (!finished_) {
+    if (used_ == 0) buf_[used_++] = '{';   // 一個欄位都沒有：{}
+    // put() 都有留兩格，'}' + '\0' 一定放得下
+    buf_[used_++] = '}';
+    finished_ = true;
+  }
+  buf_[used_] = '\0';
+  return buf_;
+}
@@ -0,0 +1,71 @@
+#pragma once
+// ===== 固定容量的 JSON 寫入器（JsonReader 的另一半）=====
+// 以前往外送的訊息都是 String 串起來的：
+//   "{\"type\":\"show_context\",\"uid\":\"" + getUIDString(...) + "\"}"
+// 一則訊息就是好幾次 heap 配置（每個 + 產生一個暫時的 String、getUIDString 每個 byte 再 += 兩次），
+// 掃卡路徑上每張卡十幾次 malloc / free，久了 heap 碎成一塊一塊。
+//
+// 現在直接寫進呼叫端給的 buffer（通常是 stack 上的 JsonBuffer<N>），完全不配置 heap：
+//
+//   JsonBuffer<96> msg;
+//   msg.addString("type", "nfc_hold_end").addUid("uid", uid, uidLength);
+//   const char* json = msg.finish();   // 先 finish() 再拿 length()（同一個運算式裡的求值順序不一定）
+//   webSocket.broadcastTXT(json, msg.length());
+//
+// - 每個 add 都是一個頂層欄位，型別分開寫（字串會 escape、整數 / 小數自己轉，不經過 printf）
+// - 塞不下就標記 overflowed()，後面的 add 都不做，finish() 回 nullptr、length() 回 0，
+//   呼叫端不會送出半截 JSON
+// - 小數用定點換算（newlib 的 printf("%f") 內部會 malloc，跟 JsonReader 不用 strtod 同一個理由）
+
+#include <stddef.h>
+#include <stdint.h>
+
+// "04:83:D5:22:BF:2A:81"：一個 byte 三個字（最後一個沒有 ':'）+ '\0'，10 bytes 的 UID 也放得下
+const size_t kUidTextCapacity = 3 * 10;
+// 回傳寫了幾個字（不含 '\0'）；放不下回 0
+size_t formatUid(const uint8_t* uid, uint8_t uidLength, char* out, size_t capacity);
+
+class JsonWriter {
+ public:
+  // 寫進 buffer；第一個 add（或 finish）才開始寫 '{'
+  JsonWriter(char* buffer, size_t capacity) : buf_(buffer), capacity_(capacity) {}
+
+  JsonWriter& addString(const char* key, const char* value);
+  JsonWriter& addInt(const char* key, long value);
+  // decimals 位小數（最多 4），四捨五入；NaN / inf 寫 null
+  JsonWriter& addFloat(const char* key, float value, uint8_t decimals = 2);
+  JsonWriter& addBool(const char* key, bool value);
+  // "04:83:D5:..." 形式的字串，跟 Serial log / 前端 nfc.js 認的格式一樣
+  JsonWriter& addUid(const char* key, const uint8_t* uid, uint8_t uidLength);
+  // value 已經是合法的 JSON（巢狀物件 / 陣列，例如 profiler 的 writeJson），原樣放進去
+  JsonWriter& addRaw(const char* key, const char* json, size_t jsonLength);
+
+  // 補上 '}' + '\0'，回傳 buffer；overflow 回 nullptr。可以重複呼叫
+  const char* finish();
+  size_t length() const { return overflowed_ ? 0 : used_; }
+  bool overflowed() const { return overflowed_; }
+
+ private:
+  bool key(const char* name);
+  bool put(char c);
+  bool put(const char* text, size_t length);
+  bool putInt(long value);
+  bool putEscaped(const char* text);
+
+  char* buf_;
+  size_t capacity_;
+  size_t used_ = 0;
+  bool first_ = true;
+  bool finished_ = false;
+  bool overflowed_ = false;
+};
+
+// stack 上的 buffer + writer：JsonBuffer<128> msg; msg.addString(...)
+template <size_t N>
+class JsonBuffer : public JsonWriter {
+ public:
+  JsonBuffer() : JsonWriter(storage_, N) {}
+
+ private:
+  char storage_[N];
+};
@@ -0,0 +1,86 @@
+#include "led_engine.h"
+
+LedFrameBuffer::LedFrameBuffer(uint8_t count)
+    : count_(count > kMaxPixels ? kMaxPixels : count), back_(bufA_), front_(bufB_) {
+  memset(bufA_, 0, sizeof(bufA_));
+  memset(bufB_, 0, sizeof(bufB_));
+  memset(ditherErr_, 0, sizeof(ditherErr_));
+}
+
+void LedFrameBuffer::setPixel(uint8_t i, uint8_t r, uint8_t g, uint8_t b, uint16_t amp16) {
+  if (i >= count_) return;
+  back_[i].r = ledlut::scale(r, amp16);
+  back_[i].g = ledlut::scale(g, amp16);
+  back_[i].b = ledlut::scale(b, amp16);
+}
+
+void LedFrameBuffer::fill(uint8_t r, uint8_t g, uint8_t b, uint16_t amp16) {
+  LinColor c = { ledlut::scale(r, amp16), ledlut::scale(g, amp16), ledlut::scale(b, amp16) };
+  for (uint8_t i = 0; i < count_; i++) back_[i] = c;
+}
+
+void LedFrameBuffer::gradient(RgbColor from, uint16_t fromAmp16, RgbColor to, uint16_t toAmp16) {
+  if (count_ == 1) { setPixel(0, from.R, from.G, from.B, fromAmp16); return; }
+  LinColor a = { ledlut::scale(from.R, fromAmp16), ledlut::scale(from.G, fromAmp16), ledlut::scale(from.B, fromAmp16) };
+  LinColor b = { ledlut::scale(to.R, toAmp16), ledlut::scale(to.G, toAmp16), ledlut::scale(to.B, toAmp16) };
+  const int32_t span = count_ - 1;
+  for (uint8_t i = 0; i < count_; i++) {
+    back_[i].r = (uint16_t)(a.r + ((int32_t)b.r - a.r) * i / span);
+    back_[i].g = (uint16_t)(a.g + ((int32_t)b.g - a.g) * i / span);
+    back_[i].b = (uint16_t)(a.b + ((int32_t)b.b - a.b) * i / span);
+  }
+}
+
+bool LedFrameBuffer::present(const ledlut::Table& gamma, bool dither) {
+  // 跟上一幀一模一樣：連 dithering 都不推進，燈維持原樣
+  if (!forceNext_ && memcmp(back_, front_, count_ * sizeof(LinColor)) == 0) return false;
+
+  LinColor* t = front_;
+  front_ = back_;
+  back_ = t;
+
+  bool changed = forceNext_;
+  forceNext_ = false;
+  for (uint8_t i = 0; i < count_; i++) {
+    RgbColor c(ledlut::renderLinear(gamma, front_[i].r, dither ? &ditherErr_[i][0] : nullptr),
+               ledlut::renderLinear(gamma, front_[i].g, dither ? &ditherErr_[i][1] : nullptr),
+               ledlut::renderLinear(gamma, front_[i].b, dither ? &ditherErr_[i][2] : nullptr));
+    if (!(c == shown_[i])) {
+      shown_[i] = c;
+      changed = true;
+    }
+  }
+  return changed;
+}
+
+namespace ledfx {
+
+void progressBar(LedFrameBuffer& fb, RgbColor c, uint16_t progress16, uint16_t baseAmp16, uint16_t fillAmp16) {
+  // 填滿的長度，單位 1/256 顆
+  uint32_t filled = ((uint32_t)progress16 * fb.count()) >> 8;
+  for (uint8_t i = 0; i < fb.count(); i++) {
+    uint32_t start = (uint32_t)i << 8;
+    uint32_t cover = filled <= start ? 0 : (filled - start >= 256 ? 256 : filled - start);
+    uint16_t amp = (uint16_t)(baseAmp16 + (((int32_t)fillAmp16 - baseAmp16) * (int32_t)cover >> 8));
+    fb.setPixel(i, c.R, c.G, c.B, amp);
+  }
+}
+
+void chase(LedFrameBuffer& fb, RgbColor c, unsigned long nowMs, uint16_t periodMs, uint16_t baseAmp16,
+           uint16_t peakAmp16, uint16_t widthQ8) {
+  if (widthQ8 == 0) widthQ8 = 1;
+  // 來回跑：前半週期 0 → 最後一顆，後半週期回來（位置單位 1/256 顆）
+  uint32_t span = (uint32_t)(fb.count() - 1) << 8;
+  uint32_t phase = (uint32_t)(nowMs % periodMs);
+  uint32_t half = periodMs / 2;
+  uint32_t pos = phase < half ? span * phase / half : span * (periodMs - phase) / (periodMs - half);
+  for (uint8_t i = 0; i < fb.count(); i++) {
+    uint32_t at = (uint32_t)i << 8;
+    uint32_t dist = at > pos ? at - pos : pos - at;
+    uint32_t k = dist >= widthQ8 ? 0 : 256 - (dist << 8) / widthQ8;   // 1 → 0 線性衰減（Q8）
+    uint16_t amp = (uint16_t)(baseAmp16 + (((int32_t)peakAmp16 - baseAmp16) * (int32_t)k >> 8));
+    fb.setPixel(i, c.R, c.G, c.B, amp);
+  }
+}
+
+}  // namespace ledfx
@@ -0,0 +1,68 @@
+#pragma once
+// ===== 逐顆 LED 的 framebuffer（double buffer + dirty 偵測）=====
+// 以前兩條燈條都是 ClearTo(一個顏色)，只能改整條亮度。這裡每顆燈有自己的線性亮度，
+// 可以畫進度條、流光（chase）、漸層。
+//
+// 一幀的流程：
+//   1. 效果函數（ledfx::*）把這一幀畫進 back buffer（線性亮度 Q16，還沒 gamma）
+//   2. present()：跟上一幀比，一模一樣 → 直接結束（不 gamma、不 dither、不 Show）
+//                 不一樣 → gamma + dithering 成 8-bit，再跟目前燈上的值比，
+//                          有變才回 true，呼叫端才需要 SetPixelColor + Show()
+// 靜態畫面（例如 hold 進度條停住時）就完全不會碰 stripL 那段阻塞 ~150µs 的 bit-bang
+
+#include "hal.h"
+#include "led_lut.h"
+
+// 線性亮度（Q16，0~65535 = 0~1，peak / gamma 之前）
+struct LinColor {
+  uint16_t r, g, b;
+};
+
+class LedFrameBuffer {
+ public:
+  static const uint8_t kMaxPixels = 16;
+
+  explicit LedFrameBuffer(uint8_t count);
+
+  uint8_t count() const { return count_; }
+
+  // ---- 畫進 back buffer ----
+  void setPixel(uint8_t i, uint8_t r, uint8_t g, uint8_t b, uint16_t amp16);
+  void fill(uint8_t r, uint8_t g, uint8_t b, uint16_t amp16);
+  // 從第一顆到最後一顆，顏色 / 亮度線性漸變
+  void gradient(RgbColor from, uint16_t fromAmp16, RgbColor to, uint16_t toAmp16);
+
+  // ---- 輸出 ----
+  // 回 true = 燈上的 8-bit 值有變，需要 Show()
+  bool present(const ledlut::Table& gamma, bool dither);
+  RgbColor pixel(uint8_t i) const { return shown_[i]; }
+  // 下一次 present() 不管有沒有變都重算 + 回 true（剛初始化 / 模式切換時用）
+  void invalidate() { forceNext_ = true; }
+
+ private:
+  uint8_t count_;
+  LinColor bufA_[kMaxPixels];
+  LinColor bufB_[kMaxPixels];
+  LinColor* back_;
+  LinColor* front_;
+  RgbColor shown_[kMaxPixels];
+  uint8_t ditherErr_[kMaxPixels][3];
+  bool forceNext_ = true;
+};
+
+// ===== 效果 =====
+// 每個效果都會寫滿整條 back buffer
+namespace ledfx {
+
+// 整條同色
+inline void solid(LedFrameBuffer& fb, RgbColor c, uint16_t amp16) { fb.fill(c.R, c.G, c.B, amp16); }
+
+// 進度條：progress16（Q16）對應填滿幾顆；已填的是 fillAmp，未填的是 baseAmp，
+// 邊界那顆依覆蓋比例內插，所以進度是連續長出來的，不會一顆一顆跳
+void progressBar(LedFrameBuffer& fb, RgbColor c, uint16_t progress16, uint16_t baseAmp16, uint16_t fillAmp16);
+
+// 流光：一個亮點沿燈條來回跑（periodMs 跑一趟），亮點兩側 widthQ8/256 顆內線性衰減
+void chase(LedFrameBuffer& fb, RgbColor c, unsigned long nowMs, uint16_t periodMs, uint16_t baseAmp16,
+           uint16_t peakAmp16, uint16_t widthQ8);
+
+}  // namespace ledfx
@@ -0,0 +1,137 @@
+#pragma once
+// ===== LED 呼吸燈：編譯期查表 + 定點運算 =====
+// ESP8266 沒有 FPU，原本每幀 expf + sinf + 3 次 powf 全是軟體浮點，而且跑在 Ticker 裡跟 WiFi 搶時間。
+// 這裡把兩條曲線在「編譯期」算成表，放 flash：
+//   BREATH_TABLE：exp(sin(t)) 正規化到 0~1（Q16），一個週期 256 格
+//   GAMMA_TABLE ：x(0~1) → (x × LED_PEAK)^2.2 × 255，輸出 8.8 定點（低 8 bit 給 dithering 用）
+// 執行期只剩整數乘法 + 線性內插。
+// 編譯期用的 sin / exp / ln 是下面自己寫的 constexpr 版本（標準庫的不是 constexpr），只在 build 時算一次。
+
+#include "hal.h"
+
+#ifndef LED_LUT_GAMMA
+#define LED_LUT_GAMMA 2.2
+#endif
+
+namespace ledlut {
+
+// ---------- 編譯期數學 ----------
+constexpr double kPi = 3.14159265358979323846;
+constexpr double kLn2 = 0.69314718055994530942;
+
+constexpr double cSin(double x) {
+  // 先收斂到 [-pi, pi]，再用 Taylor 展開到 x^21
+  while (x > kPi) x -= 2.0 * kPi;
+  while (x < -kPi) x += 2.0 * kPi;
+  double term = x, sum = x;
+  for (int n = 1; n <= 10; n++) {
+    term *= -x * x / ((2.0 * n) * (2.0 * n + 1.0));
+    sum += term;
+  }
+  return sum;
+}
+
+constexpr double cExp(double x) {
+  // exp(x) = exp(x / 2^k)^(2^k)，讓 Taylor 的輸入夠小
+  int k = 0;
+  while (x > 0.5 || x < -0.5) { x /= 2.0; k++; }
+  double term = 1.0, sum = 1.0;
+  for (int n = 1; n <= 16; n++) {
+    term *= x / n;
+    sum += term;
+  }
+  for (; k > 0; k--) sum *= sum;
+  return sum;
+}
+
+constexpr double cLn(double x) {
+  // x = m × 2^e，m 在 [0.5, 1)；ln(m) 用 2·atanh((m-1)/(m+1)) 級數
+  int e = 0;
+  while (x >= 1.0) { x /= 2.0; e++; }
+  while (x < 0.5) { x *= 2.0; e--; }
+  double y = (x - 1.0) / (x + 1.0);
+  double y2 = y * y, term = y, sum = 0.0;
+  for (int n = 0; n < 30; n++) {
+    sum += term / (2.0 * n + 1.0);
+    term *= y2;
+  }
+  return 2.0 * sum + e * kLn2;
+}
+
+constexpr double cPow(double x, double y) { return x <= 0.0 ? 0.0 : cExp(y * cLn(x)); }
+
+// ---------- 表 ----------
+// 257 格：最後一格讓 index 255 也能直接跟下一格內插
+struct Table {
+  uint16_t v[257];
+};
+
+constexpr Table makeBreathTable() {
+  // Sebastian Sonntag 的自然呼吸公式：exp(sin(t))，輸出 1/e ~ e，正規化成 0~1
+  Table t{};
+  const double lo = cExp(-1.0), hi = cExp(1.0);
+  for (int i = 0; i <= 256; i++) {
+    double raw = (cExp(cSin(2.0 * kPi * i / 256.0)) - lo) / (hi - lo);
+    t.v[i] = (uint16_t)(raw * 65535.0 + 0.5);
+  }
+  return t;
+}
+
+constexpr Table makeGammaTable(double peak, double gamma) {
+  Table t{};
+  for (int i = 0; i <= 256; i++) {
+    double out = cPow(peak * i / 256.0, gamma) * 255.0 * 256.0;
+    t.v[i] = (uint16_t)(out > 65535.0 ? 65535.0 : out + 0.5);
+  }
+  return t;
+}
+
+// ---------- 執行期 ----------
+// pos16：0~65535 對應表的 0~256
+inline uint16_t lerp(const Table& table, uint16_t pos16) {
+  uint16_t i = pos16 >> 8;
+  uint16_t frac = pos16 & 0xFF;
+  uint16_t a = pgm_read_word(&table.v[i]);
+  uint16_t b = pgm_read_word(&table.v[i + 1]);
+  return (uint16_t)(a + (((int32_t)b - (int32_t)a) * frac >> 8));
+}
+
+// 把一個浮點常數（0~1）轉成 Q16，給 constexpr 用
+constexpr uint16_t q16(double v) { return (uint16_t)(v <= 0.0 ? 0 : v >= 1.0 ? 65535 : v * 65535.0 + 0.5); }
+
+// 時間 → 呼吸曲線（Q16）
+inline uint16_t breathAt(const Table& breath, unsigned long nowMs, uint16_t periodMs) {
+  uint32_t phase16 = ((uint32_t)(nowMs % periodMs) << 16) / periodMs;
+  return lerp(breath, (uint16_t)phase16);
+}
+
+// amp（Q16）在 [lo, hi] 之間隨呼吸曲線擺動
+inline uint16_t ampBetween(uint16_t lo, uint16_t hi, uint16_t breath16) {
+  return (uint16_t)(lo + (((uint32_t)(hi - lo) * breath16) >> 16));
+}
+
+// 基礎色 (0~255) × amp (Q16) → 線性亮度 (Q16)
+inline uint16_t scale(uint8_t base, uint16_t amp16) {
+  return (uint16_t)(((uint32_t)base * 257u * amp16) >> 16);
+}
+
+// 線性亮度 (Q16) → gamma → 8-bit PWM
+// ditherErr 存上一幀被捨去的小數（一階 sigma-delta），讓 LED_FLOOR 附近的低亮度不會一格一格跳
+inline uint8_t renderLinear(const Table& gamma, uint16_t x16, uint8_t* ditherErr) {
+  uint32_t v88 = lerp(gamma, x16);
+  if (ditherErr) {
+    v88 += *ditherErr;
+    *ditherErr = (uint8_t)(v88 & 0xFF);
+  } else {
+    v88 += 0x80;   // 不 dither 就四捨五入
+  }
+  uint32_t out = v88 >> 8;
+  return (uint8_t)(out > 255 ? 255 : out);
+}
+
+// 單一色版：基礎色 (0~255) × amp (Q16) → gamma → 8-bit PWM
+inline uint8_t renderChannel(const Table& gamma, uint8_t base, uint16_t amp16, uint8_t* ditherErr) {
+  return renderLinear(gamma, scale(base, amp16), ditherErr);
+}
+
+}  // namespace ledlut
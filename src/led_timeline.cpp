@@ -0,0 +1,148 @@
+#include "led_timeline.h"
+
+#include <string.h>
+
+namespace {
+
+int8_t hexNibble(char c) {
+  if (c >= '0' && c <= '9') return (int8_t)(c - '0');
+  if (c >= 'a' && c <= 'f') return (int8_t)(c - 'a' + 10);
+  if (c >= 'A' && c <= 'F') return (int8_t)(c - 'A' + 10);
+  return -1;
+}
+
+// 差值 ×t16 最大到 65535²，超過 int32
+uint16_t lerp16(uint16_t a, uint16_t b, uint16_t t16) {
+  return (uint16_t)(a + (((int64_t)b - (int64_t)a) * (int64_t)t16 >> 16));
+}
+
+uint8_t lerp8(uint8_t a, uint8_t b, uint16_t t16) {
+  return (uint8_t)(a + (((int32_t)b - (int32_t)a) * (int32_t)t16 >> 16));
+}
+
+}  // namespace
+
+bool LedTimeline::load(const uint8_t* keys, size_t length, uint8_t loopFrom, uint8_t loopTo) {
+  size_t count = length / kKeyBytes;
+  if (count == 0 || count > kMaxKeys || length % kKeyBytes != 0) return false;
+  bool loops = loopFrom != kNoLoop || loopTo != kNoLoop;
+  if (loops && !(loopFrom < loopTo && loopTo < count)) return false;
+
+  Track& t = tracks_[active_ ^ 1];
+  uint32_t at = 0;
+  for (size_t i = 0; i < count; i++) {
+    const uint8_t* p = keys + i * kKeyBytes;
+    if (p[5] >= EASE_COUNT) return false;
+    Key& k = t.keys[i];
+    k.r = p[0];
+    k.g = p[1];
+    k.b = p[2];
+    k.amp16 = (uint16_t)(p[3] * 257u);
+    k.fill16 = (uint16_t)(p[4] * 257u);
+    k.ease = p[5];
+    k.atMs = at;
+    at += (uint32_t)(p[6] | (p[7] << 8));
+  }
+  t.count = (uint8_t)count;
+  t.loopFrom = loops ? loopFrom : kNoLoop;
+  t.loopTo = loops ? loopTo : kNoLoop;
+  // 迴圈長度 0（區段裡每個 keyframe 都是 0ms）沒辦法播
+  if (loops && t.keys[t.loopTo].atMs == t.keys[t.loopFrom].atMs) return false;
+
+  playing_ = false;
+  active_ ^= 1;
+  return true;
+}
+
+bool LedTimeline::loadHex(const char* hex, uint8_t loopFrom, uint8_t loopTo) {
+  uint8_t bytes[kMaxKeys * kKeyBytes];
+  size_t length = 0;
+  for (; hex[0] && hex[1]; hex += 2) {
+    int8_t hi = hexNibble(hex[0]), lo = hexNibble(hex[1]);
+    if (hi < 0 || lo < 0 || length >= sizeof(bytes)) return false;
+    bytes[length++] = (uint8_t)((hi << 4) | lo);
+  }
+  if (hex[0]) return false;   // 奇數個字元
+  return load(bytes, length, loopFrom, loopTo);
+}
+
+bool LedTimeline::play(unsigned long nowMs, uint32_t offsetMs) {
+  if (!loaded()) return false;
+  startMs_ = nowMs - offsetMs;
+  playing_ = true;
+  return true;
+}
+
+void LedTimeline::seek(unsigned long nowMs, uint32_t positionMs) {
+  startMs_ = nowMs - positionMs;
+}
+
+uint32_t LedTimeline::durationMs() const {
+  const Track& t = tracks_[active_];
+  return t.count ? t.keys[t.count - 1].atMs : 0;
+}
+
+uint32_t LedTimeline::position(unsigned long nowMs) const {
+  const Track& t = tracks_[active_];
+  if (!t.count) return 0;
+  uint32_t pos = (uint32_t)(nowMs - startMs_);
+  if (t.loopTo != kNoLoop) {
+    uint32_t from = t.keys[t.loopFrom].atMs, to = t.keys[t.loopTo].atMs;
+    if (pos >= to) pos = from + (pos - from) % (to - from);
+    return pos;
+  }
+  uint32_t end = t.keys[t.count - 1].atMs;
+  return pos > end ? end : pos;
+}
+
+LedTimeline::Sample LedTimeline::sample(uint32_t positionMs) const {
+  const Track& t = tracks_[active_];
+  Sample s = { RgbColor(0, 0, 0), 0, 0 };
+  if (!t.count) return s;
+  // keyframe 最多 16 個，線性找就好
+  uint8_t i = 0;
+  while (i + 1 < t.count && t.keys[i + 1].atMs <= positionMs) i++;
+  const Key& a = t.keys[i];
+  if (i + 1 >= t.count) {
+    s.color = RgbColor(a.r, a.g, a.b);
+    s.amp16 = a.amp16;
+    s.fill16 = a.fill16;
+    return s;
+  }
+  const Key& b = t.keys[i + 1];
+  uint32_t span = b.atMs - a.atMs;
+  uint16_t t16 = ease(a.ease, (uint16_t)(((uint64_t)(positionMs - a.atMs) << 16) / span));
+  s.color = RgbColor(lerp8(a.r, b.r, t16), lerp8(a.g, b.g, t16), lerp8(a.b, b.b, t16));
+  s.amp16 = lerp16(a.amp16, b.amp16, t16);
+  s.fill16 = lerp16(a.fill16, b.fill16, t16);
+  return s;
+}
+
+void LedTimeline::render(LedFrameBuffer& fb, unsigned long nowMs) const {
+  Sample s = sample(position(nowMs));
+  ledfx::progressBar(fb, s.color, s.fill16, s.amp16, 65535);
+}
+
+// t16：0~65535 → 曲線上的 0~65535（整數多項式，不碰浮點）
+uint16_t LedTimeline::ease(uint8_t kind, uint16_t t16) {
+  uint32_t t = t16;
+  switch (kind) {
+    case EASE_STEP:
+      return 0;
+    case EASE_IN:
+      return (uint16_t)(t * t >> 16);
+    case EASE_OUT: {
+      uint32_t r = 65535 - t;
+      return (uint16_t)(65535 - (r * r >> 16));
+    }
+    case EASE_IN_OUT: {
+      // smoothstep：3t² - 2t³
+      uint32_t t2 = t * t >> 16;
+      uint32_t t3 = t2 * t >> 16;
+      int32_t v = (int32_t)(3 * t2) - (int32_t)(2 * t3);
+      return (uint16_t)(v < 0 ? 0 : v > 65535 ? 65535 : v);
+    }
+    default:
+      return t16;
+  }
+}
@@ -0,0 +1,81 @@
+#pragma once
+// ===== 燈條 keyframe timeline（firmware 自己內插）=====
+// 以前 hold 的 5 秒裡前端每 100ms 推一個 led_progress，燈條亮多少完全看 WiFi：
+// 一個封包晚到，進度條就停一下再跳過去，還一直佔著 WS。
+// 現在前端連線時上傳一次 timeline（幾個 keyframe + 迴圈區段），之後只送 play / seek / stop，
+// updateLeds() 每幀用 millis() 算目前在 timeline 的哪裡、自己內插；Ticker 晚了也只是畫晚一點的那一幀，不會累積誤差。
+//
+// keyframe i 在時間 T(i) 是這個樣子，然後花 ms 用 ease 曲線變到 keyframe i+1：
+//   顏色 r g b、amp（整體亮度）、fill（進度條填滿的比例，填滿的段滿亮度，見 ledfx::progressBar）
+// 最後一個 keyframe 的 ms 不用。有迴圈區段 [loopFrom, loopTo) 的話，播到 T(loopTo) 就跳回 T(loopFrom)；
+// 沒有就停在最後一個 keyframe。
+//
+// 上傳格式（WS 的 JSON 是 hex 字串、二進位是原始 bytes，見 ws_binary.h）每個 keyframe 8 bytes：
+//   [r][g][b][amp 0~255][fill 0~255][ease][ms u16 little-endian]
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "led_engine.h"
+
+class LedTimeline {
+ public:
+  static const uint8_t kMaxKeys = 16;
+  static const size_t kKeyBytes = 8;
+  static const uint8_t kNoLoop = 0xFF;
+
+  enum Ease : uint8_t { EASE_STEP, EASE_LINEAR, EASE_IN, EASE_OUT, EASE_IN_OUT, EASE_COUNT };
+
+  // 某個時間點的樣子（amp / fill 是 Q16）
+  struct Sample {
+    RgbColor color;
+    uint16_t amp16;
+    uint16_t fill16;
+  };
+
+  // 載入新的 timeline（停止播放）；格式不對回 false，原本的 timeline 不動
+  bool load(const uint8_t* keys, size_t length, uint8_t loopFrom, uint8_t loopTo);
+  // 同上，keys 是 hex 字串（JSON 用）
+  bool loadHex(const char* hex, uint8_t loopFrom, uint8_t loopTo);
+
+  // 從 offsetMs 開始播（hold 中斷後接著播就帶已經累積的時間）
+  bool play(unsigned long nowMs, uint32_t offsetMs);
+  // 播放中跳到 positionMs
+  void seek(unsigned long nowMs, uint32_t positionMs);
+  void stop() { playing_ = false; }
+
+  bool loaded() const { return tracks_[active_].count > 0; }
+  bool playing() const { return playing_; }
+  uint8_t keyCount() const { return tracks_[active_].count; }
+  // 最後一個 keyframe 的時間
+  uint32_t durationMs() const;
+
+  // 目前在 timeline 的哪裡（已經套用迴圈 / 停在結尾）
+  uint32_t position(unsigned long nowMs) const;
+  Sample sample(uint32_t positionMs) const;
+  // 把 nowMs 這一幀畫進 back buffer
+  void render(LedFrameBuffer& fb, unsigned long nowMs) const;
+
+ private:
+  struct Key {
+    uint8_t r, g, b;
+    uint8_t ease;
+    uint16_t amp16;
+    uint16_t fill16;
+    uint32_t atMs;   // T(i)：從頭算起的時間
+  };
+  struct Track {
+    Key keys[kMaxKeys];
+    uint8_t count;
+    uint8_t loopFrom;
+    uint8_t loopTo;
+  };
+
+  static uint16_t ease(uint8_t kind, uint16_t t16);
+
+  // 兩份輪流用：新的寫進沒在用的那份再切過去，Ticker 不會畫到寫一半的 timeline
+  Track tracks_[2] = {};
+  volatile uint8_t active_ = 0;
+  volatile bool playing_ = false;
+  volatile unsigned long startMs_ = 0;
+};
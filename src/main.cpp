@@ -1,12 +1,26 @@
-#include <ESP8266WiFi.h>
-#include <WebSocketsServer.h>
-#include <SPI.h>
-#include <PN532_SPI.h>
-#include <PN532.h>
-#include <NfcAdapter.h>
-#include <string.h>
-#include <NeoPixelBus.h>
-#include <Ticker.h>
+// 所有硬體 / library header 都經過 HAL 選擇（ESP8266 實機 or native 模擬），見 hal.h
+#include "hal.h"
+#include "quote_uid_index.h"
+#include "json_reader.h"
+#include "json_writer.h"
+#include "led_lut.h"
+#include "led_engine.h"
+#include "led_timeline.h"
+#include "pn532_async.h"
+#include "ws_binary.h"
+#include "event_queue.h"
+#include "write_queue.h"
+#include "ntag_writer.h"
+#include "ndef_encoder.h"
+#include "type4_emulator.h"
+#include "quote_ndef_image.h"
+#include "tag_presence.h"
+#include "hold_tracker.h"
+#include "hot_path_profiler.h"
+#include "scheduler.h"
+#include "ws_sessions.h"
+#include "scan_journal.h"
+#include "wifi_connector.h"
 
 // ===== WiFi 模式選擇 =====
 // true  = AP 模式（ESP8266 創建自己的 WiFi）
@@ -21,16 +35,35 @@ const char* ap_password = "nfc12345";
 const char* sta_ssid = "BERNARD-LAPTOP";
 const char* sta_password = "550V1!5t";
 
+// 重連時連 DHCP 也省掉：直接用上次拿到的 IP（WiFi.config）。一般 router 可以開；
+// Windows 行動熱點 (ICS) 會擋掉固定 IP，所以預設關，只省掃描（見 wifi_connector.h）
+#ifndef WIFI_REUSE_LEASE
+#define WIFI_REUSE_LEASE false
+#endif
+
 // ===== WebSocket 設定 =====
 #define WS_PORT 81
 WebSocketsServer webSocket = WebSocketsServer(WS_PORT);
+// 收到的 text frame 在 Serial 上最多印幾個字（serialPrintf 的 stack buffer 放得下，後面接 "…"）
+const size_t WS_ECHO_MAX = 120;
 
 // ===== PN532 NFC 設定 =====
 // PN532 的 SS / SDA / CS 接到 NodeMCU 的 D2 (GPIO4)
 #define PN532_SS D2
+// PN532 的 IRQ 腳（選配）。-1 = 沒接，改成每次 poll 讀一次 SPI status byte
+#ifndef PN532_IRQ
+#define PN532_IRQ -1
+#endif
 PN532_SPI pn532spi(SPI, PN532_SS);
 NfcAdapter nfc(pn532spi);
-PN532 pn532(pn532spi);  // 低階 PN532，用來做 tag emulation
+// 掃描用的非同步驅動（見 pn532_async.h）：InListPassiveTarget 送出去就回來，結果在之後的 loop 收
+// 非 NTAG 卡的 NDEF 讀寫仍走上面的 Seeed 同步 API，用之前要先 nfcReader.cancel()
+Pn532SpiTransport pn532Bus(SPI, PN532_SS, PN532_IRQ);
+Pn532Async nfcReader(pn532Bus);
+// 燒錄 NTAG 直接下 WRITE / FAST_READ（見 ntag_writer.h），跟掃描共用同一個 Pn532Async
+NtagWriter ntagWriter(nfcReader);
+// Type 4 tag 模擬（見 type4_emulator.h）：也走同一個 Pn532Async，模擬期間不掃描
+Type4Emulator tagEmulator(nfcReader);
 
 // ===== NFC 卡片類型定義 =====
 enum NFCType {
@@ -42,24 +75,106 @@ enum NFCType {
 // ===== 特殊卡片 UID =====
 // 萬用卡：在「等待抽籤」頁觸發隨機抽雞湯；在「差最後一步」掃描頁 / quote panel 開啟時，
 // 也能當作任意瓶子完成 5 秒解鎖。前端判斷在 js/nfc.js handleRandomQuote。
-const String WILDCARD_NFC_UID = "04:83:D5:22:BF:2A:81";
+const uint8_t WILDCARD_NFC_UID[7] = { 0x04, 0x83, 0xD5, 0x22, 0xBF, 0x2A, 0x81 };
 
 // AI 解鎖卡：「只」在 chat-result-view 用來把粒子散開、揭曉 AI 生成的雞湯。
 // 在其他頁面掃這張卡會被忽略（不會觸發隨機抽籤、不會當萬用瓶子）。
-const String AI_NFC_UID = "04:A4:68:97:CC:2A:81";
+const uint8_t AI_NFC_UID[7] = { 0x04, 0xA4, 0x68, 0x97, 0xCC, 0x2A, 0x81 };
 
 // ===== 開發 fallback =====
 // true 時 firmware 一律把任何卡當 wildcard（早期沒有實體 context 卡時用）。
 // 正式展覽請保持 false。
 #define TEST_ALL_AS_TRIGGER false
 
-// 儲存上次讀取的 UID，避免重複觸發
-String lastUID = "";
-bool clientConnected = false;
-
-// 時間窗口控制：同一張卡片需要間隔一定時間才能再次觸發
-unsigned long lastTriggerTime = 0;  // 上次觸發的時間戳
-const unsigned long TRIGGER_COOLDOWN = 1500;  // 冷卻時間（毫秒），1.5秒後可以再掃
+// 每個 client 收哪種 frame（連線時 URL 帶 ?proto=bin 的走二進位，見 ws_binary.h）、訂了哪些主題（見 ws_sessions.h）
+WsSessions wsSessions;
+static_assert(WEBSOCKETS_SERVER_CLIENT_MAX <= WsSessions::kMaxClients, "WsSessions 的格子不夠");
+
+// ===== 主迴圈的 task（見 scheduler.h）=====
+// 週期 / 容許延遲（µs）；優先序：Serial（燒錄指令）> NFC = WebSocket（同級比截止時間）> WiFi > 心跳
+// NFC 的週期決定「卡放上 → InList 回應被讀到」最多多等多久；卡還在時由 taskNfc 自己 defer 到下一次 recheck
+#ifndef TASK_NFC_PERIOD_US
+#define TASK_NFC_PERIOD_US 250
+#endif
+#ifndef TASK_WS_PERIOD_US
+#define TASK_WS_PERIOD_US 1000
+#endif
+#ifndef TASK_SERIAL_PERIOD_US
+#define TASK_SERIAL_PERIOD_US 5000
+#endif
+const uint32_t TASK_WIFI_PERIOD_US = 500000;
+const uint32_t TASK_HEARTBEAT_PERIOD_US = 2000000;
+const uint32_t TASK_JOURNAL_PERIOD_US = 250000;
+// hold 計時：完成最多晚這麼多才送 hold_complete
+const uint32_t TASK_HOLD_PERIOD_US = 20000;
+// 連線中 WiFi task 每 50ms 看一次狀態（平常 500ms）：直連 300ms 就連上，不要白等半個週期
+const uint32_t TASK_WIFI_CONNECTING_US = 50000;
+
+Scheduler scheduler;
+int nfcTaskId = -1;
+
+// loop() / webSocket.loop() / NFC / LED 各段的 cycle 直方圖，Serial STATS 或 {"type":"stats"} 查詢
+HotPathProfiler profiler;
+
+// 記住上次的 AP（BSSID / channel），開機 / 斷線重連先直連、不掃描（見 wifi_connector.h）
+WifiConnector wifiConnector;
+// 開機到 WiFi 連上（可以接 WebSocket）花了多久；還沒連上 = 0
+unsigned long bootReadyMs = 0;
+
+// 這一輪 loop() 產生、還沒送出的事件；loop() 結束時合成一個帶 seq 的 frame（見 event_queue.h）
+EventQueue outboundEvents;
+
+// 送出的每個事件 frame 都記一份（LittleFS），斷線重連的 client 用 {"type":"replay"} 補拿（見 scan_journal.h）
+ScanJournal scanJournal;
+// 一次 replay 最多補幾個 frame（一個 frame 一次 TCP send）；還有就回 more，client 接著要
+const size_t REPLAY_BATCH = 16;
+
+// 一次 InListPassiveTarget 最多等卡多久（毫秒）。等的期間 loop 照跑，
+// 所以這個值只決定「卡拿走之後多久判定沒卡」（nfc_hold_end 的延遲）
+// 可以在 platformio.ini 的 build_flags 用 -D NFC_INLIST_TIMEOUT_MS=xx 覆蓋，
+// 再用 [env:native] 的 benchmark 看 tap → broadcast 延遲的變化
+#ifndef NFC_INLIST_TIMEOUT_MS
+#define NFC_INLIST_TIMEOUT_MS 200
+#endif
+// 卡還在的時候，隔多久再確認一次（毫秒）；不用每幾 ms 就重選一次卡、讓 RF 一直忙
+#ifndef NFC_PRESENT_RECHECK_MS
+#define NFC_PRESENT_RECHECK_MS 50
+#endif
+
+// 一次 InList 最多選幾張卡（1 或 2）。感應區上可以同時放兩個瓶子，各自觸發 / 各自 hold_end
+// 只有一張卡時 MaxTg = 2 的 InList 會多花約 1ms 找第二張
+#ifndef NFC_MAX_TARGETS
+#define NFC_MAX_TARGETS 2
+#endif
+// 連續幾次 InList 看到同一張卡才算放上（1 = 第一次看到就觸發）
+#ifndef NFC_ENTER_HITS
+#define NFC_ENTER_HITS 1
+#endif
+// 最後一次看到之後多久沒再看到才算拿走（毫秒）。兩張卡時 PN532 偶爾只選到其中一張，
+// 比 NFC_PRESENT_RECHECK_MS 的兩輪長一點就不會閃出 hold_end + hold_start
+#ifndef NFC_LEAVE_MS
+#define NFC_LEAVE_MS 120
+#endif
+
+// 感應區上的卡：每張 UID 各自的進場 / 離場（見 tag_presence.h）
+// 同一張卡持續放著只觸發一次，要重觸發需移開再放回
+TagPresence tagPresence(NFC_ENTER_HITS, NFC_LEAVE_MS);
+
+// 揭曉要拿著瓶子多久（毫秒）；前端的 hold_target 可以帶 ms 覆蓋
+#ifndef HOLD_REQUIRED_MS
+#define HOLD_REQUIRED_MS 5000
+#endif
+// 拿走之後多久內放回來算讀卡閃斷、不暫停（毫秒）。要比 NFC_LEAVE_MS 長，不然 hold_end 一出來就暫停了
+#ifndef NFC_HOLD_GRACE_MS
+#define NFC_HOLD_GRACE_MS 600
+#endif
+// hold_progress 最多多久送一次（毫秒）；前端的進度條在兩次之間自己補動畫
+#ifndef HOLD_PROGRESS_INTERVAL_MS
+#define HOLD_PROGRESS_INTERVAL_MS 250
+#endif
+
+// 前端 hold_target 指定要等哪一瓶，之後 5 秒 hold 在 firmware 計時（見 hold_tracker.h）
+HoldTracker holdTracker(NFC_HOLD_GRACE_MS, HOLD_PROGRESS_INTERVAL_MS);
 
 // ===== 當前狀態追蹤 =====
 int currentQuoteNumber = -1;  // 當前顯示的雞湯編號（由前端更新）
@@ -69,8 +184,23 @@ bool waitingForBlankNFC = false;  // 是否等待空白 NFC 卡片進行寫入
 // 送 "WRITE:https://..." 進入等待狀態，偵測到 NFC 就燒錄
 // 送 "CANCEL" 取消；任何時候送 "STATUS" 查詢目前狀態
 bool serialWriteMode = false;
-String serialPendingURL = "";
-String serialBuffer = "";
+// 一行 Serial 指令最長幾個字（WRITE: / QUEUE: + URL）；超過的整行丟掉，回 ERR:line_too_long
+// 固定 buffer：以前 String 每收一個字元就長一次，一行 URL 要 malloc 三四十次（--msg-bench 量到的）
+#ifndef SERIAL_LINE_MAX
+#define SERIAL_LINE_MAX 256
+#endif
+char serialPendingURL[SERIAL_LINE_MAX + 1] = "";
+char serialLine[SERIAL_LINE_MAX + 1];
+size_t serialLineLength = 0;
+bool serialLineOverflow = false;
+
+// QUEUE: / START 的批次佇列（見 write_queue.h）；batchRunning 時 reader 只負責燒錄，不走 WebSocket 流程
+WriteQueue writeQueue;
+BatchStats batchStats;
+bool batchRunning = false;
+// 最後一張處理過的卡，拿走（InList 沒卡）才清掉，避免同一張卡還放著就被寫成下一個 URL
+uint8_t batchLastUID[7];
+uint8_t batchLastUIDLength = 0;
 
 // ===== WS2812 燈條設定（左右各一條，同步控制） =====
 // 左條：D1 (GPIO5)  右條：D4 (GPIO2)
@@ -83,8 +213,20 @@ String serialBuffer = "";
 // 每次 WiFi/NFC 中斷都會干擾 bit-bang 時序，導致 LED 跳色 / 閃爍。
 // NeoEsp8266Uart1Ws2812xMethod 直接用 UART1 硬體電路產生波形，
 // 完全不靠 CPU，不會被任何中斷干擾。UART1 TX 固定在 GPIO2 (D4)。
-// D1 (stripL) 沒對應硬體腳，只能 bit-bang，仍可能受干擾（但 D1 那條燈條是備用）
-#define LED_PIN_L      D1
+// D1 (stripL) 沒對應硬體腳，預設只能 bit-bang，仍可能受干擾（但 D1 那條燈條是備用）
+//
+// stripL 的驅動方式（LED_L_DRIVER，build flag 可覆蓋，[env:nodemcuv2_dma] 就是切到 DMA）：
+//   LED_L_BITBANG  D1，CPU bit-bang：Show() 佔 CPU ~150µs + 中斷全關，WiFi NMI 還是會打斷
+//   LED_L_DMA      I2S DMA，data 固定從 GPIO3 (RX) 出：燈條 data 線要從 D1 改接 RX，
+//                  Show() 只是把顏色編進 DMA buffer，硬體背景送出，不佔 CPU 也不怕 NMI。
+//                  代價：Serial 只剩 TX（log 照印），USB 下的燒錄指令（QUEUE / START / STATS ...）收不到
+// UART0 不列入：UART0 TX 就是 Serial 的 log，swap 之後 RX 會搬到 GPIO13 = PN532 的 MOSI
+#define LED_L_BITBANG  0
+#define LED_L_DMA      1
+#ifndef LED_L_DRIVER
+#define LED_L_DRIVER   LED_L_BITBANG
+#endif
+#define LED_PIN_L      D1   // 只有 bit-bang 用得到；DMA 的 pin 是硬體固定的
 #define LED_PIN_R      D4   // 註：UART1 method 不會用到這個 #define，pin 是硬體固定的
 #define LED_COUNT_L    5
 #define LED_COUNT_R    5
@@ -93,6 +235,12 @@ String serialBuffer = "";
 // 呼吸到最暗時保留多少底光（0~1）。太低 + gamma 校正後會接近熄滅；想永不熄滅拉到 0.35+
 #define LED_FLOOR      0.30f
 
+// 幀間隔（毫秒）。呼吸曲線 / gamma 改成查表之後每幀只剩整數運算，
+// 從之前為了讓 WiFi 喘息的 33ms (30fps) 拉回 20ms (50fps)；實際每幀花多少 cycle 會印在 [scan] 心跳那行
+#define LED_FRAME_MS   20
+// 低亮度 temporal dithering：gamma 後的小數部分逐幀累積，避免 LED_FLOOR 附近一階一階跳
+#define LED_DITHER     true
+
 // ⚠ 隔離測試開關：false = 只跑 D4 (stripR)，D1 完全不動
 // 用來確認 D4 的 UART1 在「沒有 D1 bit-bang 干擾」時是否完全乾淨
 // 測完後改回 true 把 D1 加回來
@@ -100,8 +248,13 @@ String serialBuffer = "";
 
 // stripR：D4 = GPIO2，UART1 硬體驅動 → 完全不被中斷干擾
 NeoPixelBus<NeoGrbFeature, NeoEsp8266Uart1Ws2812xMethod> stripR(LED_COUNT_R);
-// stripL：D1 = GPIO5，沒硬體腳，只能 bit-bang
-NeoPixelBus<NeoGrbFeature, NeoEsp8266BitBangWs2812xMethod> stripL(LED_COUNT_L, LED_PIN_L);
+// stripL：D1 = GPIO5 bit-bang，或 GPIO3 (RX) I2S DMA
+#if LED_L_DRIVER == LED_L_DMA
+typedef NeoEsp8266DmaWs2812xMethod StripLMethod;
+#else
+typedef NeoEsp8266BitBangWs2812xMethod StripLMethod;
+#endif
+NeoPixelBus<NeoGrbFeature, StripLMethod> stripL(LED_COUNT_L, LED_PIN_L);
 
 // Ticker：用軟體計時器把燈條更新獨立出來，不受主 loop 被 NFC SPI 卡住影響
 Ticker ledTicker;
@@ -116,56 +269,92 @@ LedMode ledMode = LED_IDLE;
 // AWAIT_SCAN 階段由前端推進度（0~1），對應掃描 hold 的 0~5 秒
 float ledHoldProgress = 0.0f;
 
+// 前端上傳的 keyframe timeline（led_timeline.h）：播放中蓋過上面的模式，由 updateLeds 自己內插
+LedTimeline ledTimeline;
+
 // 顏色 (RGB)
 const uint8_t IDLE_R = 255, IDLE_G = 255, IDLE_B = 255;       // 白色
 const uint8_t AMBER_R = 230, AMBER_G = 160, AMBER_B = 60;     // 暖琥珀
 // （await_scan 階段的整體亮度由 amp range 控制，目前 0.55~0.85）
 
+// 呼吸曲線 + gamma 表：編譯期由 LED_PEAK 算好放 flash（見 led_lut.h）
+constexpr ledlut::Table BREATH_TABLE PROGMEM = ledlut::makeBreathTable();
+constexpr ledlut::Table GAMMA_TABLE PROGMEM = ledlut::makeGammaTable(LED_PEAK, LED_LUT_GAMMA);
+
+// 各模式的 amp 範圍（Q16）
+constexpr uint16_t IDLE_AMP_LO     = ledlut::q16(LED_FLOOR);   // 底光 LED_FLOOR，不完全熄滅
+constexpr uint16_t IDLE_AMP_HI     = ledlut::q16(1.0);
+constexpr uint16_t AWAIT_AMP_LO    = ledlut::q16(0.55);
+constexpr uint16_t AWAIT_AMP_HI    = ledlut::q16(0.85);
+constexpr uint16_t REVEALED_AMP_LO = ledlut::q16(0.70);   // 底下的呼吸，上面再疊一道流光
+constexpr uint16_t REVEALED_AMP_HI = ledlut::q16(0.85);
+constexpr uint16_t REVEALED_CHASE_PEAK = ledlut::q16(1.0);
+constexpr uint16_t REVEALED_CHASE_WIDTH_Q8 = 384;            // 流光半寬 1.5 顆
+
+// 逐顆 framebuffer：兩條燈條顯示同一個畫面（各自取前 N 顆）
+// 只有畫面真的變了才 Show()，靜態畫面不會碰 stripL 的阻塞 bit-bang
+LedFrameBuffer ledFrame(LED_COUNT_L > LED_COUNT_R ? LED_COUNT_L : LED_COUNT_R);
+volatile uint32_t ledFramesShown = 0;     // 這 2 秒實際 Show() 了幾幀
+volatile uint32_t ledFramesSkipped = 0;   // 畫面沒變、省掉 Show() 的幀數
+
+// 每幀成本（ESP.getCycleCount，80MHz 下 80 cycle = 1µs）
+// render = 算顏色；frame = 算顏色 + 兩條 Show()。max 在每次印出後歸零
+volatile uint32_t ledRenderCycles = 0;
+volatile uint32_t ledRenderCyclesMax = 0;
+volatile uint32_t ledFrameCyclesMax = 0;
+
 // ===== NFC Tag 模擬狀態 =====
-// 收到 WebSocket 指令後，PN532 切成 Type 4 tag，讓觀眾手機讀取 URL
+// 收到 WebSocket 指令後，PN532 切成 Type 4 tag，讓觀眾的 Android 手機讀取 URL
 bool emulateMode = false;
 unsigned long emulateStartTime = 0;
 const unsigned long EMULATE_TIMEOUT_MS = 30000;  // 30 秒沒人感應就退出
 
-uint8_t ndefBuffer[512];      // 含 2-byte 長度前綴的 NDEF file 內容
+// NDEF file 內容（NLEN + message），手機的 READ BINARY 直接從這裡切
+// 前端分享卡片的網址最長 840 字（js/main.js shareCardViaNFC），編成 long record 約 850 bytes
+uint8_t ndefBuffer[1024];
 uint16_t ndefBufferLen = 0;
-uint16_t selectedFile = 0;    // 目前被 SELECT 的檔案 ID (0xE103=CC, 0xE104=NDEF)
-
-// Type 4 tag 的 CC (Capability Container) file，固定 15 bytes
-const uint8_t CC_FILE[15] = {
-  0x00, 0x0F,              // CCLEN = 15
-  0x20,                    // Mapping version 2.0
-  0x00, 0x7F,              // MLe (max R-APDU data) = 127
-  0x00, 0x7F,              // MLc (max C-APDU data) = 127
-  0x04, 0x06,              // NDEF File Control TLV: T=0x04, L=0x06
-  0xE1, 0x04,              // NDEF file ID = 0xE104
-  0x01, 0xFF,              // Max NDEF file size = 511
-  0x00,                    // Read access: free
-  0xFF                     // Write access: no write
-};
-
-// NDEF Tag Application AID
-const uint8_t AID_NDEF[7] = { 0xD2, 0x76, 0x00, 0x00, 0x85, 0x01, 0x01 };
 
 // ===== 網站 URL 設定 =====
 const char* QUOTE_BASE_URL = "https://thekingofchickensoup.framer.website/quotes/quote";
 
 // ===== 函數宣告 =====
 void handleSerialCommands();
+void handleSerialCommand(char* cmd);
 void setupWiFi();
+void printWiFiHelp();
 void webSocketEvent(uint8_t num, WStype_t type, uint8_t * payload, size_t length);
-String getUIDString(byte* uid, byte uidLength);
-NFCType detectNFCType(String uid);
+void broadcastEvent(const char* json, size_t jsonLength, const uint8_t* bin, size_t binLength);
+void broadcastEvent(const char* json, uint8_t opcode);
+void flushEvents();
+void taskSerial();
+void taskWiFi();
+void taskWebSocket();
+void taskNfc();
+void taskHeartbeat();
+void taskJournal();
+void taskHold();
+void trackHold(const TagPresence::Event& event);
+void queueTagEvent(const TagPresence::Event& event);
+void logTagEvent(const TagPresence::Event& event);
+void serialPrintf(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+NFCType detectNFCType(const uint8_t* uid, uint8_t uidLength);
 void sendRandomQuote();
 bool writeURLToNFC(int quoteNumber);
-void sendWriteResult(bool success, int quoteNumber, String errorMsg = "");
-void buildNDEFFromURL(const String& url);
+bool writeAndVerifyURL(const char* url, const char** failReason);
+bool writeAndVerifyNdefMessage(const char* url, const char** failReason);
+void handleBatchTag();
+void printBatchStats(const char* label);
+void printProfilerStats();
+void sendWriteResult(bool success, const char* url, const char* errorMsg = "");
+void sendToTopic(WsTopic topic, const char* json, size_t length);
+void sendToTopic(WsTopic topic, const char* json);
+void sendToTopic(WsTopic topic, const char* json, size_t jsonLength, const uint8_t* bin, size_t binLength);
+size_t buildStatsJson(char* json, size_t capacity);
 bool startTagEmulation();
 void stopTagEmulation();
 void handleEmulationStep();
 void initLeds();
 void updateLeds();
-String extractStringField(const String& msg, const char* key);
 
 // ===== 設定 =====
 void setup() {
@@ -176,10 +365,9 @@ void setup() {
   // ⚠ LED 初始化必須最先做，這樣即使後面 WiFi 連不上 / PN532 沒插，
   // 燈條還是能正常運作（LED 等不及 setup 跑完，預設會卡在 power-on 全亮白）
   initLeds();
-  // 30fps（33ms 間隔）— 比 50fps 給 WiFi 多一倍喘息空檔，跳閃機率明顯降低
-  // 呼吸用 30fps 視覺上看不出差別
-  ledTicker.attach_ms(33, updateLeds);
-  Serial.println("LEDs ready (L=D1, R=D4) — ticker 30fps");
+  // 查表版每幀只剩整數運算，給得起 50fps（LED_FRAME_MS）
+  ledTicker.attach_ms(LED_FRAME_MS, updateLeds);
+  Serial.printf("LEDs ready (L=D1, R=D4) — ticker %dfps\n", 1000 / LED_FRAME_MS);
 
   // 初始化 WiFi
   setupWiFi();
@@ -192,8 +380,31 @@ void setup() {
   // 初始化 NFC（沒插 PN532 也不會 hang，但讀卡功能會 disable）
   Serial.println("Initializing NFC reader...");
   nfc.begin();
+  nfcReader.begin();
   Serial.println("NFC reader ready!");
 
+  // journal：接著上次開機的 seq 編，重開機前沒送到的事件也還能 replay
+  if (scanJournal.begin()) {
+    outboundEvents.resumeAfter(scanJournal.lastSeq());
+    if (scanJournal.lastSeq()) {
+      Serial.printf("Journal：seq %u..%u，接著編\n", (unsigned)scanJournal.firstSeq(), (unsigned)scanJournal.lastSeq());
+    }
+  } else {
+    Serial.println("⚠ LittleFS 掛不上，journal 只留在 RAM（重開機就沒了）");
+  }
+
+  profiler.begin(millis());
+  Serial.printf("Profiler ready（一次 probe 約 %u cycles）\n", (unsigned)profiler.recordCost());
+
+  scheduler.add("serial", taskSerial, TASK_SERIAL_PERIOD_US, 4 * TASK_SERIAL_PERIOD_US, 3);
+  nfcTaskId = scheduler.add("nfc", taskNfc, TASK_NFC_PERIOD_US, 5 * TASK_NFC_PERIOD_US, 2);
+  scheduler.add("ws", taskWebSocket, TASK_WS_PERIOD_US, 10 * TASK_WS_PERIOD_US, 2);
+  scheduler.add("wifi", taskWiFi, TASK_WIFI_PERIOD_US, TASK_WIFI_PERIOD_US, 1);
+  scheduler.add("heartbeat", taskHeartbeat, TASK_HEARTBEAT_PERIOD_US, TASK_HEARTBEAT_PERIOD_US / 4, 0,
+                TASK_HEARTBEAT_PERIOD_US);
+  scheduler.add("journal", taskJournal, TASK_JOURNAL_PERIOD_US, TASK_JOURNAL_PERIOD_US, 0);
+  scheduler.add("hold", taskHold, TASK_HOLD_PERIOD_US, TASK_HOLD_PERIOD_US, 1);
+
   Serial.println("\n系統初始化完成！");
   Serial.println("========================================\n");
 }
@@ -201,81 +412,88 @@ void setup() {
 // ===== WS2812 燈條 =====
 void initLeds() {
   if (ENABLE_STRIP_L) {
+    // DMA 的 Begin() 會把 GPIO3 從 UART0 RX 搶走，所以要在 Serial.begin() 之後
     stripL.Begin();
     stripL.ClearTo(RgbColor(0, 0, 0)); stripL.Show();
+#if LED_L_DRIVER == LED_L_DMA
+    Serial.println("stripL：I2S DMA（GPIO3），Serial 指令停用");
+#endif
   }
   // NeoPixelBus 沒有 setBrightness，亮度在 updateLeds 用 LED_PEAK + gamma 直接算
   stripR.Begin();
   stripR.ClearTo(RgbColor(0, 0, 0)); stripR.Show();
 }
 
-// gamma 2.2 校正：把 0~1 的感知亮度 → 實際 PWM 值 0~255
-// 人眼對亮度是對數反應，直接輸出 sin 會讓低亮度段跳很大
-static inline uint8_t gammaByte(float v) {
-  if (v <= 0.0f) return 0;
-  if (v >= 1.0f) return 255;
-  return (uint8_t)(powf(v, 2.2f) * 255.0f + 0.5f);
-}
-
-// 依 ledMode 更新兩條燈條
-// 由 Ticker 每 20ms 呼叫一次（50 fps），不依賴主 loop
-// 用 exp(sin) 自然呼吸曲線 + gamma 校正
+// 依 ledMode（或播放中的 ledTimeline）畫一幀到 ledFrame，有變才送到兩條燈條
+// 由 Ticker 每 LED_FRAME_MS 呼叫一次，不依賴主 loop
+// exp(sin) 自然呼吸曲線 + gamma 2.2 都是查表（led_lut.h），這裡只有整數運算
 void updateLeds() {
+  uint32_t startCycles = ESP.getCycleCount();
   unsigned long now = millis();
 
-  float bR, bG, bB;   // 基礎顏色（0~1）
-  float amp;          // 呼吸當下的亮度係數（0~1）
-
-  if (ledMode == LED_IDLE) {
-    bR = IDLE_R / 255.0f; bG = IDLE_G / 255.0f; bB = IDLE_B / 255.0f;
-    // Sebastian Sonntag 的自然呼吸公式：exp(sin(t))
-    // 週期 4 秒；輸出範圍 1/e ~ e，normalize 成 0~1
-    // 暗期停留久、亮起來快，接近真人吸吐節奏
-    float phase = (now % 4000) / 4000.0f * 2.0f * (float)PI;
-    float raw = expf(sinf(phase)) - 0.36787944f;   // 0 ~ ~2.35
-    amp = raw / 2.35040239f;                        // 0 ~ 1
-    amp = LED_FLOOR + (1.0f - LED_FLOOR) * amp;     // 底光 LED_FLOOR，不完全熄滅
+  // Ticker 實際間隔跟 LED_FRAME_MS 差多少（WiFi / 阻塞的 Show() 會把它推遲）
+  static uint32_t lastFrameStart = 0;
+  if (lastFrameStart != 0) {
+    const uint32_t expected = (uint32_t)LED_FRAME_MS * 1000 * PROFILER_CPU_MHZ;
+    uint32_t period = startCycles - lastFrameStart;
+    profiler.record(HotPathProfiler::PROF_LED_JITTER, period > expected ? period - expected : expected - period);
+  }
+  lastFrameStart = startCycles;
+
+  if (ledTimeline.playing()) {
+    // 前端只送了 play：進度 / 顏色都照 millis() 在 timeline 上算，跟 WS 封包什麼時候到無關
+    ledTimeline.render(ledFrame, now);
+  } else if (ledMode == LED_IDLE) {
+    // 白色整條呼吸，週期 4 秒；暗期停留久、亮起來快，接近真人吸吐節奏
+    uint16_t amp = ledlut::ampBetween(IDLE_AMP_LO, IDLE_AMP_HI, ledlut::breathAt(BREATH_TABLE, now, 4000));
+    ledfx::solid(ledFrame, RgbColor(IDLE_R, IDLE_G, IDLE_B), amp);
   } else if (ledMode == LED_AWAIT_SCAN) {
-    // 掃描階段：琥珀色
-    bR = AMBER_R / 255.0f; bG = AMBER_G / 255.0f; bB = AMBER_B / 255.0f;
-    if (ledHoldProgress > 0.01f) {
-      // 偵測到 NFC → 直接切滿亮度（避免琥珀色在低 PWM 偏紅的色偏問題）
-      amp = 1.0f;
+    // 掃描階段：琥珀色呼吸，amp 範圍 0.55 ~ 0.85
+    RgbColor amber(AMBER_R, AMBER_G, AMBER_B);
+    uint16_t breathAmp = ledlut::ampBetween(AWAIT_AMP_LO, AWAIT_AMP_HI, ledlut::breathAt(BREATH_TABLE, now, 3500));
+    // 前端給了 hold_target：進度直接讀 holdTracker；舊前端才是推 led_progress
+    uint16_t progress16 = holdTracker.armed() ? holdTracker.progress16(now)
+                                              : (uint16_t)((ledHoldProgress > 1.0f ? 1.0f : ledHoldProgress) * 65535.0f);
+    if (progress16 > 655) {
+      // 偵測到 NFC → 進度條隨 hold 從頭長到尾，已填的段直接滿亮度
+      // （避免琥珀色在低 PWM 偏紅的色偏問題），還沒填到的繼續呼吸
+      ledfx::progressBar(ledFrame, amber, progress16, breathAmp, 65535);
     } else {
-      // 等待掃描：琥珀色呼吸
-      // amp 範圍 0.55 ~ 0.85（之前 0.30 ~ 0.60，把暗端跟亮端都拉高 ~25 個百分點）
-      float phase = (now % 3500) / 3500.0f * 2.0f * (float)PI;
-      float raw = expf(sinf(phase)) - 0.36787944f;
-      float breath = raw / 2.35040239f;
-      amp = 0.55f + 0.30f * breath;
+      ledfx::solid(ledFrame, amber, breathAmp);
     }
   } else {
-    // REVEALED：穩定白光（輕微呼吸讓它不死板）
-    bR = IDLE_R / 255.0f; bG = IDLE_G / 255.0f; bB = IDLE_B / 255.0f;
-    float phase = (now % 2500) / 2500.0f * 2.0f * (float)PI;
-    float raw = expf(sinf(phase)) - 0.36787944f;
-    amp = 0.85f + 0.15f * (raw / 2.35040239f);
+    // REVEALED：白光輕微呼吸 + 一道來回的流光，讓它不死板
+    uint16_t breathAmp = ledlut::ampBetween(REVEALED_AMP_LO, REVEALED_AMP_HI, ledlut::breathAt(BREATH_TABLE, now, 2500));
+    ledfx::chase(ledFrame, RgbColor(IDLE_R, IDLE_G, IDLE_B), now, 2500, breathAmp, REVEALED_CHASE_PEAK,
+                 REVEALED_CHASE_WIDTH_Q8);
   }
 
-  // 最終線性亮度 = 基礎色 × 呼吸 amp × peak 上限
-  float linR = bR * amp * LED_PEAK;
-  float linG = bG * amp * LED_PEAK;
-  float linB = bB * amp * LED_PEAK;
+  // gamma（peak 已經烤進 GAMMA_TABLE）+ dithering；跟燈上目前的值一樣就不用 Show()
+  bool changed = ledFrame.present(GAMMA_TABLE, LED_DITHER);
 
-  uint8_t r = gammaByte(linR);
-  uint8_t g = gammaByte(linG);
-  uint8_t b = gammaByte(linB);
+  uint32_t renderCycles = ESP.getCycleCount() - startCycles;
+  ledRenderCycles = renderCycles;
+  if (renderCycles > ledRenderCyclesMax) ledRenderCyclesMax = renderCycles;
+
+  if (!changed) {
+    ledFramesSkipped++;
+    profiler.record(HotPathProfiler::PROF_LED_FRAME, renderCycles);
+    return;
+  }
+  ledFramesShown++;
 
-  // ClearTo 把整條設成同一色，等同跑 N 次 SetPixelColor 但更快
-  RgbColor color(r, g, b);
   if (ENABLE_STRIP_L) {
-    // stripL (BitBang) 是阻塞，會佔 CPU 約 150µs（5 顆 × 24 bit × 1.25µs）
-    stripL.ClearTo(color);
+    // stripL 是 BitBang 時會阻塞，佔 CPU 約 150µs（5 顆 × 24 bit × 1.25µs）；DMA 跟 stripR 一樣丟給硬體
+    for (uint8_t i = 0; i < LED_COUNT_L; i++) stripL.SetPixelColor(i, ledFrame.pixel(i));
     stripL.Show();
   }
   // stripR (UART1) 是非阻塞，呼叫 Show() 會把資料丟到硬體 buffer，硬體背景送出
-  stripR.ClearTo(color);
+  for (uint8_t i = 0; i < LED_COUNT_R; i++) stripR.SetPixelColor(i, ledFrame.pixel(i));
   stripR.Show();
+
+  uint32_t frameCycles = ESP.getCycleCount() - startCycles;
+  if (frameCycles > ledFrameCyclesMax) ledFrameCyclesMax = frameCycles;
+  profiler.record(HotPathProfiler::PROF_LED_FRAME, frameCycles);
 }
 
 // ===== WiFi 設定 =====
@@ -302,6 +520,8 @@ void setupWiFi() {
     Serial.println("2. 開啟瀏覽器輸入 IP 位址");
     Serial.printf("3. WebSocket URL: ws://%s:81\n", IP.toString().c_str());
     Serial.println("========================================\n");
+    bootReadyMs = millis();
+    serialPrintf("BOOT:ready_ms=%lu,wifi=ap\n", bootReadyMs);
 
   #else
     // === Station 模式（連接到手機熱點）===
@@ -311,59 +531,455 @@ void setupWiFi() {
     WiFi.mode(WIFI_STA);
     WiFi.setSleepMode(WIFI_NONE_SLEEP);
     WiFi.setAutoReconnect(true);
-    WiFi.setAutoConnect(true);
-    WiFi.persistent(true);
+    // 開機 / 重連都由 wifiConnector 自己 begin：SDK 不要先用 flash 裡的設定掃描一輪，也不用每次 begin 寫 flash
+    WiFi.setAutoConnect(false);
+    WiFi.persistent(false);
     WiFi.setOutputPower(20.5f);
 
-    // 不用 WiFi.config 強制固定 IP — Windows 行動熱點 (ICS) 會擋掉
-    // 改用 DHCP，連上後印 IP，貼到 js/config.js 即可
+    // 不等連上：setup() 直接往下跑，NFC 先開始掃（沒連上之前的事件記進 journal），
+    // 連上之後 taskWiFi 印 IP 跟開機花了多久
+    wifiConnector.begin(sta_ssid, sta_password, WIFI_REUSE_LEASE, millis());
+    if (wifiConnector.phase() == WifiConnector::PHASE_DIRECT) {
+      Serial.printf("連線中: %s（直連 channel %u，快取來自 %s）\n", sta_ssid, wifiConnector.cachedChannel(),
+                    wifiConnector.cacheSource() == WifiConnector::CACHE_RTC ? "RTC" : "flash");
+    } else {
+      Serial.printf("連線中: %s（沒有快取，完整掃描）\n", sta_ssid);
+    }
+  #endif
+}
+
+// 完整掃描也連不上：印狀態碼跟檢查清單（wifiConnector 會自己重試）
+void printWiFiHelp() {
+  Serial.println("\n✗ WiFi 連線失敗！");
+  Serial.println("----------------------------------------");
+  Serial.printf("最終狀態碼: %d\n", WiFi.status());
+  Serial.println("\n狀態碼說明:");
+  Serial.println("  0 = WL_IDLE_STATUS (閒置)");
+  Serial.println("  1 = WL_NO_SSID_AVAIL (找不到 WiFi 名稱)");
+  Serial.println("  4 = WL_CONNECT_FAILED (密碼錯誤)");
+  Serial.println("  6 = WL_DISCONNECTED (斷線)");
+  Serial.println("----------------------------------------");
+  Serial.println("\n請檢查:");
+  Serial.println("1. iPhone 熱點名稱是否完全一致");
+  Serial.printf("   程式中: '%s'\n", sta_ssid);
+  Serial.println("2. iPhone 熱點設定:");
+  Serial.println("   - 允許其他人加入: 開啟");
+  Serial.println("   - 使用 2.4GHz (非 5GHz)");
+  Serial.println("3. 密碼是否正確");
+  Serial.println("4. 試試看改 iPhone 熱點名稱為英文");
+  Serial.println("   (例如: 'Bernard-iPhone')");
+  Serial.println("========================================\n");
+}
+
+// ===== WebSocket 訊息處理表 =====
+// 每種 type 一個 handler，webSocketEvent 讀一次 type 之後直接查表呼叫
+// 字串欄位都是指向 payload 內部的 C 字串（JsonReader 就地 unescape），不複製
+
+// JSON 跟二進位兩種格式解出來之後共用的動作
+// 名稱順序跟 LedMode 一樣，也就是二進位 LED_MODE 的值
+const char* const LED_MODE_NAMES[] = { "idle", "await_scan", "revealed" };
+
+// 訂了 led 的 client（工作人員平板）看得到主畫面把燈切到哪個模式、timeline 播到哪
+void publishLedState() {
+  if (!wsSessions.anySubscriber(TOPIC_LED)) return;
+  JsonBuffer<112> message;
+  message.addString("type", "led_state").addString("mode", LED_MODE_NAMES[ledMode]).addFloat("progress", ledHoldProgress);
+  if (ledTimeline.playing()) message.addInt("timeline_ms", (long)ledTimeline.position(millis()));
+  const char* json = message.finish();
+  sendToTopic(TOPIC_LED, json, message.length());
+}
 
-    Serial.printf("連線中: %s", sta_ssid);
-    WiFi.begin(sta_ssid, sta_password);
+void setLedMode(LedMode mode) {
+  ledMode = mode;
+  ledHoldProgress = 0.0f;
+  // 換模式 = 前端把燈收回來自己管，timeline 停掉；離開 await_scan 也就不用再等瓶子了
+  ledTimeline.stop();
+  if (mode != LED_AWAIT_SCAN) holdTracker.disarm();
+  Serial.printf("LED 模式切換: %s\n", LED_MODE_NAMES[mode]);
+  publishLedState();
+}
 
-    // 每 200ms poll 一次（比原本 500ms 反應更快）；最多 ~6 秒
-    // 6 秒內沒連上就讓 setup() 繼續往下跑，loop() 裡的重連邏輯會接手
-    int attempts = 0;
-    while (WiFi.status() != WL_CONNECTED && attempts < 30) {
-      delay(200);
-      Serial.print(".");
+void setLedProgress(float v) {
+  if (!(v >= 0.0f)) v = 0.0f;   // 負數 / NaN
+  if (v > 1.0f) v = 1.0f;
+  ledHoldProgress = v;
+}
 
-      // 每 5 次顯示當前狀態
-      if (attempts % 5 == 0 && attempts > 0) {
-        Serial.printf("\n狀態碼: %d ", WiFi.status());
-        // 狀態碼: 0=閒置, 1=無SSID, 3=已連線, 4=連線失敗, 6=連線遺失
-      }
+// keyframe timeline：上傳一次，之後只有 play / seek / stop（格式見 led_timeline.h）
+void onLedTimelineLoaded(bool ok) {
+  if (ok) {
+    Serial.printf("LED timeline 已載入: %u 個 keyframe，%u ms\n", ledTimeline.keyCount(),
+                  (unsigned)ledTimeline.durationMs());
+  } else {
+    Serial.println("LED timeline 格式不對，忽略");
+  }
+}
+
+void playLedTimeline(uint32_t offsetMs) {
+  if (!ledTimeline.play(millis(), offsetMs)) {
+    Serial.println("LED timeline 還沒上傳，不能 play");
+    return;
+  }
+  publishLedState();
+}
+
+void seekLedTimeline(uint32_t positionMs) {
+  ledTimeline.seek(millis(), positionMs);
+  publishLedState();
+}
 
-      attempts++;
+void stopLedTimeline() {
+  if (!ledTimeline.playing()) return;
+  ledTimeline.stop();
+  publishLedState();
+}
+
+// 等哪一瓶：quoteNumber -1 = 不等了，0 = 任何卡；requiredMs 0 = 預設 HOLD_REQUIRED_MS
+void setHoldTarget(int quoteNumber, uint32_t requiredMs) {
+  if (quoteNumber < 0) {
+    holdTracker.disarm();
+    Serial.println("hold：解除");
+    return;
+  }
+  holdTracker.arm((int16_t)quoteNumber, requiredMs ? requiredMs : HOLD_REQUIRED_MS);
+  Serial.printf("hold：等 #%d（%u ms，閃斷容許 %u ms）\n", quoteNumber, (unsigned)holdTracker.requiredMs(),
+                (unsigned)NFC_HOLD_GRACE_MS);
+}
+
+void setCurrentQuote(int quoteNumber) {
+  currentQuoteNumber = quoteNumber;
+  Serial.printf("已更新當前雞湯編號: %d\n", currentQuoteNumber);
+}
+
+// 心跳：echo 回去，讓前端 watchdog 能偵測 ESP 是否還活著
+// 帶上 millis()：多台合流的 hub（tools/hub）用送出 / 收到的時間算這台的時鐘差，把事件的 t 對齊
+void onWsHeartbeat(uint8_t num, const JsonReader& msg) {
+  JsonBuffer<48> message;
+  message.addString("type", "heartbeat").addInt("t", (long)millis());
+  const char* json = message.finish();
+  webSocket.sendTXT(num, json, message.length());
+}
+
+// 前端推送燈條模式：{"type":"led_mode","mode":"idle"|"await_scan"|"revealed"}
+void onWsLedMode(uint8_t num, const JsonReader& msg) {
+  const char* mode = msg.getString("mode");
+  if (!mode) return;
+  for (uint8_t i = 0; i < sizeof(LED_MODE_NAMES) / sizeof(LED_MODE_NAMES[0]); i++) {
+    if (strcmp(mode, LED_MODE_NAMES[i]) == 0) {
+      setLedMode((LedMode)i);
+      return;
     }
+  }
+  Serial.printf("LED 模式不認得: %s\n", mode);
+}
 
-    Serial.println();
+// 前端推送 hold 進度：{"type":"led_progress","value":0.0~1.0}
+void onWsLedProgress(uint8_t num, const JsonReader& msg) {
+  float v;
+  if (msg.getFloat("value", v)) setLedProgress(v);
+}
 
-    if (WiFi.status() == WL_CONNECTED) {
-      Serial.printf("\n>>> IP: %s   ← 貼到 js/config.js 第 7 行\n\n",
-                    WiFi.localIP().toString().c_str());
+// 上傳 timeline：{"type":"led_timeline","keys":"<每個 keyframe 8 bytes 的 hex>","loop_from":1,"loop_to":3,"offset":0}
+// 沒有 loop_from / loop_to = 不循環；帶 offset 就載入後直接從那裡開始播
+void onWsLedTimeline(uint8_t num, const JsonReader& msg) {
+  const char* keys = msg.getString("keys");
+  long loopFrom = LedTimeline::kNoLoop, loopTo = LedTimeline::kNoLoop, offset;
+  msg.getInt("loop_from", loopFrom);
+  msg.getInt("loop_to", loopTo);
+  bool ok = keys && loopFrom >= 0 && loopFrom <= 0xFF && loopTo >= 0 && loopTo <= 0xFF &&
+            ledTimeline.loadHex(keys, (uint8_t)loopFrom, (uint8_t)loopTo);
+  onLedTimelineLoaded(ok);
+  if (ok && msg.getInt("offset", offset) && offset >= 0) playLedTimeline((uint32_t)offset);
+}
+
+// {"type":"led_play","offset":1200}（offset 省略 = 從頭）
+void onWsLedPlay(uint8_t num, const JsonReader& msg) {
+  long offset = 0;
+  msg.getInt("offset", offset);
+  playLedTimeline(offset > 0 ? (uint32_t)offset : 0);
+}
+
+// {"type":"led_seek","ms":2500}
+void onWsLedSeek(uint8_t num, const JsonReader& msg) {
+  long ms;
+  if (msg.getInt("ms", ms) && ms >= 0) seekLedTimeline((uint32_t)ms);
+}
+
+// 要等哪一瓶：{"type":"hold_target","quoteNumber":11,"ms":5000}（-1 = 解除，0 = 任何卡，ms 省略 = 預設）
+void onWsHoldTarget(uint8_t num, const JsonReader& msg) {
+  long quoteNumber, ms = 0;
+  if (!msg.getInt("quoteNumber", quoteNumber)) return;
+  msg.getInt("ms", ms);
+  setHoldTarget(quoteNumber < 0 ? -1 : (int)(quoteNumber > 0x7FFF ? 0x7FFF : quoteNumber),
+                ms > 0 && ms <= 0xFFFF ? (uint32_t)ms : 0);
+}
+
+// {"type":"led_stop"}：回到 led_mode 的畫面
+void onWsLedStop(uint8_t num, const JsonReader& msg) {
+  stopLedTimeline();
+}
+
+// 前端查到 UID 對應的雞湯編號後回報：{"type":"log_scan","uid":"...","match":"#11"}
+// 用來在 Serial Monitor 看到「這張實體卡對應哪一號」
+void onWsLogScan(uint8_t num, const JsonReader& msg) {
+  const char* uid = msg.getString("uid");
+  const char* match = msg.getString("match");
+  Serial.println("---------------------------------");
+  serialPrintf(">>> [標號] UID %.32s  →  %.32s\n", uid ? uid : "", match ? match : "");
+  Serial.println("---------------------------------");
+}
+
+// 處理前端發送的當前雞湯編號更新
+// 格式: {"type":"update_current_quote","quoteNumber":1}
+void onWsUpdateCurrentQuote(uint8_t num, const JsonReader& msg) {
+  long n;
+  if (msg.getInt("quoteNumber", n)) setCurrentQuote((int)n);
+}
+
+// 處理前端要求進入 NFC tag 模擬模式
+// 格式: {"type":"emulate_ndef","url":"https://..."}
+void onWsEmulateNdef(uint8_t num, const JsonReader& msg) {
+  const char* url = msg.getString("url");
+  if (!url || url[0] == '\0') return;
+  serialPrintf("收到模擬請求, URL: %.*s%s\n", (int)WS_ECHO_MAX, url, strlen(url) > WS_ECHO_MAX ? "…" : "");
+  // 換網址：先停掉正在讀 ndefBuffer 的模擬
+  if (emulateMode) stopTagEmulation();
+  // NDEF file（NLEN + message）直接編進 ndefBuffer
+  ndef::Record record = ndef::uri(url);
+  ndefBufferLen = (uint16_t)ndef::encodeType4File(&record, 1, ndefBuffer, sizeof(ndefBuffer));
+  if (ndefBufferLen == 0) {
+    Serial.println("NDEF 太長，塞不下 buffer");
+    sendToTopic(TOPIC_WRITE, "{\"type\":\"nfc_emulate_timeout\"}");
+    return;
+  }
+  if (startTagEmulation()) {
+    sendToTopic(TOPIC_WRITE, "{\"type\":\"nfc_emulate_ready\"}");
+  } else {
+    sendToTopic(TOPIC_WRITE, "{\"type\":\"nfc_emulate_timeout\"}");
+  }
+}
+
+// 熱路徑 profiler + 排程器的 JSON：格式見 hot_path_profiler.h，最後多一個 "sched":{...}（scheduler.h）
+// 放不下回 0
+size_t buildStatsJson(char* json, size_t capacity) {
+  size_t length = profiler.writeJson(millis(), json, capacity);
+  if (length == 0) return 0;
+  // 把結尾的 '}' 換成 ,"boot":{...},"sched":{...}}
+  // boot：開機到 WiFi 連上幾 ms、最近一次連線走直連還是掃描、直連落空幾次（AP 換 channel）
+  int n = snprintf(json + length - 1, capacity - (length - 1),
+                   ",\"boot\":{\"ready_ms\":%lu,\"wifi\":\"%s\",\"connect_ms\":%lu,\"direct_misses\":%u},\"sched\":",
+                   bootReadyMs, wifiConnector.pathName(), wifiConnector.connectMs(),
+                   (unsigned)wifiConnector.directMisses());
+  if (n < 0 || length - 1 + n >= capacity) return 0;
+  size_t used = length - 1 + n;
+  size_t sched = scheduler.writeJson(json + used, capacity - used - 1);
+  if (sched == 0) return 0;
+  used += sched;
+  json[used++] = '}';
+  return used;
+}
+
+// 查詢：{"type":"stats"} → 只回給問的那個 client（訂了 stats 的另外每個心跳週期會收到一次）
+void onWsStats(uint8_t num, const JsonReader& msg) {
+  static char json[1536];
+  size_t length = buildStatsJson(json, sizeof(json));
+  if (length) webSocket.sendTXT(num, json, length);
+}
+
+// 訂閱 / 取消訂閱主題：{"type":"subscribe","topics":"led,stats"}，回目前訂的全部
+void replySubscribed(uint8_t num) {
+  char topics[32];
+  WsSessions::formatTopics(wsSessions.topics(num), topics, sizeof(topics));
+  JsonBuffer<64> message;
+  message.addString("type", "subscribed").addString("topics", topics);
+  const char* json = message.finish();
+  webSocket.sendTXT(num, json, message.length());
+}
+
+void onWsSubscribe(uint8_t num, const JsonReader& msg) {
+  const char* topics = msg.getString("topics");
+  if (topics) wsSessions.subscribe(num, WsSessions::parseTopics(topics, strlen(topics)));
+  replySubscribed(num);
+}
+
+void onWsUnsubscribe(uint8_t num, const JsonReader& msg) {
+  const char* topics = msg.getString("topics");
+  if (topics) wsSessions.unsubscribe(num, WsSessions::parseTopics(topics, strlen(topics)));
+  replySubscribed(num);
+}
+
+void sendReplayFrame(const ScanJournal::Entry& entry, void* context) {
+  webSocket.sendTXT(*(uint8_t*)context, entry.json, entry.length);
+}
+
+// 補送：{"type":"replay","after":42} → seq 42 之後、這個 client 有訂的 frame 照原樣重送（JSON），
+// 一次最多 REPLAY_BATCH 個，最後回 {"type":"replay_done","after":42,"last":58,"more":false,"lost":0}
+//   more  = 還有，client 拿 last 當 after 再要一次
+//   lost  = 太舊、journal 已經輪掉的 frame 數
+//   reset = client 的 seq 比 journal 最新的還大（flash 被清過），client 從 last 重新算
+void onWsReplay(uint8_t num, const JsonReader& msg) {
+  long afterValue;
+  if (!msg.getInt("after", afterValue) || afterValue < 0) return;
+  uint32_t after = (uint32_t)afterValue;
+  flushEvents();   // 排著還沒送的先進 journal，補送才不會漏掉最新的
+
+  uint32_t newest = scanJournal.lastSeq();
+  uint32_t last = after;
+  size_t sent = 0;
+  bool reset = after > newest;
+  if (!reset) {
+    sent = scanJournal.replay(after, wsSessions.topics(num), REPLAY_BATCH, sendReplayFrame, &num, &last);
+  }
+  uint32_t oldest = scanJournal.firstSeq();
+  uint32_t lost = (!reset && oldest > after + 1) ? oldest - after - 1 : 0;
+  bool more = sent == REPLAY_BATCH && last < newest;
+
+  JsonBuffer<112> message;
+  message.addString("type", "replay_done").addInt("after", (long)after).addInt("last", (long)(reset ? newest : last));
+  message.addBool("more", more).addInt("lost", (long)lost);
+  if (reset) message.addBool("reset", true);
+  const char* json = message.finish();
+  webSocket.sendTXT(num, json, message.length());
+  serialPrintf("[%u] replay after %u：補送 %u 個 frame%s\n", num, (unsigned)after, (unsigned)sent,
+               reset ? "（journal 比 client 舊，重新起算）" : "");
+}
+
+struct WsHandler {
+  const char* type;
+  void (*handle)(uint8_t num, const JsonReader& msg);
+};
+
+// 依實際頻率排（led_progress / heartbeat 最常來）
+const WsHandler WS_HANDLERS[] = {
+  { "led_progress",         onWsLedProgress },
+  { "heartbeat",            onWsHeartbeat },
+  { "led_mode",             onWsLedMode },
+  { "update_current_quote", onWsUpdateCurrentQuote },
+  { "log_scan",             onWsLogScan },
+  { "emulate_ndef",         onWsEmulateNdef },
+  { "stats",                onWsStats },
+  { "subscribe",            onWsSubscribe },
+  { "unsubscribe",          onWsUnsubscribe },
+  { "replay",               onWsReplay },
+  { "led_play",             onWsLedPlay },
+  { "led_stop",             onWsLedStop },
+  { "led_seek",             onWsLedSeek },
+  { "led_timeline",         onWsLedTimeline },
+  { "hold_target",          onWsHoldTarget },
+};
+
+// ===== WebSocket 二進位訊息（格式見 ws_binary.h）=====
+void onWsBinary(uint8_t num, const uint8_t* payload, size_t length) {
+  if (length == 0) return;
+  switch (payload[0]) {
+    case wsbin::OP_LED_PROGRESS:
+      if (length >= 3) setLedProgress(wsbin::halfToFloat(wsbin::readU16(payload + 1)));
+      break;
+    case wsbin::OP_HEARTBEAT: {
+      const uint8_t echo = wsbin::OP_HEARTBEAT;
+      webSocket.sendBIN(num, &echo, 1);
+      break;
+    }
+    case wsbin::OP_LED_MODE:
+      if (length >= 2 && payload[1] <= LED_REVEALED) setLedMode((LedMode)payload[1]);
+      break;
+    case wsbin::OP_CURRENT_QUOTE:
+      if (length >= 3) setCurrentQuote((int16_t)wsbin::readU16(payload + 1));
+      break;
+    case wsbin::OP_LED_TIMELINE:
+      if (length >= 3) onLedTimelineLoaded(ledTimeline.load(payload + 3, length - 3, payload[1], payload[2]));
+      break;
+    case wsbin::OP_LED_PLAY:
+      if (length >= 5) playLedTimeline(wsbin::readU32(payload + 1));
+      break;
+    case wsbin::OP_LED_SEEK:
+      if (length >= 5) seekLedTimeline(wsbin::readU32(payload + 1));
+      break;
+    case wsbin::OP_LED_STOP:
+      stopLedTimeline();
+      break;
+    case wsbin::OP_HOLD_TARGET:
+      if (length >= 5) setHoldTarget((int16_t)wsbin::readU16(payload + 1), wsbin::readU16(payload + 3));
+      break;
+    default:
+      Serial.printf("[%u] 不認得的二進位 opcode 0x%02X（%u bytes）\n", num, payload[0], (unsigned)length);
+      break;
+  }
+}
+
+// 只送給訂了 topic 的 client；大家都是 JSON 又都訂了就一次 broadcastTXT
+void sendToTopic(WsTopic topic, const char* json, size_t length) {
+  if (wsSessions.everyoneWantsJson(topic)) {
+    webSocket.broadcastTXT(json, length);
+    return;
+  }
+  for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+    if (wsSessions.wants(i, topic)) webSocket.sendTXT(i, json, length);
+  }
+}
+
+void sendToTopic(WsTopic topic, const char* json) {
+  sendToTopic(topic, json, strlen(json));
+}
+
+// 有二進位版的：二進位 client 收 bin，其他收 JSON。不排隊、不佔 seq、不記 journal（hold_progress 這種馬上會被下一個蓋掉的）
+void sendToTopic(WsTopic topic, const char* json, size_t jsonLength, const uint8_t* bin, size_t binLength) {
+  if (wsSessions.everyoneWantsJson(topic)) {
+    webSocket.broadcastTXT(json, jsonLength);
+    return;
+  }
+  for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+    if (!wsSessions.wants(i, topic)) continue;
+    if (wsSessions.proto(i) == WsSessions::PROTO_BINARY) {
+      webSocket.sendBIN(i, bin, binLength);
     } else {
-      Serial.println("\n✗ WiFi 連線失敗！");
-      Serial.println("----------------------------------------");
-      Serial.printf("最終狀態碼: %d\n", WiFi.status());
-      Serial.println("\n狀態碼說明:");
-      Serial.println("  0 = WL_IDLE_STATUS (閒置)");
-      Serial.println("  1 = WL_NO_SSID_AVAIL (找不到 WiFi 名稱)");
-      Serial.println("  4 = WL_CONNECT_FAILED (密碼錯誤)");
-      Serial.println("  6 = WL_DISCONNECTED (斷線)");
-      Serial.println("----------------------------------------");
-      Serial.println("\n請檢查:");
-      Serial.println("1. iPhone 熱點名稱是否完全一致");
-      Serial.printf("   程式中: '%s'\n", sta_ssid);
-      Serial.println("2. iPhone 熱點設定:");
-      Serial.println("   - 允許其他人加入: 開啟");
-      Serial.println("   - 使用 2.4GHz (非 5GHz)");
-      Serial.println("3. 密碼是否正確");
-      Serial.println("4. 試試看改 iPhone 熱點名稱為英文");
-      Serial.println("   (例如: 'Bernard-iPhone')");
-      Serial.println("========================================\n");
+      webSocket.sendTXT(i, json, jsonLength);
     }
-  #endif
+  }
+}
+
+// 掃描 / hold 事件：先排進 outboundEvents，loop() 結束時由 flushEvents() 一次送出
+void broadcastEvent(const char* json, size_t jsonLength, const uint8_t* bin, size_t binLength) {
+  if (outboundEvents.push(json, jsonLength, bin, binLength, millis())) return;
+  // 塞不下：先把已經累積的送出去再排
+  flushEvents();
+  if (!outboundEvents.push(json, jsonLength, bin, binLength, millis())) {
+    Serial.printf("[ws] 事件太大，丟棄: %.*s\n", (int)jsonLength, json);
+  }
+}
+
+// 把累積的事件合成一個 frame，只送給訂了 scan 的 client：二進位 client 收 EVENTS frame，其他 client 收 JSON
+// 所有 client 都是 JSON 而且都訂了 scan 時就是一次 broadcastTXT
+// 不管有沒有人在聽，JSON 版都記進 journal（斷線期間掃的卡，重連後 replay 補送）
+void flushEvents() {
+  if (outboundEvents.empty()) return;
+  uint32_t startCycles = ESP.getCycleCount();
+  static char json[EventQueue::kJsonCapacity + EventQueue::kJsonOverhead];
+  static uint8_t bin[EventQueue::kBinaryCapacity + EventQueue::kBinaryOverhead];
+  size_t jsonLength = outboundEvents.buildJson(json, sizeof(json));
+  if (wsSessions.everyoneWantsJson(TOPIC_SCAN)) {
+    webSocket.broadcastTXT(json, jsonLength);
+  } else {
+    size_t binLength = 0;
+    for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+      if (!wsSessions.wants(i, TOPIC_SCAN)) continue;
+      if (wsSessions.proto(i) == WsSessions::PROTO_BINARY) {
+        if (!binLength) binLength = outboundEvents.buildBinary(bin, sizeof(bin));
+        webSocket.sendBIN(i, bin, binLength);
+      } else {
+        webSocket.sendTXT(i, json, jsonLength);
+      }
+    }
+  }
+  scanJournal.append(outboundEvents.nextSeq(), (uint32_t)outboundEvents.firstMs(), TOPIC_SCAN, json, jsonLength,
+                     millis());
+  outboundEvents.commit();
+  profiler.record(HotPathProfiler::PROF_WS_SEND, ESP.getCycleCount() - startCycles);
+}
+
+// 沒有欄位的事件：二進位就是 1 byte 的 opcode
+void broadcastEvent(const char* json, uint8_t opcode) {
+  broadcastEvent(json, strlen(json), &opcode, 1);
 }
 
 // ===== WebSocket 事件處理 =====
@@ -371,99 +987,59 @@ void webSocketEvent(uint8_t num, WStype_t type, uint8_t * payload, size_t length
   switch(type) {
     case WStype_DISCONNECTED:
       Serial.printf("[%u] 客戶端斷線\n", num);
-      clientConnected = false;
+      // 只關這一個；其他顯示端照常收
+      wsSessions.close(num);
       break;
 
     case WStype_CONNECTED: {
       IPAddress ip = webSocket.remoteIP(num);
       Serial.printf("[%u] 客戶端連線, IP: %d.%d.%d.%d\n",
                     num, ip[0], ip[1], ip[2], ip[3]);
-      clientConnected = true;
 
-      // 發送歡迎訊息
-      webSocket.sendTXT(num, "{\"type\":\"connected\",\"message\":\"Connected to NFC Controller\"}");
+      // 協商格式：payload 是 client 要求的 URL，帶 ?proto=bin 就切二進位，回 HELLO 確認
+      // 主題：帶 ?topics=scan,stats 就只收這些，沒帶 = scan + write
+      uint8_t topics = WsSessions::topicsFromUrl(payload, length, WsSessions::kDefaultTopics);
+      if (wsbin::wantsBinary(payload, length)) {
+        wsSessions.open(num, WsSessions::PROTO_BINARY, topics);
+        const uint8_t hello[2] = { wsbin::OP_HELLO, wsbin::PROTOCOL_VERSION };
+        webSocket.sendBIN(num, hello, sizeof(hello));
+        Serial.printf("[%u] 使用二進位協定 v%u\n", num, wsbin::PROTOCOL_VERSION);
+      } else {
+        wsSessions.open(num, WsSessions::PROTO_JSON, topics);
+        // 發送歡迎訊息（timeline = 認得 led_timeline / led_play，hold = 認得 hold_target；
+        // 舊 firmware 沒這些欄位，前端照舊推 led_progress、自己計 hold）
+        webSocket.sendTXT(num, "{\"type\":\"connected\",\"message\":\"Connected to NFC Controller\",\"timeline\":true,\"hold\":true}");
+      }
+      char topicNames[32];
+      WsSessions::formatTopics(topics, topicNames, sizeof(topicNames));
+      Serial.printf("[%u] 訂閱: %s（目前 %u 個 client）\n", num, topicNames, wsSessions.openCount());
       break;
     }
 
-    case WStype_TEXT: {
-      Serial.printf("[%u] 收到訊息: %s\n", num, payload);
-
-      // 解析 JSON 訊息
-      String msg = String((char*)payload);
-
-      // 處理心跳訊息：echo 回去，讓前端 watchdog 能偵測 ESP 是否還活著
-      if (msg.indexOf("\"type\":\"heartbeat\"") >= 0) {
-        webSocket.sendTXT(num, "{\"type\":\"heartbeat\"}");
-        return;
-      }
-
-      // 前端推送燈條模式：{"type":"led_mode","mode":"idle"|"await_scan"|"revealed"}
-      if (msg.indexOf("\"type\":\"led_mode\"") >= 0) {
-        String mode = extractStringField(msg, "mode");
-        if (mode == "idle") {
-          ledMode = LED_IDLE;
-          ledHoldProgress = 0.0f;
-        } else if (mode == "await_scan") {
-          ledMode = LED_AWAIT_SCAN;
-          ledHoldProgress = 0.0f;
-        } else if (mode == "revealed") {
-          ledMode = LED_REVEALED;
-          ledHoldProgress = 0.0f;
-        }
-        Serial.printf("LED 模式切換: %s\n", mode.c_str());
-        return;
-      }
-
-      // 前端推送 hold 進度：{"type":"led_progress","value":0.0~1.0}
-      if (msg.indexOf("\"type\":\"led_progress\"") >= 0) {
-        int s = msg.indexOf("\"value\":");
-        if (s > 0) {
-          s += 8;
-          int e = msg.indexOf("}", s);
-          if (e < 0) e = msg.length();
-          String v = msg.substring(s, e);
-          v.trim();
-          ledHoldProgress = v.toFloat();
-        }
-        return;
-      }
+    case WStype_BIN:
+      onWsBinary(num, payload, length);
+      break;
 
-      // 前端查到 UID 對應的雞湯編號後回報：{"type":"log_scan","uid":"...","match":"#11"}
-      // 用來在 Serial Monitor 看到「這張實體卡對應哪一號」
-      if (msg.indexOf("\"type\":\"log_scan\"") >= 0) {
-        String uid = extractStringField(msg, "uid");
-        String match = extractStringField(msg, "match");
-        Serial.println("---------------------------------");
-        Serial.printf(">>> [標號] UID %s  →  %s\n", uid.c_str(), match.c_str());
-        Serial.println("---------------------------------");
-        return;
+    case WStype_TEXT: {
+      // 就地 parse 會改寫 payload，所以先印；只印前 WS_ECHO_MAX 個字，走 stack buffer（Serial.printf 超過 64 bytes 會 malloc）
+      int shown = length > WS_ECHO_MAX ? WS_ECHO_MAX : (int)length;
+      serialPrintf("[%u] 收到訊息: %.*s%s\n", num, shown, (const char*)payload, (size_t)shown < length ? "…" : "");
+
+      // 一次讀出 type 再查表分派
+      JsonReader msg;
+      if (!msg.parse((char*)payload, length)) {
+        Serial.printf("[%u] 訊息不是合法 JSON，忽略\n", num);
+        break;
       }
-
-      // 處理前端發送的當前雞湯編號更新
-      // 格式: {"type":"update_current_quote","quoteNumber":1}
-      if (msg.indexOf("\"type\":\"update_current_quote\"") >= 0) {
-        int numStart = msg.indexOf("\"quoteNumber\":") + 14;
-        int numEnd = msg.indexOf("}", numStart);
-        if (numStart > 13 && numEnd > numStart) {
-          String numStr = msg.substring(numStart, numEnd);
-          numStr.trim();
-          currentQuoteNumber = numStr.toInt();
-          Serial.printf("已更新當前雞湯編號: %d\n", currentQuoteNumber);
-        }
+      const char* msgType = msg.getString("type");
+      if (!msgType) {
+        Serial.printf("[%u] 訊息沒有 type，忽略\n", num);
+        break;
       }
-
-      // 處理前端要求進入 NFC tag 模擬模式
-      // 格式: {"type":"emulate_ndef","url":"https://..."}
-      if (msg.indexOf("\"type\":\"emulate_ndef\"") >= 0) {
-        String url = extractStringField(msg, "url");
-        if (url.length() > 0) {
-          Serial.println("收到模擬請求, URL: " + url);
-          buildNDEFFromURL(url);
-          if (startTagEmulation()) {
-            webSocket.broadcastTXT("{\"type\":\"nfc_emulate_ready\"}");
-          } else {
-            webSocket.broadcastTXT("{\"type\":\"nfc_emulate_timeout\"}");
-          }
+      for (const WsHandler& h : WS_HANDLERS) {
+        if (strcmp(msgType, h.type) == 0) {
+          h.handle(num, msg);
+          break;
         }
       }
       break;
@@ -477,220 +1053,346 @@ void webSocketEvent(uint8_t num, WStype_t type, uint8_t * payload, size_t length
 
 // ===== 主迴圈 =====
 void loop() {
-  unsigned long currentTime = millis();
+  uint32_t startCycles = ESP.getCycleCount();
+  // 到期的 task 依優先序跑完；沒有到期的就 yield 給 WiFi stack（見 scheduler.h）
+  scheduler.runOnce();
+  // 這一輪產生的掃描 / hold 事件合成一個 frame 送出（task 裡有很多提早 return，統一在這裡送）
+  flushEvents();
+  profiler.record(HotPathProfiler::PROF_LOOP, ESP.getCycleCount() - startCycles);
+  profiler.sampleHeap(millis());
+}
 
-  // Serial 指令處理（批次燒錄模式，優先於一切）
+// Serial 指令處理（批次燒錄模式）
+void taskSerial() {
   handleSerialCommands();
+}
 
-  // 燈條動畫改由 Ticker 以 50fps 獨立推進，這裡不用再手動呼叫 updateLeds()
+// 燈條動畫改由 Ticker 以 LED_FRAME_MS 獨立推進，不在 task 裡
 
-  // 檢查 WiFi 連線狀態（Station 模式，非阻塞）
+// WiFi 連線狀態（Station 模式，非阻塞）：連線中的時候每 50ms 看一次
+void taskWiFi() {
   #if !USE_AP_MODE
-  static unsigned long lastWiFiCheck = 0;
-  static bool reconnecting = false;
-  static wl_status_t lastStatus = WL_IDLE_STATUS;
-
-  wl_status_t status = WiFi.status();
-  if (status != lastStatus) {
-    if (status == WL_CONNECTED) {
-      Serial.printf("✓ WiFi 已連線：%s\n", WiFi.localIP().toString().c_str());
-      reconnecting = false;
-    } else if (lastStatus == WL_CONNECTED) {
-      Serial.println("✗ WiFi 斷線");
-    }
-    lastStatus = status;
-  }
-
-  if (status != WL_CONNECTED) {
-    // 每 3 秒嘗試重連一次（不阻塞 loop）
-    if (currentTime - lastWiFiCheck >= 3000) {
-      lastWiFiCheck = currentTime;
-      if (!reconnecting) {
-        Serial.println("嘗試重新連線 WiFi...");
-        WiFi.begin(sta_ssid, sta_password);
-        reconnecting = true;
+  unsigned long now = millis();
+  switch (wifiConnector.poll(now)) {
+    case WifiConnector::EV_CONNECTED:
+      if (!bootReadyMs) {
+        bootReadyMs = now;
+        Serial.printf("\n>>> IP: %s   ← 貼到 js/config.js 第 7 行\n\n", WiFi.localIP().toString().c_str());
+        // 開機到可以接 WebSocket：展場拔電重開的時候就看這行
+        serialPrintf("BOOT:ready_ms=%lu,wifi=%s,connect_ms=%lu\n", bootReadyMs, wifiConnector.pathName(),
+                     wifiConnector.connectMs());
       } else {
-        Serial.print(".");
+        serialPrintf("✓ WiFi 已連線：%s（%s，%lu ms）\n", WiFi.localIP().toString().c_str(),
+                     wifiConnector.pathName(), wifiConnector.connectMs());
       }
-    }
+      break;
+    case WifiConnector::EV_LOST:
+      Serial.println("✗ WiFi 斷線，直連上次的 AP...");
+      break;
+    case WifiConnector::EV_DIRECT_FAILED:
+      Serial.println("直連沒連上（AP 換了 channel？），改完整掃描...");
+      break;
+    case WifiConnector::EV_SCAN_FAILED:
+      printWiFiHelp();
+      break;
+    default:
+      break;
   }
+  if (wifiConnector.connecting()) scheduler.defer(scheduler.current(), TASK_WIFI_CONNECTING_US);
   #endif
+}
 
+void taskWebSocket() {
+  uint32_t wsCycles = ESP.getCycleCount();
   webSocket.loop();  // 處理 WebSocket 連線
+  profiler.record(HotPathProfiler::PROF_WS_LOOP, ESP.getCycleCount() - wsCycles);
+}
+
+// 每 2 秒印一次心跳，確認 loop 有在跑
+void taskHeartbeat() {
+  // 訂了 stats 的 client（記 log 的筆電）每個心跳週期收一次
+  if (wsSessions.anySubscriber(TOPIC_STATS)) {
+    static char json[1536];
+    size_t length = buildStatsJson(json, sizeof(json));
+    if (length) sendToTopic(TOPIC_STATS, json, length);
+  }
+
+  // led = 每幀 render 的 cycle 數（最近一次 / 這 2 秒最大）與含 Show() 的整幀最大值
+  // show = 實際 Show() 的幀數 / 畫面沒變省掉的幀數；idle = 沒有 task 在跑的比例（CPU 餘裕）
+  uint8_t present = tagPresence.presentCount();
+  char tags[16] = "no tag";
+  if (present) snprintf(tags, sizeof(tags), "%u tag(s)", present);
+  serialPrintf("[scan] %s (heap=%u, idle=%u‰, led render=%u/%u frame=%u cyc, show=%u skip=%u)\n", tags,
+               ESP.getFreeHeap(), (unsigned)scheduler.idlePermille(), (unsigned)ledRenderCycles,
+               (unsigned)ledRenderCyclesMax, (unsigned)ledFrameCyclesMax, (unsigned)ledFramesShown,
+               (unsigned)ledFramesSkipped);
+  ledRenderCyclesMax = 0;
+  ledFrameCyclesMax = 0;
+  ledFramesShown = 0;
+  ledFramesSkipped = 0;
+}
+
+// journal：RAM 裡累積夠多 / 放夠久才一次寫進 flash（掃卡路徑上不碰 flash）
+void taskJournal() {
+  scanJournal.maintain(millis());
+}
+
+// hold：grace 到期 / 該回報進度 / 滿了。進度直接送（掉了下一個就補上），完成排進事件佇列、記 journal
+void taskHold() {
+  unsigned long now = millis();
+  HoldTracker::Event event = holdTracker.poll(now);
+  if (event == HoldTracker::EV_NONE) return;
+  uint8_t bin[wsbin::MAX_FRAME];
+  uint32_t held = holdTracker.heldMs(now);
+
+  if (event == HoldTracker::EV_COMPLETE) {
+    JsonBuffer<80> message;
+    message.addString("type", "hold_complete").addUid("uid", holdTracker.uid(), holdTracker.uidLength());
+    message.addInt("ms", (long)held);
+    size_t binLength = wsbin::encodeHoldComplete(bin, holdTracker.uid(), holdTracker.uidLength(), held);
+    const char* json = message.finish();
+    broadcastEvent(json, message.length(), bin, binLength);
+    flushEvents();
+    serialPrintf("hold 完成（%lu ms）\n", (unsigned long)held);
+    return;
+  }
+
+  JsonBuffer<112> message;
+  message.addString("type", "hold_progress").addUid("uid", holdTracker.uid(), holdTracker.uidLength());
+  message.addInt("ms", (long)held).addInt("required", (long)holdTracker.requiredMs());
+  message.addBool("holding", holdTracker.holding());
+  size_t binLength = wsbin::encodeHoldProgress(bin, holdTracker.uid(), holdTracker.uidLength(), held,
+                                               holdTracker.requiredMs(), holdTracker.holding());
+  const char* json = message.finish();
+  sendToTopic(TOPIC_SCAN, json, message.length(), bin, binLength);
+  if (event == HoldTracker::EV_PAUSED) serialPrintf("hold 暫停（已累積 %lu ms）\n", (unsigned long)held);
+}
+
+// 放上的是不是正在等的那瓶（雞湯編號對、或萬用卡），拿走的時間用最後一次看到的
+void trackHold(const TagPresence::Event& event) {
+  if (!holdTracker.armed()) return;
+  const TagPresence::Tag& tag = event.tag;
+  if (event.type == TagPresence::TAG_LEAVE) {
+    holdTracker.leave(tag.uid, tag.uidLength, event.atMs);
+    return;
+  }
+  bool wildcard = detectNFCType(tag.uid, tag.uidLength) == NFC_WILDCARD;
+  if (holdTracker.matches(findQuoteByUID(tag.uid, tag.uidLength), wildcard)) {
+    holdTracker.enter(tag.uid, tag.uidLength, event.atMs);
+  }
+}
+
+// NFC：模擬模式 / 掃描二選一
+void taskNfc() {
+  unsigned long currentTime = millis();
 
   // 模擬模式優先處理（期間不讀瓶子）
   if (emulateMode) {
     if (millis() - emulateStartTime > EMULATE_TIMEOUT_MS) {
       Serial.println("模擬超時，退出");
       stopTagEmulation();
-      webSocket.broadcastTXT("{\"type\":\"nfc_emulate_timeout\"}");
+      sendToTopic(TOPIC_WRITE, "{\"type\":\"nfc_emulate_timeout\"}");
     } else {
       handleEmulationStep();
     }
     return;
   }
 
-  // NFC 輪詢節流：只每 150ms 讀一次 tagPresent（免得 loop 被卡慢、燈條動畫跳）
-  // 這段時間之間 loop 會快速空轉 → updateLeds() 可以 50fps 更新
-  static unsigned long lastNfcPoll = 0;
-  if (currentTime - lastNfcPoll < 150) return;
-  lastNfcPoll = currentTime;
+  // NFC：非同步 InListPassiveTarget。沒有指令在跑就送一個，之後每次只看一下結果出來沒
+  // 等卡的時間不會卡住 webSocket.loop() / Serial
+  if (!nfcReader.busy()) {
+    // 燒錄只寫 Tg 1，一次只選一張
+    bool writing = batchRunning || serialWriteMode;
+    nfcReader.startInList(NFC_INLIST_TIMEOUT_MS, writing ? 1 : NFC_MAX_TARGETS);
+  }
+  uint32_t pollCycles = ESP.getCycleCount();
+  Pn532Async::Result nfcResult = nfcReader.poll();
+  profiler.record(HotPathProfiler::PROF_NFC_POLL, ESP.getCycleCount() - pollCycles);
+  if (nfcResult == Pn532Async::PN532_PENDING) return;
+
+  if (nfcResult == Pn532Async::PN532_FAILED) {
+    // frame 壞掉 / PN532 沒回 ACK（沒插？）：卡片狀態不動，下一輪重送
+    static unsigned long lastNfcError = 0;
+    if (currentTime - lastNfcError >= 2000) {
+      Serial.printf("[scan] PN532 沒回應或 frame 錯誤（累計 %u 次）\n", (unsigned)nfcReader.errorCount());
+      lastNfcError = currentTime;
+    }
+    return;
+  }
+
+  if (nfcResult == Pn532Async::PN532_TAG_FOUND) {
+    // 卡還在：下一次 InList 等 recheck 到了再送，不用每 ms 重選一次卡
+    scheduler.defer(nfcTaskId, NFC_PRESENT_RECHECK_MS * 1000UL);
 
-  if (nfc.tagPresent()) {
     // ── 批次燒錄模式：偵測到卡就直接寫入，不走正常 WebSocket 流程 ──
-    if (serialWriteMode && serialPendingURL.length() > 0) {
+    // 剛剛 InList 選到的卡還是 PN532 的 Tg 1，NTAG 直接寫頁（writeAndVerifyURL），不用重選、也不用先 nfc.read()
+    if (batchRunning) {
+      handleBatchTag();
+      return;
+    }
+    if (serialWriteMode && serialPendingURL[0] != '\0') {
       Serial.println("[WRITE] 偵測到卡片，開始寫入...");
-      NfcTag tag = nfc.read();
-      String uid = "";
-      if (tag.getUidLength() > 0) {
-        byte uidBytes[7];
-        tag.getUid(uidBytes, tag.getUidLength());
-        uid = getUIDString(uidBytes, tag.getUidLength());
-      }
-      NdefMessage ndef;
-      ndef.addUriRecord(serialPendingURL.c_str());
-      bool ok = nfc.write(ndef);
+      char uid[kUidTextCapacity];
+      formatUid(nfcReader.uid(), nfcReader.uidLength(), uid, sizeof(uid));
+      const char* reason = "";
+      bool ok = writeAndVerifyURL(serialPendingURL, &reason);
       if (ok) {
-        Serial.println("OK:" + uid);
+        serialPrintf("OK:%s\r\n", uid);
       } else {
-        Serial.println("FAIL:write_error");
+        serialPrintf("FAIL:%s\r\n", reason);
       }
+      sendWriteResult(ok, serialPendingURL, reason);
       serialWriteMode = false;
-      serialPendingURL = "";
+      serialPendingURL[0] = '\0';
       return;
     }
 
     // 燈條狀態改由前端透過 WebSocket 推送（led_mode / led_progress），
     // 這邊不再自動因為有卡就切色
+  } else {
+    // 燈條狀態完全由前端決定，這邊只負責 NFC 通訊
 
-    // 快速讀取 UID（不讀取完整 NDEF 資料，避免 "Failed read page" 錯誤）
-    NfcTag tag = nfc.read();
+    // 批次燒錄：上一張卡拿走了，下一張（就算是同一張放回來）都算新卡
+    batchLastUIDLength = 0;
+  }
 
-    // 檢查讀取是否成功
-    if (tag.getUidLength() == 0) {
-      Serial.println("[DEBUG] UID 長度為 0，讀取失敗");
-      return;  // 下次 loop 的 NFC 節流會自然等 150ms
+  // 快速偵測：UID / SAK / ATQA 全部來自 InListPassiveTarget 的回應，完全不碰卡片記憶體
+  // （以前的 nfc.read() 會去讀 NDEF 頁，空白卡 / 非 NTAG 會印 "Failed read page"，也讓延遲忽長忽短）
+  // NDEF 只在燒錄（上面的 WRITE / 批次流程、writeURLToNFC）才讀寫
+  // 這次看到的卡（NO_TAG = 0 張）交給 tagPresence，每張 UID 各自產生放上 / 拿走
+  uint8_t seenCount = nfcResult == Pn532Async::PN532_TAG_FOUND ? nfcReader.targetCount() : 0;
+  TagPresence::Event events[TagPresence::kMaxEvents];
+  uint8_t eventCount = tagPresence.update(&nfcReader.target(0), seenCount, currentTime, events);
+  if (eventCount > 0) {
+    // 先排事件、馬上送出（這一輪的全部合成同一個 frame），log 最後才印：
+    // Serial FIFO 滿了會阻塞，印在前面會直接拖慢 show_context
+    for (uint8_t i = 0; i < eventCount; i++) {
+      queueTagEvent(events[i]);
+      trackHold(events[i]);
     }
+    flushEvents();
+    for (uint8_t i = 0; i < eventCount; i++) logTagEvent(events[i]);
+  }
 
-    // 讀取 UID
-    byte uid[7];
-    unsigned int uidLength = tag.getUidLength();
-    tag.getUid(uid, uidLength);
-    String currentUID = getUIDString(uid, uidLength);
+}
 
-    // 檢查 UID 是否有效
-    if (currentUID.length() < 10) {
-      Serial.printf("[DEBUG] UID 太短: %s (長度: %d)\n", currentUID.c_str(), currentUID.length());
-      return;  // 下次 loop 的 NFC 節流會自然等 150ms
-    }
+// 一張卡放上 / 拿走要送給前端的事件（只排進 outboundEvents，taskNfc 統一 flush）
+// 沒有 client 在聽也照排：flush 時會記進 journal，顯示端重連後 replay 補拿
+void queueTagEvent(const TagPresence::Event& event) {
+  const TagPresence::Tag& tag = event.tag;
+  // 4 / 7 bytes；10 bytes 的 triple-size UID 展場沒有，Pn532Async 會當 frame 錯誤
+  if (tag.uidLength < 4) return;
+  uint8_t bin[wsbin::MAX_FRAME];
+
+  if (event.type == TagPresence::TAG_LEAVE) {
+    // 無論哪種卡片都通知前端 hold 結束，帶 uid：兩張同時在場時前端只暫停拿走的那張
+    JsonBuffer<64> message;
+    message.addString("type", "nfc_hold_end").addUid("uid", tag.uid, tag.uidLength);
+    size_t binLength = wsbin::encodeHold(bin, wsbin::OP_HOLD_END, tag.uid, tag.uidLength);
+    const char* json = message.finish();
+    broadcastEvent(json, message.length(), bin, binLength);
+    return;
+  }
 
-    // 除錯：顯示偵測到的 UID（即使重複）
-    if (currentUID != lastUID) {
-      Serial.printf("[DEBUG] 偵測到新卡片 UID: %s (上次: %s)\n", currentUID.c_str(), lastUID.c_str());
-    }
+  NFCType nfcType = detectNFCType(tag.uid, tag.uidLength);
+  if (nfcType == NFC_WILDCARD) {
+    // 萬用卡 - 隨機抽一句雞湯（同時前端會用它當 soup/panel 階段的萬用瓶子）
+    sendRandomQuote();
+  } else if (nfcType == NFC_AI) {
+    // AI 解鎖卡 - 只在 chat-result-view 用來揭曉 AI 原句
+    broadcastEvent("{\"type\":\"ai_reveal\"}", wsbin::OP_AI_REVEAL);
+  } else if (nfcType == NFC_OTHER) {
+    // 其他卡片 - 顯示脈絡；編號直接查 firmware 內建的對照表（quote_uid_index），前端不用再去 JSON 找
+    // 查不到（未登錄的卡 / JSON 改了但還沒重燒）就只送 UID，前端會 fallback 自己查
+    // 格式: {"type":"show_context","uid":"04:..","quoteNumber":11}
+    int quoteNumber = findQuoteByUID(tag.uid, tag.uidLength);
+    JsonBuffer<80> message;
+    message.addString("type", "show_context").addUid("uid", tag.uid, tag.uidLength);
+    if (quoteNumber > 0) message.addInt("quoteNumber", quoteNumber);
+    size_t binLength = wsbin::encodeShowContext(bin, tag.uid, tag.uidLength, quoteNumber);
+    const char* json = message.finish();
+    broadcastEvent(json, message.length(), bin, binLength);
+  }
+  // 所有卡片都發送 nfc_hold_start（揭曉頁需要它累計 5 秒 hold）
+  JsonBuffer<64> message;
+  message.addString("type", "nfc_hold_start").addUid("uid", tag.uid, tag.uidLength);
+  size_t binLength = wsbin::encodeHold(bin, wsbin::OP_HOLD_START, tag.uid, tag.uidLength);
+  const char* json = message.finish();
+  broadcastEvent(json, message.length(), bin, binLength);
+}
 
-    // 偵測 NFC 類型
-    NFCType nfcType = detectNFCType(currentUID);
-
-    // 任何卡片都只在 UID 改變時觸發一次（要重觸發需移開再放回）
-    bool shouldProcess = (currentUID != lastUID);
-
-    if (shouldProcess) {
-      lastUID = currentUID;
-      lastTriggerTime = currentTime;
-
-      Serial.println("=================================");
-      Serial.println("NFC Tag Detected!");
-      Serial.println("---------------------------------");
-      Serial.print("UID: ");
-      Serial.println(currentUID);
-
-      if (nfcType == NFC_WILDCARD) {
-        // 萬用卡 - 隨機抽一句雞湯（同時前端會用它當 soup/panel 階段的萬用瓶子）
-        Serial.println("Type: Wildcard Card (隨機抽雞湯 / 萬用瓶子)");
-        Serial.println("=================================\n");
-
-        sendRandomQuote();
-      } else if (nfcType == NFC_AI) {
-        // AI 解鎖卡 - 只在 chat-result-view 用來揭曉 AI 原句
-        Serial.println("Type: AI Reveal Card (僅 chat-result-view 解鎖)");
-        Serial.println("=================================\n");
-
-        if (clientConnected) {
-          webSocket.broadcastTXT("{\"type\":\"ai_reveal\"}");
-          Serial.println("已發送 AI 解鎖指令");
-        } else {
-          Serial.println(">>> 注意：WebSocket 未連線 <<<");
-        }
-      } else {
-        // 其他卡片 - 顯示脈絡
-        Serial.println("Type: Context Card (顯示脈絡)");
-        Serial.println("=================================\n");
-
-        // 發送完整的 UID 給前端，由前端去 quotes.json 查找對應編號
-        Serial.printf("發送 UID: %s\n", currentUID.c_str());
-
-        // 發送 show_context 訊息給前端（包含 UID）
-        if (clientConnected) {
-          String message = "{\"type\":\"show_context\",\"uid\":\"" + currentUID + "\"}";
-          webSocket.broadcastTXT(message);
-          Serial.println("已發送顯示脈絡指令");
-        } else {
-          Serial.println(">>> 注意：WebSocket 未連線 <<<");
-        }
-      }
+void logTagEvent(const TagPresence::Event& event) {
+  const TagPresence::Tag& tag = event.tag;
+  bool listening = wsSessions.anySubscriber(TOPIC_SCAN);
+  if (tag.uidLength < 4) {
+    Serial.printf("[DEBUG] UID 長度不對: %u\n", tag.uidLength);
+    return;
+  }
+  char currentUID[kUidTextCapacity];
+  formatUid(tag.uid, tag.uidLength, currentUID, sizeof(currentUID));
 
-      // 所有卡片都發送 nfc_hold_start（揭曉頁需要它累計 5 秒 hold）
-      if (clientConnected) {
-        webSocket.broadcastTXT("{\"type\":\"nfc_hold_start\"}");
-        Serial.println("已發送 nfc_hold_start");
-      }
-    }
-  } else {
-    // 燈條狀態完全由前端決定，這邊只負責 NFC 通訊
+  if (event.type == TagPresence::TAG_LEAVE) {
+    serialPrintf("Tag removed: %s（感應區上還有 %u 張）\n\n", currentUID, tagPresence.presentCount());
+    Serial.println(listening ? "已發送 nfc_hold_end" : "nfc_hold_end 記進 journal（沒有 client）");
+    return;
+  }
 
-    // 沒有偵測到標籤時，清空 lastUID；無論哪種卡片都通知前端 hold 結束
-    if (lastUID != "") {
-      Serial.println("Tag removed.\n");
-      lastUID = "";
-      if (clientConnected) {
-        webSocket.broadcastTXT("{\"type\":\"nfc_hold_end\"}");
-        Serial.println("已發送 nfc_hold_end");
-      }
-    }
-    // 每 2 秒印一次心跳，確認 loop 有在跑、tagPresent 只是一直 false
-    static unsigned long lastHeartbeat = 0;
-    if (currentTime - lastHeartbeat >= 2000) {
-      Serial.printf("[scan] no tag (heap=%u)\n", ESP.getFreeHeap());
-      lastHeartbeat = currentTime;
+  NFCType nfcType = detectNFCType(tag.uid, tag.uidLength);
+  serialPrintf("[DEBUG] 偵測到新卡片 UID: %s（感應區上共 %u 張）\n", currentUID, tagPresence.presentCount());
+  Serial.println("=================================");
+  Serial.println("NFC Tag Detected!");
+  Serial.println("---------------------------------");
+  Serial.print("UID: ");
+  Serial.println(currentUID);
+
+  if (nfcType == NFC_WILDCARD) {
+    Serial.println("Type: Wildcard Card (隨機抽雞湯 / 萬用瓶子)");
+    Serial.println("=================================\n");
+    Serial.println("已發送隨機抽雞湯指令");
+  } else if (nfcType == NFC_AI) {
+    Serial.println("Type: AI Reveal Card (僅 chat-result-view 解鎖)");
+    Serial.println("=================================\n");
+    Serial.println(listening ? "已發送 AI 解鎖指令" : ">>> 注意：WebSocket 未連線，事件記進 journal，重連後補送 <<<");
+  } else {
+    int quoteNumber = findQuoteByUID(tag.uid, tag.uidLength);
+    Serial.println("Type: Context Card (顯示脈絡)");
+    Serial.println("=================================\n");
+    if (quoteNumber > 0) {
+      serialPrintf("發送 UID: %s  →  #%d\n", currentUID, quoteNumber);
+    } else {
+      serialPrintf("發送 UID: %s  (未登錄)\n", currentUID);
     }
+    Serial.println(listening ? "已發送顯示脈絡指令" : ">>> 注意：WebSocket 未連線，事件記進 journal，重連後補送 <<<");
   }
+  if (listening) Serial.println("已發送 nfc_hold_start");
+  serialPrintf("Card: %s (SAK %02X, ATQA %04X)\n", Pn532Async::familyName(tag.family()), tag.sak, tag.atqa);
 }
 
 // ===== 輔助函數 =====
 
-// 將 UID byte array 轉換為字串格式 (例如 "04:83:D5:22:BF:2A:81")
-String getUIDString(byte* uid, byte uidLength) {
-  String uidString = "";
-  for (byte i = 0; i < uidLength; i++) {
-    if (uid[i] < 0x10) uidString += "0";
-    uidString += String(uid[i], HEX);
-    if (i < uidLength - 1) uidString += ":";
-  }
-  uidString.toUpperCase();
-  return uidString;
+// Serial.printf 的 stack 版：ESP8266 core 的 printf 只有 64 bytes 的暫存，
+// 超過（中文 log 一行就超過）會 new 一塊 heap 再印。掃卡路徑上的 log 都走這裡
+void serialPrintf(const char* fmt, ...) {
+  char line[192];
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(line, sizeof(line), fmt, ap);
+  va_end(ap);
+  if (n < 0) return;
+  if ((size_t)n >= sizeof(line)) n = sizeof(line) - 1;
+  Serial.write(line, (size_t)n);
 }
 
-// 偵測 NFC 卡片類型
-NFCType detectNFCType(String uid) {
+// 偵測 NFC 卡片類型（直接比 raw bytes）
+NFCType detectNFCType(const uint8_t* uid, uint8_t uidLength) {
   // 測試模式：一律當作 wildcard（早期沒有實體 context 卡時用）
   if (TEST_ALL_AS_TRIGGER) {
     return NFC_WILDCARD;
   }
-  if (uid == WILDCARD_NFC_UID) {
+  if (uidLength == sizeof(WILDCARD_NFC_UID) && memcmp(uid, WILDCARD_NFC_UID, uidLength) == 0) {
     return NFC_WILDCARD;
   }
-  if (uid == AI_NFC_UID) {
+  if (uidLength == sizeof(AI_NFC_UID) && memcmp(uid, AI_NFC_UID, uidLength) == 0) {
     return NFC_AI;
   }
   return NFC_OTHER;
@@ -700,176 +1402,336 @@ NFCType detectNFCType(String uid) {
 void sendRandomQuote() {
   // 發送訊息給前端，讓前端從 200 句中隨機抽一句
   // 格式: {"type":"random_quote"}
-  String message = "{\"type\":\"random_quote\"}";
-
-  webSocket.broadcastTXT(message);
-  Serial.println("已發送隨機抽雞湯指令");
+  broadcastEvent("{\"type\":\"random_quote\"}", wsbin::OP_RANDOM_QUOTE);
 }
 
 // 寫入 URL 到 NFC 卡片
 bool writeURLToNFC(int quoteNumber) {
   // 組合完整 URL
   // 例如: https://thekingofchickensoup.framer.website/quotes/quote1
-  String url = String(QUOTE_BASE_URL) + String(quoteNumber);
+  // 組在 stack 上；writeAndVerifyURL 認得這個網址，會直接拿 flash 裡預先組好的 NDEF image
+  char url[WriteQueue::kMaxUrl + 1];
+  snprintf(url, sizeof(url), "%s%d", QUOTE_BASE_URL, quoteNumber);
 
   Serial.print("準備寫入 URL: ");
   Serial.println(url);
 
-  // 確認卡片還在讀取範圍內
-  if (!nfc.tagPresent()) {
-    Serial.println("錯誤：NFC 卡片已移除");
-    return false;
+  const char* reason = "";
+  bool success = writeAndVerifyURL(url, &reason);
+
+  if (success) {
+    Serial.printf("NDEF URL 寫入成功！（寫 %u 頁，內容相同跳過 %u 頁）\n", ntagWriter.pagesWritten(),
+                  ntagWriter.pagesSkipped());
+  } else {
+    Serial.printf("NDEF URL 寫入失敗 (%s)\n", reason);
   }
 
-  // 讀取 NFC 標籤
-  NfcTag tag = nfc.read();
+  return success;
+}
 
-  // 建立 NDEF 訊息
-  NdefMessage message = NdefMessage();
+// 寫入 URL 再讀回來比對；失敗時 *failReason = tag_lost / write_error / verify_mismatch / not_ndef / too_large
+// NTAG（Type 2）直接寫 NDEF image：雞湯網址用 flash 裡預先組好的，其他網址在 stack 上組，不碰 heap
+// 其他卡種才走 Seeed 的 NdefMessage
+bool writeAndVerifyURL(const char* url, const char** failReason) {
+  // 剛 InList 到的卡還選著就直接寫；正在等下一次 InList（或根本還沒選過卡）就原地重選一次
+  if (nfcReader.busy() || !nfcReader.hasTarget()) {
+    nfcReader.cancel();
+    if (!nfcReader.startInList(NFC_INLIST_TIMEOUT_MS) || nfcReader.wait() != Pn532Async::PN532_TAG_FOUND) {
+      *failReason = "tag_lost";
+      return false;
+    }
+  }
+  if (nfcReader.family() != Pn532Async::TAG_TYPE2) return writeAndVerifyNdefMessage(url, failReason);
+
+  uint8_t image[NtagWriter::kMaxImage];
+  int quoteNumber = quoteNumberFromURL(url);
+  ndef::Record record = ndef::uri(url);
+  uint8_t length = quoteNumber > 0 ? copyQuoteNdefImage(quoteNumber, image)
+                                   : (uint8_t)ndef::encodeType2Image(&record, 1, image, sizeof(image));
+  if (length == 0) {
+    *failReason = "too_large";
+    return false;
+  }
+  uint32_t writeCycles = ESP.getCycleCount();
+  NtagWriter::Result result = ntagWriter.write(image, length);
+  profiler.record(HotPathProfiler::PROF_NFC_WRITE, ESP.getCycleCount() - writeCycles);
+  *failReason = NtagWriter::resultName(result);
+  return result == NtagWriter::NTAG_OK;
+}
 
-  // 添加 URI record
-  // URI record type 會自動處理 https:// 前綴
-  message.addUriRecord(url.c_str());
+// 非 NTAG 的卡（MIFARE Classic ...）：Seeed 的同步 API，先停掉掃描用的非同步 InList 再讓它自己選一次卡
+bool writeAndVerifyNdefMessage(const char* url, const char** failReason) {
+  nfcReader.cancel();
+  if (!nfc.tagPresent()) {
+    *failReason = "tag_lost";
+    return false;
+  }
 
-  // 寫入 NFC
-  bool success = nfc.write(message);
+  // message 在 stack 上編好（前綴碼跟 NTAG 一樣取最長的），Seeed 只負責搬到卡上
+  ndef::Record record = ndef::uri(url);
+  uint8_t encoded[WriteQueue::kMaxUrl + 8];
+  size_t length = ndef::encodeMessage(&record, 1, encoded, sizeof(encoded));
+  if (length == 0) {
+    *failReason = "too_large";
+    return false;
+  }
+  NdefMessage message(encoded, (int)length);
+  if (!nfc.write(message)) {
+    *failReason = "write_error";
+    return false;
+  }
 
-  if (success) {
-    Serial.println("NDEF URL 寫入成功！");
+  // 讀回來整個 message 逐 byte 比對
+  // 寫到一半被拿走 / 貼紙壞頁時 write() 不一定會回 false，這裡才抓得到
+  *failReason = "verify_mismatch";
+  NfcTag tag = nfc.read();
+  if (!tag.hasNdefMessage()) return false;
+  NdefMessage written = tag.getNdefMessage();
+  if (written.getEncodedSize() != (int)length) return false;
+  uint8_t readBack[sizeof(encoded)];
+  written.encode(readBack);
+  return memcmp(readBack, encoded, length) == 0;
+}
+
+// ===== 批次燒錄：新卡 → 寫隊首的 URL =====
+void handleBatchTag() {
+  const uint8_t* uid = nfcReader.uid();
+  uint8_t uidLength = nfcReader.uidLength();
+  // 剛寫完（或剛失敗）的卡還放著：不動它，等換卡
+  if (uidLength == batchLastUIDLength && memcmp(uid, batchLastUID, uidLength) == 0) return;
+  // 佇列空了：卡先放著不記，host 補 QUEUE: 之後下一次 recheck 就會寫它
+  WriteQueue::Job* job = writeQueue.front();
+  if (!job) return;
+
+  memcpy(batchLastUID, uid, uidLength);
+  batchLastUIDLength = uidLength;
+  char uidString[kUidTextCapacity];
+  formatUid(uid, uidLength, uidString, sizeof(uidString));
+
+  unsigned long started = millis();
+  const char* reason = "";
+  bool ok = writeAndVerifyURL(job->url, &reason);
+  unsigned long elapsed = millis() - started;
+
+  // 結果一張一行，host 照 id 對回自己的清單
+  //   RESULT:<id>:OK:<uid>:<ms>
+  //   RESULT:<id>:FAIL:<reason>:<uid>:<第幾次>
+  //   RESULT:<id>:GIVEUP:<reason>          （同一個 URL 失敗太多次，丟掉換下一個）
+  if (ok) {
+    batchStats.written++;
+    serialPrintf("RESULT:%u:OK:%s:%lu\n", job->id, uidString, elapsed);
+    sendWriteResult(true, job->url);
+    writeQueue.pop();
   } else {
-    Serial.println("NDEF URL 寫入失敗");
+    batchStats.failed++;
+    job->attempts++;
+    serialPrintf("RESULT:%u:FAIL:%s:%s:%u\n", job->id, reason, uidString, job->attempts);
+    sendWriteResult(false, job->url, reason);
+    if (job->attempts >= WriteQueue::kMaxAttempts) {
+      batchStats.gaveUp++;
+      serialPrintf("RESULT:%u:GIVEUP:%s\n", job->id, reason);
+      writeQueue.pop();
+    }
   }
+  printBatchStats("BATCH_STATS");
+  if (writeQueue.empty()) Serial.println("BATCH_EMPTY");
+}
 
-  return success;
+// STATS:<probe>:... 每個 probe 一行、STATS:heap:...、STATS:task:<name>:... 每個 task 一行、
+// STATS:sched:idle_permille=...,idle_passes=...，最後 STATS_END（欄位見 hot_path_profiler.h / scheduler.h）
+void printProfilerStats() {
+  char line[160];
+  for (uint8_t i = 0; i < HotPathProfiler::PROF_COUNT; i++) {
+    profiler.formatLine((HotPathProfiler::Probe)i, line, sizeof(line));
+    Serial.println(line);
+  }
+  profiler.formatHeapLine(millis(), line, sizeof(line));
+  Serial.println(line);
+  for (uint8_t i = 0; i < scheduler.taskCount(); i++) {
+    scheduler.formatLine(i, line, sizeof(line));
+    Serial.println(line);
+  }
+  serialPrintf("STATS:sched:idle_permille=%u,idle_passes=%u\n", (unsigned)scheduler.idlePermille(),
+               (unsigned)scheduler.idlePasses());
+  Serial.println("STATS_END");
 }
 
-// 發送寫入結果到前端
-void sendWriteResult(bool success, int quoteNumber, String errorMsg) {
-  String message;
+// <label>:written=12,failed=1,gave_up=0,queued=15,tags_per_min=23.4
+void printBatchStats(const char* label) {
+  uint32_t rate = batchStats.tagsPerMinuteX10(millis());
+  serialPrintf("%s:written=%u,failed=%u,gave_up=%u,queued=%u,tags_per_min=%u.%u\n", label,
+               (unsigned)batchStats.written, (unsigned)batchStats.failed, (unsigned)batchStats.gaveUp,
+               (unsigned)writeQueue.count(), (unsigned)(rate / 10), (unsigned)(rate % 10));
+}
 
+// 發送寫入結果到前端（批次燒錄每張一個、Serial WRITE: 一個）
+// quoteNumber 從網址認；不是雞湯網址就是 -1
+void sendWriteResult(bool success, const char* url, const char* errorMsg) {
+  JsonBuffer<SERIAL_LINE_MAX + 96> message;
+  int quoteNumber = quoteNumberFromURL(url);
   if (success) {
     // 成功訊息
     // 格式: {"type":"nfc_write_success","quoteNumber":1,"url":"https://..."}
-    String url = String(QUOTE_BASE_URL) + String(quoteNumber);
-    message = "{\"type\":\"nfc_write_success\",\"quoteNumber\":" + String(quoteNumber) +
-              ",\"url\":\"" + url + "\"}";
+    message.addString("type", "nfc_write_success").addInt("quoteNumber", quoteNumber).addString("url", url);
   } else {
     // 失敗訊息
     // 格式: {"type":"nfc_write_error","quoteNumber":1,"error":"write_failed"}
-    message = "{\"type\":\"nfc_write_error\",\"quoteNumber\":" + String(quoteNumber) +
-              ",\"error\":\"" + errorMsg + "\"}";
+    message.addString("type", "nfc_write_error").addInt("quoteNumber", quoteNumber).addString("error", errorMsg);
   }
+  // 燒錄結果也是一個事件 frame：跟掃卡事件共用 seq、記進 journal（先把排著的掃卡事件送掉，seq 照順序）
+  flushEvents();
+  uint32_t seq = outboundEvents.takeSeq();
+  unsigned long now = millis();
+  message.addInt("seq", (long)seq).addInt("t", (long)now);
+  const char* json = message.finish();
+  if (!json) return;
 
-  webSocket.broadcastTXT(message);
-  Serial.println("已發送寫入結果: " + message);
-}
-
-// 從 JSON 文字裡抓出某個 key 的字串值（不完整 JSON parser，只處理 "key":"value"）
-String extractStringField(const String& msg, const char* key) {
-  String pattern = "\"";
-  pattern += key;
-  pattern += "\":\"";
-  int s = msg.indexOf(pattern);
-  if (s < 0) return "";
-  s += pattern.length();
-  int e = msg.indexOf("\"", s);
-  if (e < 0) return "";
-  return msg.substring(s, e);
-}
-
-// 把 URL 轉成 NDEF file 內容（含 2-byte 長度前綴），存到 ndefBuffer
-void buildNDEFFromURL(const String& url) {
-  String uri = url;
-  uint8_t prefixCode = 0x00;  // 0x00 = no prefix abbreviation
-  if (uri.startsWith("https://")) { uri = uri.substring(8); prefixCode = 0x04; }
-  else if (uri.startsWith("http://")) { uri = uri.substring(7); prefixCode = 0x03; }
-  else if (uri.startsWith("https://www.")) { uri = uri.substring(12); prefixCode = 0x02; }
-
-  uint16_t uriLen = uri.length();
-  uint16_t payloadLen = 1 + uriLen;              // prefix code + URI
-  uint16_t ndefRecordLen = 4 + payloadLen;       // header + typeLen + payloadLen + type + payload
-
-  if ((size_t)(ndefRecordLen + 2) > sizeof(ndefBuffer)) {
-    Serial.println("NDEF 太長，塞不下 buffer");
-    ndefBufferLen = 0;
-    return;
-  }
-
-  ndefBuffer[0] = (ndefRecordLen >> 8) & 0xFF;    // NLEN high
-  ndefBuffer[1] = ndefRecordLen & 0xFF;           // NLEN low
-  ndefBuffer[2] = 0xD1;                           // NDEF header: MB=1, ME=1, SR=1, TNF=001
-  ndefBuffer[3] = 0x01;                           // Type length
-  ndefBuffer[4] = (uint8_t)payloadLen;            // Payload length (short record, 1 byte)
-  ndefBuffer[5] = 'U';                            // Type "U"
-  ndefBuffer[6] = prefixCode;
-  for (uint16_t i = 0; i < uriLen; i++) ndefBuffer[7 + i] = (uint8_t)uri[i];
-  ndefBufferLen = 2 + ndefRecordLen;
-
-  Serial.printf("NDEF 準備完成，共 %u bytes (URI=%s, prefix=0x%02X)\n",
-                ndefBufferLen, uri.c_str(), prefixCode);
+  sendToTopic(TOPIC_WRITE, json, message.length());
+  scanJournal.append(seq, (uint32_t)now, TOPIC_WRITE, json, message.length(), now);
+  serialPrintf("已發送寫入結果: %.*s%s\r\n", (int)WS_ECHO_MAX, json, message.length() > WS_ECHO_MAX ? "…" : "");
 }
 
-// 切進 Type 4 tag 模擬模式
-// ⚠ 已停用：PN532 的 card emulation 無法被 iPhone 可靠讀取（Apple 不支援 Mifare Classic、
-// iPhone 靠近會先跳 Wallet），已改走實體 NTAG 貼紙流程。保留 stub 讓舊 WebSocket 指令不報錯。
+// 切進 Type 4 tag 模擬模式：ndefBuffer 要先準備好
+// 燒錄中不接（PN532 正在寫卡）
 bool startTagEmulation() {
-  Serial.println("tag emulation 已停用（iPhone 不相容）");
-  return false;
+  if (batchRunning || serialWriteMode || ndefBufferLen == 0) return false;
+  nfcReader.cancel();
+  if (!tagEmulator.start(ndefBuffer, ndefBufferLen, sizeof(ndefBuffer))) {
+    Serial.println("tag emulation 啟動失敗");
+    return false;
+  }
+  emulateMode = true;
+  emulateStartTime = millis();
+  Serial.printf("tag emulation 開始，NDEF file %u bytes\n", ndefBufferLen);
+  return true;
 }
 
-// 處理一輪 APDU — stub
+// 推進一步 APDU 交換（不阻塞）；手機讀完整個 NDEF file 就通知前端、回到 reader 模式
 void handleEmulationStep() {
-  stopTagEmulation();
+  switch (tagEmulator.poll()) {
+    case Type4Emulator::EMU_PHONE:
+      Serial.println("手機靠近，ISO-DEP 建立");
+      break;
+    case Type4Emulator::EMU_READ: {
+      Serial.printf("手機讀完 NDEF：%lu ms，%u 個 APDU\n", tagEmulator.lastReadMs(), tagEmulator.lastApdus());
+      char json[64];
+      snprintf(json, sizeof(json), "{\"type\":\"nfc_emulate_read\",\"ms\":%lu}", tagEmulator.lastReadMs());
+      stopTagEmulation();
+      sendToTopic(TOPIC_WRITE, json);
+      break;
+    }
+    case Type4Emulator::EMU_LOST:
+      Serial.println("手機沒讀完就離開，繼續等");
+      break;
+    default:
+      break;
+  }
 }
 
 // ===== Serial 批次燒錄指令處理 =====
 // 指令格式：
 //   WRITE:https://...   → 進入等待，下一張 NFC 偵測到即寫入
-//   CANCEL              → 取消等待
+//   QUEUE:https://...   → 加進批次佇列，回 QUEUED:<id>:<剩幾格>
+//   START               → 開始批次燒錄（每張新卡寫隊首的 URL，逐張回 RESULT:...）
+//   STOP                → 暫停批次，佇列保留
+//   CANCEL              → 取消等待 / 停止批次並清空佇列
 //   STATUS              → 回報目前狀態
+//   STATS               → 熱路徑 profiler：每個 probe 一行 STATS:<probe>:...，heap 一行，
+//                         每個 task 一行 STATS:task:<name>:...，排程器 idle 一行，最後 STATS_END
+//   STATS_RESET         → 清掉 profiler / task 統計，重新開始一個量測區間
+// 去掉頭尾的空白 / tab（就地），回傳新的開頭
+char* trimSerialLine(char* line) {
+  while (*line == ' ' || *line == '\t') line++;
+  size_t n = strlen(line);
+  while (n > 0 && (line[n - 1] == ' ' || line[n - 1] == '\t')) line[--n] = '\0';
+  return line;
+}
+
+void handleSerialCommand(char* cmd) {
+  if (strncmp(cmd, "WRITE:", 6) == 0 && batchRunning) {
+    Serial.println("ERR:batch_running");
+  } else if (strncmp(cmd, "WRITE:", 6) == 0) {
+    strcpy(serialPendingURL, trimSerialLine(cmd + 6));
+    if (serialPendingURL[0] == '\0') {
+      Serial.println("ERR:empty_url");
+    } else {
+      serialWriteMode = true;
+      Serial.println("READY_FOR_TAG");
+    }
+  } else if (strncmp(cmd, "QUEUE:", 6) == 0) {
+    const char* url = trimSerialLine(cmd + 6);
+    size_t urlLength = strlen(url);
+    uint16_t id = writeQueue.push(url, urlLength);
+    if (id) {
+      Serial.printf("QUEUED:%u:%u\n", id, writeQueue.freeSlots());
+    } else if (urlLength == 0) {
+      Serial.println("ERR:empty_url");
+    } else if (urlLength > WriteQueue::kMaxUrl) {
+      Serial.println("ERR:url_too_long");
+    } else {
+      Serial.println("ERR:queue_full");
+    }
+  } else if (strcmp(cmd, "START") == 0) {
+    serialWriteMode = false;
+    serialPendingURL[0] = '\0';
+    batchRunning = true;
+    batchStats.reset(millis());
+    Serial.printf("BATCH_STARTED:%u\n", writeQueue.count());
+  } else if (strcmp(cmd, "STOP") == 0) {
+    batchRunning = false;
+    printBatchStats("BATCH_STOPPED");
+  } else if (strcmp(cmd, "CANCEL") == 0) {
+    serialWriteMode = false;
+    serialPendingURL[0] = '\0';
+    batchRunning = false;
+    writeQueue.clear();
+    Serial.println("CANCELLED");
+  } else if (strcmp(cmd, "STATS") == 0) {
+    printProfilerStats();
+  } else if (strcmp(cmd, "STATS_RESET") == 0) {
+    profiler.reset(millis());
+    scheduler.resetStats();
+    Serial.println("STATS_RESET:OK");
+  } else if (strcmp(cmd, "STATUS") == 0) {
+    if (serialWriteMode) {
+      serialPrintf("WAITING_FOR_TAG:%s\r\n", serialPendingURL);
+    } else if (batchRunning) {
+      printBatchStats("BATCH_RUNNING");
+    } else if (!writeQueue.empty()) {
+      Serial.printf("BATCH_QUEUED:%u\n", writeQueue.count());
+    } else {
+      Serial.println("IDLE");
+    }
+  } else {
+    serialPrintf("ERR:unknown_cmd:%s\r\n", cmd);
+  }
+}
+
 void handleSerialCommands() {
   while (Serial.available()) {
     char c = (char)Serial.read();
-    if (c == '\n' || c == '\r') {
-      serialBuffer.trim();
-      if (serialBuffer.length() == 0) { serialBuffer = ""; continue; }
-
-      String cmd = serialBuffer;
-      serialBuffer = "";
-
-      if (cmd.startsWith("WRITE:")) {
-        serialPendingURL = cmd.substring(6);
-        serialPendingURL.trim();
-        if (serialPendingURL.length() == 0) {
-          Serial.println("ERR:empty_url");
-        } else {
-          serialWriteMode = true;
-          Serial.println("READY_FOR_TAG");
-        }
-      } else if (cmd == "CANCEL") {
-        serialWriteMode = false;
-        serialPendingURL = "";
-        Serial.println("CANCELLED");
-      } else if (cmd == "STATUS") {
-        if (serialWriteMode) {
-          Serial.println("WAITING_FOR_TAG:" + serialPendingURL);
-        } else {
-          Serial.println("IDLE");
-        }
-      } else {
-        Serial.println("ERR:unknown_cmd:" + cmd);
-      }
-    } else {
-      serialBuffer += c;
+    if (c != '\n' && c != '\r') {
+      if (serialLineLength < SERIAL_LINE_MAX) serialLine[serialLineLength++] = c;
+      else serialLineOverflow = true;
+      continue;
+    }
+    serialLine[serialLineLength] = '\0';
+    bool overflow = serialLineOverflow;
+    serialLineLength = 0;
+    serialLineOverflow = false;
+    if (overflow) {
+      Serial.println("ERR:line_too_long");
+      continue;
     }
+    char* cmd = trimSerialLine(serialLine);
+    if (cmd[0] != '\0') handleSerialCommand(cmd);
   }
 }
 
 // 退出模擬模式，回到一般 reader 模式
 void stopTagEmulation() {
   emulateMode = false;
-  selectedFile = 0;
-  // 重新初始化 SAM 讓 PN532 回到 reader 模式
-  pn532.SAMConfig();
+  // 下一個 InListPassiveTarget 就把 PN532 切回 reader
+  tagEmulator.stop();
   Serial.println("已退出模擬模式，恢復 reader");
 }
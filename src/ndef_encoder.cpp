@@ -0,0 +1,186 @@
+#include "ndef_encoder.h"
+
+#include <string.h>
+
+namespace ndef {
+
+namespace {
+
+const uint8_t FLAG_MB = 0x80;
+const uint8_t FLAG_ME = 0x40;
+const uint8_t FLAG_SR = 0x10;
+const uint8_t TNF_WELL_KNOWN = 0x01;
+const uint8_t TNF_EXTERNAL = 0x04;
+
+const char AAR_TYPE[] = "android.com:pkg";
+const uint8_t TEXT_MAX_LANGUAGE = 0x3F;   // status byte 的低 6 bits
+const size_t MAX_MESSAGE = 0xFFFE;        // Type 2 的 3-byte TLV 長度 / Type 4 的 NLEN 都到這裡
+
+// NFC Forum URI RTD 表 3：code = 陣列 index + 1
+const char* const URI_PREFIXES[] = {
+  "http://www.", "https://www.", "http://", "https://", "tel:", "mailto:", "ftp://anonymous:anonymous@",
+  "ftp://ftp.", "ftps://", "sftp://", "smb://", "nfs://", "ftp://", "dav://", "news:", "telnet://", "imap:",
+  "rtsp://", "urn:", "pop:", "sip:", "sips:", "tftp:", "btspp://", "btl2cap://", "btgoep://", "tcpobex://",
+  "irdaobex://", "file://", "urn:epc:id:", "urn:epc:tag:", "urn:epc:pat:", "urn:epc:raw:", "urn:epc:", "urn:nfc:",
+};
+const uint8_t URI_PREFIX_COUNT = sizeof(URI_PREFIXES) / sizeof(URI_PREFIXES[0]);
+
+// 一筆 record 編碼時要知道的東西，大小跟寫入共用，兩邊才不會算得不一樣
+struct Layout {
+  uint8_t tnf;
+  const char* type;
+  uint8_t typeLength;
+  uint8_t prefix[1 + TEXT_MAX_LANGUAGE];   // payload 開頭固定的部分：URI 前綴碼 / Text 的 status + 語言碼
+  uint8_t prefixLength;
+  const char* body;                        // payload 其餘部分，直接從呼叫端的字串複製
+  size_t bodyLength;
+
+  size_t payloadLength() const { return prefixLength + bodyLength; }
+  size_t size() const { return 2 + (payloadLength() <= 0xFF ? 1 : 4) + typeLength + payloadLength(); }
+};
+
+bool layout(const Record& r, Layout* out) {
+  if (!r.value) return false;
+  switch (r.kind) {
+    case Record::URI: {
+      size_t matched;
+      out->tnf = TNF_WELL_KNOWN;
+      out->type = "U";
+      out->typeLength = 1;
+      out->prefix[0] = uriPrefixCode(r.value, &matched);
+      out->prefixLength = 1;
+      out->body = r.value + matched;
+      break;
+    }
+    case Record::TEXT: {
+      const char* language = r.language ? r.language : "";
+      size_t languageLength = strlen(language);
+      if (languageLength > TEXT_MAX_LANGUAGE) return false;
+      out->tnf = TNF_WELL_KNOWN;
+      out->type = "T";
+      out->typeLength = 1;
+      out->prefix[0] = (uint8_t)languageLength;   // bit 7 = 0：UTF-8
+      memcpy(out->prefix + 1, language, languageLength);
+      out->prefixLength = (uint8_t)(1 + languageLength);
+      out->body = r.value;
+      break;
+    }
+    case Record::ANDROID_APP:
+      out->tnf = TNF_EXTERNAL;
+      out->type = AAR_TYPE;
+      out->typeLength = sizeof(AAR_TYPE) - 1;
+      out->prefixLength = 0;
+      out->body = r.value;
+      break;
+    default:
+      return false;
+  }
+  out->bodyLength = strlen(out->body);
+  return true;
+}
+
+// 外框的大小：Type 2 = TLV 頭 + terminator + 補齊；Type 4 = NLEN
+size_t type2Framing(size_t message) {
+  size_t length = (message < 0xFF ? 2 : 4) + message + 1;
+  return (length + 3) & ~(size_t)3;
+}
+
+}  // namespace
+
+uint8_t uriPrefixCode(const char* uri, size_t* matched) {
+  uint8_t code = 0x00;
+  size_t best = 0;
+  for (uint8_t i = 0; i < URI_PREFIX_COUNT; i++) {
+    size_t n = strlen(URI_PREFIXES[i]);
+    if (n > best && strncmp(uri, URI_PREFIXES[i], n) == 0) {
+      best = n;
+      code = (uint8_t)(i + 1);
+    }
+  }
+  *matched = best;
+  return code;
+}
+
+const char* uriPrefixText(uint8_t code) {
+  if (code == 0x00) return "";
+  return code <= URI_PREFIX_COUNT ? URI_PREFIXES[code - 1] : nullptr;
+}
+
+size_t messageSize(const Record* records, size_t count) {
+  if (count == 0) return 0;
+  size_t total = 0;
+  for (size_t i = 0; i < count; i++) {
+    Layout l;
+    if (!layout(records[i], &l)) return 0;
+    total += l.size();
+  }
+  return total <= MAX_MESSAGE ? total : 0;
+}
+
+size_t encodeMessage(const Record* records, size_t count, uint8_t* out, size_t capacity) {
+  size_t total = messageSize(records, count);
+  if (total == 0 || total > capacity) return 0;
+  size_t n = 0;
+  for (size_t i = 0; i < count; i++) {
+    Layout l;
+    layout(records[i], &l);
+    size_t payload = l.payloadLength();
+    bool shortRecord = payload <= 0xFF;
+    out[n++] = (uint8_t)((i == 0 ? FLAG_MB : 0) | (i + 1 == count ? FLAG_ME : 0) | (shortRecord ? FLAG_SR : 0) | l.tnf);
+    out[n++] = l.typeLength;
+    if (shortRecord) {
+      out[n++] = (uint8_t)payload;
+    } else {
+      out[n++] = (uint8_t)(payload >> 24);
+      out[n++] = (uint8_t)(payload >> 16);
+      out[n++] = (uint8_t)(payload >> 8);
+      out[n++] = (uint8_t)payload;
+    }
+    memcpy(out + n, l.type, l.typeLength);
+    n += l.typeLength;
+    memcpy(out + n, l.prefix, l.prefixLength);
+    n += l.prefixLength;
+    memcpy(out + n, l.body, l.bodyLength);
+    n += l.bodyLength;
+  }
+  return n;
+}
+
+size_t type2ImageSize(const Record* records, size_t count) {
+  size_t message = messageSize(records, count);
+  return message ? type2Framing(message) : 0;
+}
+
+size_t encodeType2Image(const Record* records, size_t count, uint8_t* out, size_t capacity) {
+  size_t message = messageSize(records, count);
+  if (message == 0 || type2Framing(message) > capacity) return 0;
+  size_t n = 0;
+  out[n++] = 0x03;   // NDEF Message TLV
+  if (message < 0xFF) {
+    out[n++] = (uint8_t)message;
+  } else {
+    out[n++] = 0xFF;
+    out[n++] = (uint8_t)(message >> 8);
+    out[n++] = (uint8_t)message;
+  }
+  n += encodeMessage(records, count, out + n, capacity - n);
+  out[n++] = 0xFE;   // Terminator TLV
+  size_t padded = type2Framing(message);
+  while (n < padded) out[n++] = 0x00;
+  return n;
+}
+
+size_t type4FileSize(const Record* records, size_t count) {
+  size_t message = messageSize(records, count);
+  return message ? 2 + message : 0;
+}
+
+size_t encodeType4File(const Record* records, size_t count, uint8_t* out, size_t capacity) {
+  size_t message = messageSize(records, count);
+  if (message == 0 || 2 + message > capacity) return 0;
+  out[0] = (uint8_t)(message >> 8);   // NLEN
+  out[1] = (uint8_t)message;
+  return 2 + encodeMessage(records, count, out + 2, capacity - 2);
+}
+
+}  // namespace ndef
@@ -0,0 +1,54 @@
+#pragma once
+// ===== NDEF 編碼（直接寫進呼叫端的 buffer）=====
+// 以前 URL → NDEF 有三份：main.cpp 的 buildNDEFFromURL（模擬用，payload 長度只寫 1 byte，
+// 而且先比 "https://" 所以 0x02 "https://www." 永遠用不到）、NtagWriter::encodeUri（只有 4 種前綴）、
+// MIFARE Classic 走 Seeed 的 addUriRecord（前綴碼永遠 0x00，整段網址照存）。
+// 現在都用這裡：
+//   - URI 前綴碼是 NFC Forum URI RTD 的整張表（0x01~0x23），取最長的那個
+//   - payload 超過 255 bytes 自動改用 long record（4-byte payload length）
+//   - 一個 message 可以有好幾筆 record（URI + 文字 / Android Application Record），MB / ME 自動標
+//   - 字串直接從呼叫端的記憶體複製進輸出，不經過 String / 中間 buffer，不碰 heap
+//   - 每種輸出都有對應的 xxxSize()，不寫任何東西就能拿到精確的大小
+//
+// 外框：
+//   Type 2（NTAG 貼紙）  03 LEN message FE，補 0 到 4 的倍數（LEN ≥ 0xFF 用 FF hi lo）
+//   Type 4（ISO-DEP 模擬）NDEF file = NLEN（2 bytes big-endian）+ message
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ndef {
+
+// 一筆 record；字串都指向呼叫端的記憶體，編碼完才可以動
+struct Record {
+  enum Kind : uint8_t {
+    URI,           // TNF well-known "U"：value = 完整網址
+    TEXT,          // TNF well-known "T"：value = UTF-8 文字，language = 語言碼（"en"、"zh-TW"，最長 63）
+    ANDROID_APP    // TNF external "android.com:pkg"：value = package name（Android 直接開這個 app）
+  };
+  Kind kind;
+  const char* value;
+  const char* language;
+};
+
+inline Record uri(const char* value) { return Record{Record::URI, value, nullptr}; }
+inline Record text(const char* value, const char* language = "en") { return Record{Record::TEXT, value, language}; }
+inline Record androidApp(const char* package) { return Record{Record::ANDROID_APP, package, nullptr}; }
+
+// 最長符合的前綴碼，*matched = 前綴幾個字；都不符合回 0x00（matched = 0）
+uint8_t uriPrefixCode(const char* uri, size_t* matched);
+// 前綴碼 → 文字（0x00 = ""）；不認得的碼回 nullptr
+const char* uriPrefixText(uint8_t code);
+
+// NDEF message 本身（沒有外框）；record 不合法（語言碼太長、count 0）回 0
+size_t messageSize(const Record* records, size_t count);
+// 寫進 out，回傳長度；放不下或不合法回 0，不會寫超過 capacity
+size_t encodeMessage(const Record* records, size_t count, uint8_t* out, size_t capacity);
+
+size_t type2ImageSize(const Record* records, size_t count);
+size_t encodeType2Image(const Record* records, size_t count, uint8_t* out, size_t capacity);
+
+size_t type4FileSize(const Record* records, size_t count);
+size_t encodeType4File(const Record* records, size_t count, uint8_t* out, size_t capacity);
+
+}  // namespace ndef
@@ -0,0 +1,80 @@
+#include "ntag_writer.h"
+
+#include "hal.h"
+#include "pn532_async.h"
+
+namespace {
+
+const uint8_t PN532_CMD_INDATAEXCHANGE = 0x40;
+const uint8_t PN532_CMD_INCOMMUNICATETHRU = 0x42;
+const uint8_t NTAG_CMD_WRITE = 0xA2;
+const uint8_t NTAG_CMD_FAST_READ = 0x3A;
+
+const uint8_t NTAG_CC_PAGE = 3;
+const uint8_t NTAG_CC_MAGIC = 0xE1;   // CC byte 0：NDEF 格式
+
+// 指令都在 PN532 手上等 RF 回來；WRITE 含 EEPROM 燒寫約 4ms，FAST_READ 32 頁約 12ms
+const uint16_t NTAG_WRITE_TIMEOUT_MS = 30;
+const uint16_t NTAG_READ_TIMEOUT_MS = 50;
+
+}  // namespace
+
+const char* NtagWriter::resultName(Result result) {
+  switch (result) {
+    case NTAG_OK: return "ok";
+    case NTAG_TAG_LOST: return "tag_lost";
+    case NTAG_NOT_NDEF: return "not_ndef";
+    case NTAG_TOO_LARGE: return "too_large";
+    case NTAG_WRITE_ERROR: return "write_error";
+    case NTAG_VERIFY_MISMATCH: return "verify_mismatch";
+  }
+  return "unknown";
+}
+
+NtagWriter::Result NtagWriter::write(const uint8_t* image, uint8_t length) {
+  pagesWritten_ = 0;
+  pagesSkipped_ = 0;
+  if (length == 0 || (length & 3) || length > kMaxImage) return NTAG_TOO_LARGE;
+  uint8_t pages = length / 4;
+
+  // CC + 目前的內容一次讀回來：CC 判斷格式 / 容量，內容拿來跳過不用寫的頁
+  uint8_t current[4 + kMaxImage];
+  if (!fastRead(NTAG_CC_PAGE, 1 + pages, current)) return NTAG_TAG_LOST;
+  const uint8_t* cc = current;
+  if (cc[0] != NTAG_CC_MAGIC || (cc[3] & 0xF0) != 0) return NTAG_NOT_NDEF;
+  if (length > cc[2] * 8) return NTAG_TOO_LARGE;   // NTAG213 = 0x12 (144 bytes)、215 = 0x3E、216 = 0x6D
+
+  for (uint8_t i = 0; i < pages; i++) {
+    const uint8_t* want = image + i * 4;
+    if (memcmp(current + 4 + i * 4, want, 4) == 0) {
+      pagesSkipped_++;
+      continue;
+    }
+    if (!writePage(kFirstDataPage + i, want)) return NTAG_WRITE_ERROR;
+    pagesWritten_++;
+  }
+  if (pagesWritten_ == 0) return NTAG_OK;   // 上面讀到的就是最終內容
+
+  // 讀回比對：寫到一半被拿走 / 壞頁時 WRITE 不一定會 NAK
+  if (!fastRead(kFirstDataPage, pages, current)) return NTAG_VERIFY_MISMATCH;
+  return memcmp(current, image, length) == 0 ? NTAG_OK : NTAG_VERIFY_MISMATCH;
+}
+
+bool NtagWriter::fastRead(uint8_t firstPage, uint8_t pages, uint8_t* out) {
+  const uint8_t cmd[] = { PN532_CMD_INCOMMUNICATETHRU, NTAG_CMD_FAST_READ, firstPage,
+                          (uint8_t)(firstPage + pages - 1) };
+  // 回應：status + 4 × pages
+  uint8_t response[1 + 4 + kMaxImage];
+  int n = reader_.transceive(cmd, sizeof(cmd), NTAG_READ_TIMEOUT_MS, response, sizeof(response));
+  if (n != 1 + pages * 4 || (response[0] & 0x3F) != 0) return false;
+  memcpy(out, response + 1, pages * 4);
+  return true;
+}
+
+bool NtagWriter::writePage(uint8_t page, const uint8_t* data) {
+  // Tg = 1（InList 選到的那張）
+  const uint8_t cmd[] = { PN532_CMD_INDATAEXCHANGE, 0x01, NTAG_CMD_WRITE, page, data[0], data[1], data[2], data[3] };
+  uint8_t status;
+  int n = reader_.transceive(cmd, sizeof(cmd), NTAG_WRITE_TIMEOUT_MS, &status, 1);
+  return n == 1 && (status & 0x3F) == 0;
+}
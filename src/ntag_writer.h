@@ -0,0 +1,55 @@
+#pragma once
+// ===== NTAG213 / 215 / 216 直接寫入 =====
+// 以前燒錄走 Seeed 的 nfc.write()：heap 上組 NdefMessage、先 nfc.read() 把整張卡讀一遍、
+// 再由 library 一頁一頁寫 TLV。這裡直接對 Type 2 tag 下指令（NXP NTAG213/215/216 datasheet §10）：
+//
+//   FAST_READ 3..N   ── 一次讀回 CC + 目前的 NDEF 區（InCommunicateThru）
+//   WRITE page × k   ── 只寫跟 image 不一樣的頁，4 bytes 一次（InDataExchange）
+//   FAST_READ 4..N   ── 一次讀回比對（一頁都沒寫就不用再讀）
+//
+// 寫的是「預先組好的 NDEF TLV image」：03 LEN [D1 01 LEN 'U' 前綴碼 URI] FE，補 0 到 4 的倍數，
+// 從 page 4 開始放。雞湯 URL 的 image 在 build 時就產生好放 flash（見 quote_ndef_image.h），
+// 其他 URL 用 ndef::encodeType2Image()（ndef_encoder.h）組在 stack 上，整段不碰 heap。
+//
+// 卡必須是 Pn532Async 最近一次 InList 選到的那張（hasTarget()）；卡拿走之後 PN532 會回錯誤 → TAG_LOST
+
+#include <stddef.h>
+#include <stdint.h>
+
+class Pn532Async;
+
+class NtagWriter {
+ public:
+  enum Result : uint8_t {
+    NTAG_OK,
+    NTAG_TAG_LOST,          // FAST_READ 沒回應：卡拿走了 / 不是 Type 2
+    NTAG_NOT_NDEF,          // CC 不是 NDEF 格式，或唯讀
+    NTAG_TOO_LARGE,         // image 比卡的 NDEF 區大
+    NTAG_WRITE_ERROR,       // WRITE 被 NAK / 寫到一半卡不見
+    NTAG_VERIFY_MISMATCH    // 寫完讀回來不一樣
+  };
+  // 跟 Serial 協定的失敗原因同一組字（tag_lost / write_error / verify_mismatch ...）
+  static const char* resultName(Result result);
+
+  static const uint8_t kFirstDataPage = 4;
+  // 120 字的 URL（WriteQueue::kMaxUrl）不縮寫前綴也放得下：2 + 4 + 1 + 120 + 1 = 128
+  static const uint8_t kMaxImage = 128;
+
+  explicit NtagWriter(Pn532Async& reader) : reader_(reader) {}
+
+  // image 在 RAM（flash 上的先 memcpy_P 出來），長度必須是 4 的倍數
+  Result write(const uint8_t* image, uint8_t length);
+
+  // 上一次 write() 實際寫了幾頁 / 內容本來就一樣跳過幾頁
+  uint8_t pagesWritten() const { return pagesWritten_; }
+  uint8_t pagesSkipped() const { return pagesSkipped_; }
+
+ private:
+  // 讀 [firstPage, firstPage + pages) 到 out；回傳 false = 卡沒回應
+  bool fastRead(uint8_t firstPage, uint8_t pages, uint8_t* out);
+  bool writePage(uint8_t page, const uint8_t* data);
+
+  Pn532Async& reader_;
+  uint8_t pagesWritten_ = 0;
+  uint8_t pagesSkipped_ = 0;
+};
@@ -0,0 +1,200 @@
+#include "pn532_async.h"
+
+#include "hal.h"
+
+namespace {
+
+const uint8_t PN532_HOST_TO_PN532 = 0xD4;
+const uint8_t PN532_PN532_TO_HOST = 0xD5;
+const uint8_t PN532_CMD_INLISTPASSIVETARGET = 0x4A;
+const uint8_t PN532_CMD_TGINITASTARGET = 0x8C;
+const uint8_t PN532_ERROR_FRAME_TFI = 0x7F;   // application level error：00 00 FF 01 FF 7F 81 00
+
+// ACK 兩個方向都一樣；host 送 ACK 給 PN532 = 中止目前指令
+const uint8_t PN532_ACK[6] = { 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00 };
+
+}  // namespace
+
+bool Pn532Async::startInList(uint16_t timeoutMs, uint8_t maxTargets) {
+  if (maxTargets < 1) maxTargets = 1;
+  if (maxTargets > kMaxTargets) maxTargets = kMaxTargets;
+  // MaxTg，BrTy = 0x00（106 kbps Type A）
+  const uint8_t cmd[] = { PN532_CMD_INLISTPASSIVETARGET, maxTargets, 0x00 };
+  const Span part = { cmd, sizeof(cmd) };
+  if (!sendCommand(&part, 1, timeoutMs)) return false;
+  hasTarget_ = false;   // 新的 InList 會把之前選到的卡放掉
+  return true;
+}
+
+bool Pn532Async::startCommand(const uint8_t* data, uint8_t length, uint16_t timeoutMs, uint8_t* response,
+                              uint8_t capacity) {
+  const Span part = { data, length };
+  return startCommand(&part, 1, timeoutMs, response, capacity);
+}
+
+bool Pn532Async::startCommand(const Span* parts, uint8_t count, uint16_t timeoutMs, uint8_t* response,
+                              uint8_t capacity) {
+  if (count == 0 || parts[0].length == 0 || parts[0].data[0] == PN532_CMD_INLISTPASSIVETARGET) {
+    return startInList(timeoutMs);
+  }
+  if (!sendCommand(parts, count, timeoutMs)) return false;
+  // 切成 target 模式：之前 InList 選到的卡放掉了
+  if (parts[0].data[0] == PN532_CMD_TGINITASTARGET) hasTarget_ = false;
+  response_ = response;
+  responseCapacity_ = capacity;
+  responseLength_ = 0;
+  return true;
+}
+
+Pn532Async::Result Pn532Async::wait() {
+  for (;;) {
+    Result r = poll();
+    if (r != PN532_PENDING || state_ == STATE_IDLE) return r;
+    yield();
+  }
+}
+
+int Pn532Async::transceive(const uint8_t* data, uint8_t length, uint16_t timeoutMs, uint8_t* response,
+                           uint8_t capacity) {
+  if (!startCommand(data, length, timeoutMs, response, capacity)) return -1;
+  return wait() == PN532_RESPONSE ? responseLength_ : -1;
+}
+
+bool Pn532Async::sendCommand(const Span* parts, uint8_t count, uint16_t timeoutMs) {
+  if (state_ != STATE_IDLE) return false;
+  size_t length = 0;
+  for (uint8_t i = 0; i < count; i++) length += parts[i].length;
+  if (length == 0 || length + 8 > kMaxFrame) return false;
+
+  // 00 00 FF LEN LCS D4 data... DCS 00
+  uint8_t frame[kMaxFrame];
+  uint8_t len = (uint8_t)(length + 1);   // 含 TFI
+  uint8_t n = 0;
+  frame[n++] = 0x00;
+  frame[n++] = 0x00;
+  frame[n++] = 0xFF;
+  frame[n++] = len;
+  frame[n++] = (uint8_t)(~len + 1);
+  frame[n++] = PN532_HOST_TO_PN532;
+  uint8_t sum = PN532_HOST_TO_PN532;
+  for (uint8_t i = 0; i < count; i++) {
+    for (uint8_t k = 0; k < parts[i].length; k++) {
+      frame[n++] = parts[i].data[k];
+      sum += parts[i].data[k];
+    }
+  }
+  frame[n++] = (uint8_t)(~sum + 1);
+  frame[n++] = 0x00;
+
+  bus_.writeFrame(frame, n);
+  command_ = frame[6];
+  deadline_ = millis() + timeoutMs;
+  state_ = STATE_WAIT_ACK;
+  commands_++;
+  return true;
+}
+
+Pn532Async::Result Pn532Async::poll() {
+  if (state_ == STATE_IDLE) return PN532_PENDING;
+
+  if (!bus_.ready()) {
+    if ((long)(millis() - deadline_) < 0) return PN532_PENDING;
+    // 連 ACK 都沒回 = PN532 沒在聽（沒插 / SPI 壞了）；ACK 回了但等不到回應 = 沒有卡
+    if (state_ == STATE_WAIT_ACK) return fail();
+    cancel();
+    timeouts_++;
+    return PN532_NO_TAG;
+  }
+
+  uint8_t frame[kMaxFrame];
+  uint8_t n = bus_.readFrame(frame, sizeof(frame));
+
+  if (state_ == STATE_WAIT_ACK) {
+    if (n != sizeof(PN532_ACK) || memcmp(frame, PN532_ACK, sizeof(PN532_ACK)) != 0) return fail();
+    state_ = STATE_WAIT_RESPONSE;
+    return PN532_PENDING;
+  }
+
+  // 00 00 FF LEN LCS TFI data... DCS 00
+  if (n < 8 || frame[0] != 0x00 || frame[1] != 0x00 || frame[2] != 0xFF) return fail();
+  uint8_t len = frame[3];
+  if ((uint8_t)(len + frame[4]) != 0 || len < 2 || 5 + len + 2 > n) return fail();
+  uint8_t sum = 0;
+  for (uint8_t i = 0; i <= len; i++) sum += frame[5 + i];   // TFI + data + DCS
+  if (sum != 0) return fail();
+  if (frame[5] == PN532_ERROR_FRAME_TFI || frame[5] != PN532_PN532_TO_HOST) return fail();
+  if (frame[6] != (uint8_t)(command_ + 1)) return fail();
+
+  const uint8_t* data = frame + 7;
+  uint8_t dataLength = len - 2;
+  if (command_ != PN532_CMD_INLISTPASSIVETARGET) {
+    responseLength_ = dataLength < responseCapacity_ ? dataLength : responseCapacity_;
+    if (response_) memcpy(response_, data, responseLength_);
+    return finish(PN532_RESPONSE);
+  }
+  if (dataLength >= 1 && data[0] == 0) return finish(PN532_NO_TAG);   // NbTg = 0：重試次數用完
+  if (!parseInList(data, dataLength)) return fail();
+  hasTarget_ = true;
+  return finish(PN532_TAG_FOUND);
+}
+
+// NbTg，然後每張卡：Tg, SENS_RES(2), SEL_RES, NFCIDLength, NFCID1...[, ATS]
+// ATS 只有 ISO 14443-4 的卡（SAK bit5）才有，第一個 byte (TL) 是含自己的長度；用不到，跳過
+bool Pn532Async::parseInList(const uint8_t* data, uint8_t length) {
+  if (length < 1 || data[0] < 1 || data[0] > kMaxTargets) return false;
+  uint8_t count = data[0];
+  uint16_t pos = 1;
+  for (uint8_t i = 0; i < count; i++) {
+    if (pos + 5 > length) return false;
+    const uint8_t* t = data + pos;
+    uint8_t idLength = t[4];
+    if (idLength == 0 || idLength > kMaxUid || pos + 5 + idLength > length) return false;
+    Target& target = targets_[i];
+    target.atqa = (uint16_t)((t[1] << 8) | t[2]);
+    target.sak = t[3];
+    memcpy(target.uid, t + 5, idLength);
+    target.uidLength = idLength;
+    pos += 5 + idLength;
+    if (target.sak & 0x20) {
+      if (pos >= length || data[pos] == 0) return false;
+      pos += data[pos];
+    }
+  }
+  targetCount_ = count;
+  return true;
+}
+
+void Pn532Async::cancel() {
+  if (state_ == STATE_IDLE) return;
+  bus_.writeFrame(PN532_ACK, sizeof(PN532_ACK));
+  // 中止的是 InList 的話，之前選到的卡已經被放掉了
+  if (command_ == PN532_CMD_INLISTPASSIVETARGET) hasTarget_ = false;
+  state_ = STATE_IDLE;
+}
+
+Pn532Async::Result Pn532Async::finish(Result r) {
+  state_ = STATE_IDLE;
+  return r;
+}
+
+Pn532Async::Result Pn532Async::fail() {
+  cancel();
+  errors_++;
+  return PN532_FAILED;
+}
+
+Pn532Async::TagFamily Pn532Async::familyFromSak(uint8_t sak) {
+  if (sak & 0x20) return TAG_ISO_DEP;
+  if (sak & 0x08) return TAG_MIFARE_CLASSIC;
+  if (sak == 0x00) return TAG_TYPE2;
+  return TAG_UNKNOWN;
+}
+
+const char* Pn532Async::familyName(TagFamily family) {
+  switch (family) {
+    case TAG_TYPE2: return "NTAG/Ultralight (Type 2)";
+    case TAG_MIFARE_CLASSIC: return "MIFARE Classic";
+    case TAG_ISO_DEP: return "ISO-DEP (Type 4)";
+    default: return "unknown";
+  }
+}
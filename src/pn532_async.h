@@ -0,0 +1,149 @@
+#pragma once
+// ===== PN532 非同步驅動（InListPassiveTarget 不阻塞）=====
+// Seeed 的 nfc.tagPresent() 送完指令就在原地等 PN532 回應（沒卡時等到 timeout 才回來），
+// 整段時間 webSocket.loop() 跟 Serial 都停住。這裡把一次交易拆成狀態機：
+//
+//   startInList() ── 送指令 frame，立刻回來
+//        │
+//   poll()  WAIT_ACK      ── PN532 ready（IRQ 拉低 / SPI status bit0）→ 讀 ACK
+//        │  WAIT_RESPONSE ── PN532 ready → 讀回應、驗 checksum、解出 UID → TAG_FOUND
+//        │
+//        └─ 超過 deadline ── 送 ACK frame 中止 PN532 手上的指令 → NO_TAG
+//
+// 每次 poll() 最多只做一次 SPI status 讀取 + 一個 frame，其他時間直接回 PENDING，
+// 所以 loop() 可以每一輪都叫，不用再節流。
+// 其他指令（InDataExchange / InCommunicateThru 燒錄用、TgInitAsTarget / TgGetData / TgSetData 模擬用）
+// 走同一套 frame 處理，回應 data 寫進呼叫端給的 buffer。
+// 跟 SPI 的實際溝通交給 Pn532Transport：實機是 SPI + CS（+ 選配 IRQ 腳），
+// native 是腳本化的假 PN532（見 hal/native/pn532_sim_transport.h）。
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ===== 傳輸層 =====
+// frame 的組裝 / 驗證都在 Pn532Async，這裡只負責把 bytes 搬過 SPI
+class Pn532Transport {
+ public:
+  virtual ~Pn532Transport() {}
+  virtual void begin() = 0;
+  // PN532 手上有 frame 可以讀（IRQ 腳為 LOW，或 SPI status byte 的 bit0）
+  virtual bool ready() = 0;
+  // 一次 CS 視窗把整個 frame 寫出去（DW 前綴由 transport 加）
+  virtual void writeFrame(const uint8_t* frame, uint8_t length) = 0;
+  // 一次 CS 視窗讀一個 frame（DR 前綴由 transport 加）：先讀 5 byte 的 header，
+  // 依 LEN 再讀剩下的 data + DCS + postamble；ACK / NACK 只有 6 byte。回傳實際讀了幾 byte
+  virtual uint8_t readFrame(uint8_t* buffer, uint8_t maxLength) = 0;
+};
+
+class Pn532Async {
+ public:
+  enum Result : uint8_t {
+    PN532_PENDING,     // 還在等（或根本沒有指令在跑）
+    PN532_TAG_FOUND,   // InList 回來，uid() 有值
+    PN532_NO_TAG,      // deadline 到了還沒卡（或其他指令等不到回應），指令已中止
+    PN532_FAILED,      // frame 壞掉 / PN532 回錯誤碼，指令已中止
+    PN532_RESPONSE     // startCommand() 的回應到了，responseLength() 有值
+  };
+
+  // 卡種：只看 anticollision 回來的 SEL_RES (SAK)，不碰卡片記憶體（NXP AN10833）
+  enum TagFamily : uint8_t {
+    TAG_TYPE2,            // SAK 0x00：NTAG21x / Ultralight（展場瓶身貼紙）
+    TAG_MIFARE_CLASSIC,   // SAK bit3：MIFARE Classic 1K / 4K
+    TAG_ISO_DEP,          // SAK bit5：ISO 14443-4（Type 4、DESFire、手機 HCE）
+    TAG_UNKNOWN
+  };
+  static TagFamily familyFromSak(uint8_t sak);
+  static const char* familyName(TagFamily family);
+
+  // 最長的是 NTAG FAST_READ 的回應：CC 頁 + 128 bytes 的 NDEF image（見 ntag_writer.h）
+  static const uint8_t kMaxFrame = 160;
+  static const uint8_t kMaxUid = 7;
+  // PN532 一次 InList 最多選兩張（UM0701-02 §7.3.5 MaxTg ≤ 2）
+  static const uint8_t kMaxTargets = 2;
+
+  // InList 選到的一張卡；Tg 編號 = 在 target() 裡的 index + 1
+  struct Target {
+    uint8_t uid[kMaxUid];
+    uint8_t uidLength;
+    uint16_t atqa;   // SENS_RES
+    uint8_t sak;     // SEL_RES
+    TagFamily family() const { return familyFromSak(sak); }
+  };
+
+  explicit Pn532Async(Pn532Transport& bus) : bus_(bus) {}
+
+  void begin() { bus_.begin(); }
+
+  // 送出 InListPassiveTarget（106 kbps Type A，最多 maxTargets 張），立刻回來
+  // PN532 會一直重試到卡出現（MxRtyPassiveActivation = 0xFF），所以 timeoutMs 就是「等卡」的上限
+  // maxTargets = 2 時 PN532 選到第一張後會再做一輪 anticollision 找第二張（只有一張時多花約 1ms）
+  // 前一個指令還沒結束時回 false
+  bool startInList(uint16_t timeoutMs, uint8_t maxTargets = 1);
+
+  // 送出任意指令（data[0] = 指令碼），立刻回來；回應 data（不含 D5 與回應碼）之後寫進 response
+  bool startCommand(const uint8_t* data, uint8_t length, uint16_t timeoutMs, uint8_t* response,
+                    uint8_t capacity);
+  // 同上，但 data 分好幾段，直接依序組進 frame（TgSetData：指令碼 + NDEF file 的一段 + SW1 SW2），不用先拼起來
+  struct Span {
+    const uint8_t* data;
+    uint8_t length;
+  };
+  bool startCommand(const Span* parts, uint8_t count, uint16_t timeoutMs, uint8_t* response, uint8_t capacity);
+
+  // 推進狀態機；只有在結果出來的那一次回 TAG_FOUND / NO_TAG / FAILED / RESPONSE
+  Result poll();
+
+  // 原地 poll 到結果出來（燒錄用：一個指令幾 ms，期間 loop 停住也無所謂）
+  Result wait();
+  // startCommand + wait；回傳回應長度，沒回應 / 失敗回 -1
+  int transceive(const uint8_t* data, uint8_t length, uint16_t timeoutMs, uint8_t* response, uint8_t capacity);
+
+  // 中止目前的指令（之後要用 Seeed 的同步 API 碰 PN532 前必須先呼叫）
+  void cancel();
+
+  bool busy() const { return state_ != STATE_IDLE; }
+  // 最近一次 InList 選到的第一張卡還是 PN532 的 Tg 1，可以直接 InDataExchange（卡拿走之後第一個指令會失敗）
+  bool hasTarget() const { return hasTarget_; }
+  uint8_t responseLength() const { return responseLength_; }
+
+  // 最近一次 TAG_FOUND 選到的卡（1..kMaxTargets 張）
+  uint8_t targetCount() const { return targetCount_; }
+  const Target& target(uint8_t index) const { return targets_[index]; }
+
+  // 第一張（Tg 1）的卡片資訊
+  const uint8_t* uid() const { return targets_[0].uid; }
+  uint8_t uidLength() const { return targets_[0].uidLength; }
+  uint16_t atqa() const { return targets_[0].atqa; }
+  uint8_t sak() const { return targets_[0].sak; }
+  TagFamily family() const { return targets_[0].family(); }
+
+  // 統計（心跳 log 用）
+  uint32_t commandCount() const { return commands_; }
+  uint32_t timeoutCount() const { return timeouts_; }
+  uint32_t errorCount() const { return errors_; }
+
+ private:
+  enum State : uint8_t { STATE_IDLE, STATE_WAIT_ACK, STATE_WAIT_RESPONSE };
+
+  bool sendCommand(const Span* parts, uint8_t count, uint16_t timeoutMs);
+  Result finish(Result r);
+  Result fail();
+  bool parseInList(const uint8_t* data, uint8_t length);
+
+  Pn532Transport& bus_;
+  State state_ = STATE_IDLE;
+  uint8_t command_ = 0;
+  unsigned long deadline_ = 0;
+  bool hasTarget_ = false;
+
+  uint8_t* response_ = nullptr;
+  uint8_t responseCapacity_ = 0;
+  uint8_t responseLength_ = 0;
+
+  Target targets_[kMaxTargets] = {};
+  uint8_t targetCount_ = 0;
+
+  uint32_t commands_ = 0;
+  uint32_t timeouts_ = 0;
+  uint32_t errors_ = 0;
+};
@@ -0,0 +1,33 @@
+#include "quote_ndef_image.h"
+
+#include "generated/quote_ndef_images.h"
+
+namespace {
+
+uint8_t imageLength(int quoteNumber) {
+  int index = quoteNumber - QUOTE_NDEF_FIRST;
+  if (index < 0 || index >= QUOTE_NDEF_COUNT) return 0;
+  return pgm_read_byte(&QUOTE_NDEF_LENGTHS[index]);
+}
+
+}  // namespace
+
+int quoteNumberFromURL(const char* url) {
+  const size_t baseLength = sizeof(QUOTE_NDEF_BASE_URL) - 1;
+  if (strncmp(url, QUOTE_NDEF_BASE_URL, baseLength) != 0) return -1;
+  const char* digits = url + baseLength;
+  // 只收 1 ~ 3 位、不帶前導 0 的十進位（"quote007" 不是 quote7 的網址）
+  if (digits[0] < '1' || digits[0] > '9') return -1;
+  int number = 0;
+  for (uint8_t i = 0; digits[i]; i++) {
+    if (i == 3 || digits[i] < '0' || digits[i] > '9') return -1;
+    number = number * 10 + (digits[i] - '0');
+  }
+  return imageLength(number) ? number : -1;
+}
+
+uint8_t copyQuoteNdefImage(int quoteNumber, uint8_t* image) {
+  uint8_t length = imageLength(quoteNumber);
+  if (length) memcpy_P(image, QUOTE_NDEF_IMAGES[quoteNumber - QUOTE_NDEF_FIRST], length);
+  return length;
+}
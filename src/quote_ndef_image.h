@@ -0,0 +1,12 @@
+#pragma once
+// ===== 雞湯網址的 NDEF image（編進 firmware）=====
+// QUOTE_BASE_URL + 編號 的 NTAG image 由 scripts/gen_quote_ndef_images.py 在 build 時組好放 flash (PROGMEM)，
+// 燒錄雞湯卡不用在執行時組 NDEF，直接交給 NtagWriter 寫（見 ntag_writer.h）
+
+#include "hal.h"
+
+// url 剛好是 QUOTE_BASE_URL + 編號（而且表裡有這個編號）→ 回傳編號，否則 -1
+int quoteNumberFromURL(const char* url);
+
+// 把編號的 image 從 flash 複製到 image（至少 NtagWriter::kMaxImage bytes），回傳長度；沒有這個編號回 0
+uint8_t copyQuoteNdefImage(int quoteNumber, uint8_t* image);
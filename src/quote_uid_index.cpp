@@ -0,0 +1,19 @@
+#include "quote_uid_index.h"
+
+#include "generated/quote_uid_table.h"
+
+int findQuoteByUID(const uint8_t* uid, uint8_t uidLength) {
+  if (uidLength != 7) return -1;
+
+  int lo = 0;
+  int hi = QUOTE_UID_COUNT - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    // 表在 flash，ESP8266 上要用 _P 版本讀（不能直接 byte access）
+    int c = memcmp_P(uid, QUOTE_UID_TABLE[mid].uid, 7);
+    if (c == 0) return pgm_read_byte(&QUOTE_UID_TABLE[mid].quoteNumber);
+    if (c < 0) hi = mid - 1;
+    else lo = mid + 1;
+  }
+  return -1;
+}
@@ -0,0 +1,14 @@
+#pragma once
+// ===== UID → 雞湯編號 對照（編進 firmware）=====
+// 表本身由 scripts/gen_quote_uid_table.py 從 data/quotes-selected.json 產生，
+// 放在 flash (PROGMEM)，直接拿 PN532 讀到的 uid[] bytes 二分搜尋，不用組字串
+
+#include "hal.h"
+
+struct QuoteUidEntry {
+  uint8_t uid[7];
+  uint8_t quoteNumber;
+};
+
+// 找不到回 -1（未登錄的卡 / UID 長度不是 7）
+int findQuoteByUID(const uint8_t* uid, uint8_t uidLength);
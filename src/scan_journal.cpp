@@ -0,0 +1,201 @@
+#include "scan_journal.h"
+
+#include <string.h>
+
+#include "hal.h"
+
+namespace {
+
+const char* const kSegmentPaths[2] = { "/journal0.bin", "/journal1.bin" };
+const uint8_t kRecordMagic = 0xA5;
+const size_t kHeaderBytes = 12;
+
+uint8_t crc8(const uint8_t* data, size_t length, uint8_t crc = 0) {
+  for (size_t i = 0; i < length; i++) {
+    crc ^= data[i];
+    for (uint8_t b = 0; b < 8; b++) crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+  }
+  return crc;
+}
+
+uint32_t readU32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+void writeU32(uint8_t* p, uint32_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  p[2] = (uint8_t)(v >> 16);
+  p[3] = (uint8_t)(v >> 24);
+}
+
+// 一筆記錄的 header 是不是合法（magic / 長度）；合法回傳 frame 長度
+bool parseHeader(const uint8_t* header, uint16_t* length) {
+  if (header[0] != kRecordMagic) return false;
+  *length = (uint16_t)(header[2] | (header[3] << 8));
+  return *length > 0 && *length <= ScanJournal::kMaxFrame;
+}
+
+// 交給 visitor 之前先確認：seq > after、topics 有交集、還沒交滿
+void visitRecord(const uint8_t* header, const uint8_t* json, uint16_t length, uint32_t after, uint8_t topics,
+                 size_t maxFrames, ScanJournal::Visitor visit, void* context, size_t* visited, uint32_t* lastSeq) {
+  ScanJournal::Entry entry = { readU32(header + 4), readU32(header + 8), header[1], (const char*)json, length };
+  if (!visit || entry.seq <= after || (entry.topics & topics) == 0 || *visited >= maxFrames) return;
+  visit(entry, context);
+  (*visited)++;
+  *lastSeq = entry.seq;
+}
+
+}  // namespace
+
+bool ScanJournal::begin() {
+  flashOk_ = LittleFS.begin();
+  if (!flashOk_) return false;
+  SegmentInfo info[2];
+  bool intact[2];
+  for (uint8_t s = 0; s < 2; s++) {
+    size_t visited = 0;
+    uint32_t last = 0;
+    intact[s] = scanSegment(s, &info[s], 0, 0, 0, nullptr, nullptr, &visited, &last);
+    segmentFirst_[s] = info[s].firstSeq;
+  }
+  // 最後一筆 seq 比較大的那個是上次在寫的
+  active_ = info[1].lastSeq > info[0].lastSeq ? 1 : 0;
+  activeBytes_ = info[active_].validBytes;
+  switchNext_ = !intact[active_];
+  lastSeq_ = info[active_].lastSeq;
+  refreshFirstSeq();
+  return true;
+}
+
+void ScanJournal::append(uint32_t seq, uint32_t t, uint8_t topics, const char* json, size_t length,
+                         unsigned long nowMs) {
+  if (length == 0 || length > kMaxFrame) return;
+  size_t record = kRecordOverhead + length;
+  if (batchLength_ + record > kBatchCapacity) {
+    if (flashOk_) {
+      maintain(nowMs, true);
+    } else {
+      dropOldest(record);
+    }
+  }
+  if (batchLength_ == 0) batchSinceMs_ = nowMs;
+
+  uint8_t* p = batch_ + batchLength_;
+  p[0] = kRecordMagic;
+  p[1] = topics;
+  p[2] = (uint8_t)length;
+  p[3] = (uint8_t)(length >> 8);
+  writeU32(p + 4, seq);
+  writeU32(p + 8, t);
+  memcpy(p + kHeaderBytes, json, length);
+  p[kHeaderBytes + length] = crc8(p + 1, kHeaderBytes - 1 + length);
+  batchLength_ += record;
+  lastSeq_ = seq;
+  refreshFirstSeq();
+}
+
+size_t ScanJournal::maintain(unsigned long nowMs, bool force) {
+  if (batchLength_ == 0 || !flashOk_) return 0;
+  if (!force && batchLength_ < kFlushBytes && nowMs - batchSinceMs_ < kFlushMs) return 0;
+
+  if (switchNext_ || activeBytes_ + batchLength_ > kSegmentBytes) {
+    active_ ^= 1;
+    activeBytes_ = 0;
+    segmentFirst_[active_] = 0;
+    switchNext_ = false;
+  }
+  File f = LittleFS.open(kSegmentPaths[active_], activeBytes_ ? "a" : "w");
+  size_t written = f ? f.write(batch_, batchLength_) : 0;
+  if (f) f.close();
+  flashWrites_++;
+  flashBytes_ += written;
+  if (written != batchLength_) {
+    // 寫一半（flash 滿了 / 壞了）：這一段的尾巴不能信，下一批換 segment
+    switchNext_ = true;
+  }
+  if (written && !segmentFirst_[active_]) segmentFirst_[active_] = readU32(batch_ + 4);
+  activeBytes_ += written;
+  batchLength_ = 0;
+  refreshFirstSeq();
+  return written;
+}
+
+size_t ScanJournal::replay(uint32_t after, uint8_t topics, size_t maxFrames, Visitor visit, void* context,
+                           uint32_t* lastSeq) const {
+  size_t visited = 0;
+  *lastSeq = after;
+  if (flashOk_) {
+    // 舊的那段 → 正在寫的那段 → RAM 裡還沒寫的
+    const uint8_t order[2] = { (uint8_t)(active_ ^ 1), active_ };
+    for (uint8_t s : order) {
+      if (!segmentFirst_[s] || visited >= maxFrames) continue;
+      SegmentInfo info;
+      scanSegment(s, &info, after, topics, maxFrames, visit, context, &visited, lastSeq);
+    }
+  }
+  scanBuffer(batch_, batchLength_, after, topics, maxFrames, visit, context, &visited, lastSeq);
+  return visited;
+}
+
+bool ScanJournal::scanSegment(uint8_t segment, SegmentInfo* info, uint32_t after, uint8_t topics, size_t maxFrames,
+                              Visitor visit, void* context, size_t* visited, uint32_t* lastSeq) {
+  static uint8_t record[kRecordOverhead + kMaxFrame];
+  info->firstSeq = 0;
+  info->lastSeq = 0;
+  info->validBytes = 0;
+  File f = LittleFS.open(kSegmentPaths[segment], "r");
+  if (!f) return true;   // 還沒有這個檔 = 空的
+
+  bool intact = true;
+  while (f.available() > 0) {
+    uint16_t length;
+    if (f.read(record, kHeaderBytes) != kHeaderBytes || !parseHeader(record, &length) ||
+        f.read(record + kHeaderBytes, length + 1) != (size_t)length + 1 ||
+        crc8(record + 1, kHeaderBytes - 1 + length) != record[kHeaderBytes + length]) {
+      intact = false;
+      break;
+    }
+    uint32_t seq = readU32(record + 4);
+    if (!info->firstSeq) info->firstSeq = seq;
+    info->lastSeq = seq;
+    info->validBytes += kRecordOverhead + length;
+    visitRecord(record, record + kHeaderBytes, length, after, topics, maxFrames, visit, context, visited, lastSeq);
+  }
+  f.close();
+  return intact;
+}
+
+size_t ScanJournal::scanBuffer(const uint8_t* data, size_t length, uint32_t after, uint8_t topics, size_t maxFrames,
+                               Visitor visit, void* context, size_t* visited, uint32_t* lastSeq) {
+  size_t pos = 0;
+  uint16_t frame;
+  while (pos + kRecordOverhead <= length && parseHeader(data + pos, &frame)) {
+    visitRecord(data + pos, data + pos + kHeaderBytes, frame, after, topics, maxFrames, visit, context, visited,
+                lastSeq);
+    pos += kRecordOverhead + frame;
+  }
+  return pos;
+}
+
+// 沒有 flash 的時候 RAM batch 就是整個 journal：滿了丟最舊的
+void ScanJournal::dropOldest(size_t needed) {
+  size_t drop = 0;
+  uint16_t frame;
+  while (drop < batchLength_ && batchLength_ - drop + needed > kBatchCapacity && parseHeader(batch_ + drop, &frame)) {
+    drop += kRecordOverhead + frame;
+  }
+  memmove(batch_, batch_ + drop, batchLength_ - drop);
+  batchLength_ -= drop;
+}
+
+void ScanJournal::refreshFirstSeq() {
+  uint8_t older = active_ ^ 1;
+  if (flashOk_ && segmentFirst_[older]) {
+    firstSeq_ = segmentFirst_[older];
+  } else if (flashOk_ && segmentFirst_[active_]) {
+    firstSeq_ = segmentFirst_[active_];
+  } else {
+    firstSeq_ = batchLength_ ? readU32(batch_ + 4) : 0;
+  }
+}
@@ -0,0 +1,92 @@
+#pragma once
+// ===== 事件 journal（LittleFS 上的 ring，斷線補送）=====
+// 以前 WiFi 斷掉的那幾秒，觀眾掃的卡 broadcast 給沒有人，Serial 印一行「WebSocket 未連線」就沒了。
+// 現在每個送出的事件 frame（掃卡 / hold / 燒錄結果，已經帶 seq 跟裝置時間 t）都記一份：
+//
+//   append()    先放在 RAM 的 batch（不碰 flash，掃卡路徑上只是一次 memcpy）
+//   maintain()  batch 累積到 kFlushBytes 或最舊的一筆放了 kFlushMs，才一次 append 進 flash 的檔案
+//               （低優先序的 task 呼叫；一次寫一整批，flash 寫入次數 = 幾秒一次，不是每張卡一次）
+//   replay()    client 重連後送 {"type":"replay","after":<最後收到的 seq>}，把之後的 frame 依序補給它
+//
+// flash 上是兩個 segment 檔輪流用：寫的那個超過 kSegmentBytes 就換到另一個（先清空），
+// 所以永遠留著「上一段 + 這一段」，最多 2 × kSegmentBytes；LittleFS 自己做 wear leveling。
+// 一筆記錄：[0xA5][topics][len u16][seq u32][t u32][frame JSON][crc8]（little endian）
+// 斷電寫到一半的記錄 crc 對不上，開機掃描到那裡就停，下一批改寫到另一個 segment。
+//
+// 開機 begin() 找出 journal 裡最後的 seq，EventQueue 從那之後接著編（resumeAfter），
+// 所以重開機 seq 也不會倒回去，顯示端拿舊的 seq 來要 replay 一樣對得上。
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "event_queue.h"
+
+class ScanJournal {
+ public:
+  static const size_t kSegmentBytes = 8192;
+  static const size_t kFlushBytes = 512;
+  static const unsigned long kFlushMs = 2000;
+  // RAM batch：比 kFlushBytes 多留一個最大的 frame，湊滿之前不會被擠掉
+  static const size_t kBatchCapacity = 1024;
+  static const size_t kMaxFrame = EventQueue::kJsonCapacity + EventQueue::kJsonOverhead;
+  static const size_t kRecordOverhead = 13;
+
+  struct Entry {
+    uint32_t seq;
+    uint32_t t;
+    uint8_t topics;   // ws_sessions.h 的 WsTopic，replay 只補 client 有訂的
+    const char* json;
+    uint16_t length;
+  };
+  typedef void (*Visitor)(const Entry& entry, void* context);
+
+  // 掛上 LittleFS、掃描兩個 segment。回傳 false = 檔案系統不能用（之後只剩 RAM batch，滿了丟最舊的）
+  bool begin();
+
+  // frame 必須已經帶 seq / t；seq 要遞增。batch 放不下就先 flush
+  void append(uint32_t seq, uint32_t t, uint8_t topics, const char* json, size_t length, unsigned long nowMs);
+  // 到時間 / 夠多了才寫；force = 不管多少都寫。回傳寫進 flash 幾 bytes
+  size_t maintain(unsigned long nowMs, bool force = false);
+
+  // seq > after、topics 有交集的 frame 依序交給 visit，最多 maxFrames 個；
+  // 回傳交了幾個，*lastSeq = 最後一個的 seq（一個都沒有 = after）
+  size_t replay(uint32_t after, uint8_t topics, size_t maxFrames, Visitor visit, void* context,
+                uint32_t* lastSeq) const;
+
+  // 還留著的最舊 / 最新 seq（空的 = 0）
+  uint32_t firstSeq() const { return firstSeq_; }
+  uint32_t lastSeq() const { return lastSeq_; }
+  bool usingFlash() const { return flashOk_; }
+  size_t pendingBytes() const { return batchLength_; }
+  // 統計：flash 寫了幾次 / 幾 bytes
+  uint32_t flashWrites() const { return flashWrites_; }
+  uint32_t flashBytes() const { return flashBytes_; }
+
+ private:
+  // 掃一個 segment 檔：第一 / 最後一筆的 seq、合法記錄的總長度；visit 非 null 時符合條件的交出去
+  // 回傳 false = 中間有壞掉的記錄（後面的不算）
+  struct SegmentInfo {
+    uint32_t firstSeq;
+    uint32_t lastSeq;
+    size_t validBytes;
+  };
+  static bool scanSegment(uint8_t segment, SegmentInfo* info, uint32_t after, uint8_t topics, size_t maxFrames,
+                          Visitor visit, void* context, size_t* visited, uint32_t* lastSeq);
+  static size_t scanBuffer(const uint8_t* data, size_t length, uint32_t after, uint8_t topics, size_t maxFrames,
+                           Visitor visit, void* context, size_t* visited, uint32_t* lastSeq);
+  void dropOldest(size_t needed);
+  void refreshFirstSeq();
+
+  uint8_t batch_[kBatchCapacity];
+  size_t batchLength_ = 0;
+  unsigned long batchSinceMs_ = 0;
+  bool flashOk_ = false;
+  uint8_t active_ = 0;          // 正在寫的 segment
+  size_t activeBytes_ = 0;
+  bool switchNext_ = false;     // active 的尾巴壞了：下一批直接換 segment
+  uint32_t segmentFirst_[2] = { 0, 0 };   // 各 segment 第一筆的 seq（0 = 空的）
+  uint32_t firstSeq_ = 0;
+  uint32_t lastSeq_ = 0;
+  uint32_t flashWrites_ = 0;
+  uint32_t flashBytes_ = 0;
+};
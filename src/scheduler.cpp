@@ -0,0 +1,129 @@
+#include "scheduler.h"
+
+#include "hal.h"
+
+int Scheduler::add(const char* name, void (*run)(), uint32_t periodUs, uint32_t deadlineUs, uint8_t priority,
+                   uint32_t firstDelayUs) {
+  if (count_ >= kMaxTasks) return -1;
+  Task& t = tasks_[count_];
+  memset(&t, 0, sizeof(t));
+  t.name = name;
+  t.run = run;
+  t.periodUs = periodUs;
+  t.deadlineUs = deadlineUs;
+  t.priority = priority;
+  t.nextDueUs = (uint32_t)micros() + firstDelayUs;
+  if (count_ == 0) statsStartMs_ = millis();
+  return count_++;
+}
+
+uint8_t Scheduler::runOnce() {
+  // 到期的 task 依 (priority 大, 截止時間早) 排好；最多 kMaxTasks 個，插入排序就夠
+  uint8_t order[kMaxTasks];
+  uint8_t due = 0;
+  uint32_t now = (uint32_t)micros();
+  for (uint8_t i = 0; i < count_; i++) {
+    const Task& t = tasks_[i];
+    if ((int32_t)(now - t.nextDueUs) < 0) continue;
+    uint8_t j = due++;
+    for (; j > 0; j--) {
+      const Task& o = tasks_[order[j - 1]];
+      bool before = t.priority > o.priority ||
+                    (t.priority == o.priority &&
+                     (int32_t)((t.nextDueUs + t.deadlineUs) - (o.nextDueUs + o.deadlineUs)) < 0);
+      if (!before) break;
+      order[j] = order[j - 1];
+    }
+    order[j] = i;
+  }
+
+  if (due == 0) {
+    idlePasses_++;
+    yield();
+    return 0;
+  }
+
+  for (uint8_t k = 0; k < due; k++) {
+    Task& t = tasks_[order[k]];
+    uint32_t start = (uint32_t)micros();
+    uint32_t lateness = start - t.nextDueUs;
+    if (lateness > t.deadlineUs) t.late++;
+    if (lateness > t.maxLateUs) t.maxLateUs = lateness;
+    // 先排好下一次，task 裡面可以再 defer() 蓋掉
+    t.nextDueUs += t.periodUs;
+    if ((int32_t)(start - t.nextDueUs) >= 0) t.nextDueUs = start + t.periodUs;
+
+    current_ = order[k];
+    t.run();
+    current_ = -1;
+    t.runs++;
+    t.busyUs += (uint32_t)micros() - start;
+  }
+  return due;
+}
+
+void Scheduler::defer(int id, uint32_t us) {
+  if (id < 0 || id >= count_) return;
+  tasks_[id].nextDueUs = (uint32_t)micros() + us;
+}
+
+uint64_t Scheduler::elapsedUs() const { return (uint64_t)(millis() - statsStartMs_) * 1000; }
+
+uint32_t Scheduler::busyPermille(const Task& t) const {
+  uint64_t elapsed = elapsedUs();
+  return elapsed ? (uint32_t)(t.busyUs * 1000 / elapsed) : 0;
+}
+
+uint32_t Scheduler::idlePermille() const {
+  uint64_t elapsed = elapsedUs();
+  if (elapsed == 0) return 1000;
+  uint64_t busy = 0;
+  for (uint8_t i = 0; i < count_; i++) busy += tasks_[i].busyUs;
+  return busy >= elapsed ? 0 : (uint32_t)(1000 - busy * 1000 / elapsed);
+}
+
+void Scheduler::resetStats() {
+  for (uint8_t i = 0; i < count_; i++) {
+    Task& t = tasks_[i];
+    t.runs = 0;
+    t.late = 0;
+    t.maxLateUs = 0;
+    t.busyUs = 0;
+  }
+  idlePasses_ = 0;
+  statsStartMs_ = millis();
+}
+
+size_t Scheduler::formatLine(uint8_t id, char* out, size_t capacity) const {
+  const Task& t = tasks_[id];
+  int n = snprintf(out, capacity, "STATS:task:%s:runs=%lu,late=%lu,max_late_us=%lu,busy_permille=%lu", t.name,
+                   (unsigned long)t.runs, (unsigned long)t.late, (unsigned long)t.maxLateUs,
+                   (unsigned long)busyPermille(t));
+  return n < 0 ? 0 : ((size_t)n < capacity ? (size_t)n : capacity - 1);
+}
+
+size_t Scheduler::writeJson(char* out, size_t capacity) const {
+  size_t used = 0;
+  auto append = [&](int n) {
+    if (n < 0 || used + (size_t)n >= capacity) {
+      used = capacity;
+      return false;
+    }
+    used += (size_t)n;
+    return true;
+  };
+  if (!append(snprintf(out, capacity, "{\"idle_permille\":%lu,\"tasks\":{", (unsigned long)idlePermille()))) {
+    return 0;
+  }
+  for (uint8_t i = 0; i < count_; i++) {
+    const Task& t = tasks_[i];
+    if (!append(snprintf(out + used, capacity - used,
+                         "%s\"%s\":{\"runs\":%lu,\"late\":%lu,\"max_late_us\":%lu,\"busy_permille\":%lu}",
+                         i ? "," : "", t.name, (unsigned long)t.runs, (unsigned long)t.late,
+                         (unsigned long)t.maxLateUs, (unsigned long)busyPermille(t)))) {
+      return 0;
+    }
+  }
+  if (!append(snprintf(out + used, capacity - used, "}}"))) return 0;
+  return used;
+}
@@ -0,0 +1,74 @@
+#pragma once
+// ===== 主迴圈的協作式排程器 =====
+// 以前 loop() 是一串手寫的 static last… 節流（WiFi 3 秒、NFC recheck、心跳 2 秒），
+// 中間任何一個提早 return（emulate 模式、NFC 還在等）都會悄悄跳過後面的東西。
+// 現在每件事是一個 task：週期 (period)、容許延遲 (deadline)、優先序 (priority)，
+// loop() 每一輪呼叫 runOnce()：
+//
+//   1. 找出所有到期的 task（now ≥ nextDue）
+//   2. 依 priority 高到低、同 priority 截止時間早的先（EDF），一個一個跑完
+//   3. 開始跑的時候已經超過 nextDue + deadline → 記一次 late（服務率沒達到）
+//   4. 下一次 = nextDue + period；落後超過一個週期就從現在重新算，不會連跑補課
+//   5. 這一輪沒有任何 task 到期 → 記 idle、yield() 給 WiFi stack
+//
+// 協作式：task 跑多久就佔多久（燒錄一張卡 ~100ms），所以保證的前提是每個 task 都不阻塞；
+// 哪個 task 超時會直接反映在其他 task 的 late / maxLateUs。
+// task 表是固定大小的陣列，不碰 heap；排程時間用 micros()（71 分鐘 wrap，差值運算不受影響）。
+
+#include <stddef.h>
+#include <stdint.h>
+
+class Scheduler {
+ public:
+  static const uint8_t kMaxTasks = 8;
+
+  struct Task {
+    const char* name;
+    void (*run)();
+    uint32_t periodUs;
+    uint32_t deadlineUs;   // 到期之後多久內要開始跑，超過算 late
+    uint8_t priority;      // 大的先
+    uint32_t nextDueUs;
+
+    // 統計（STATS / {"type":"stats"}）
+    uint32_t runs;
+    uint32_t late;
+    uint32_t maxLateUs;    // 開始時間比 nextDue 晚最多多少
+    uint64_t busyUs;       // 累計執行時間
+  };
+
+  // 回傳 task id；表滿了回 -1。第一次在 add 之後 firstDelayUs 到期
+  int add(const char* name, void (*run)(), uint32_t periodUs, uint32_t deadlineUs, uint8_t priority,
+          uint32_t firstDelayUs = 0);
+
+  // 跑一輪：所有到期的 task 依序各跑一次；回傳跑了幾個（0 = 這一輪 idle）
+  uint8_t runOnce();
+
+  // 讓 task 下一次在 us 之後才到期（例如卡還在 → 50ms 後再 InList）；只能在 task 裡面或兩輪之間呼叫
+  void defer(int id, uint32_t us);
+  // 目前正在跑的 task（task 外面是 -1）
+  int current() const { return current_; }
+
+  uint8_t taskCount() const { return count_; }
+  const Task& task(uint8_t id) const { return tasks_[id]; }
+  // 上次 resetStats() 之後沒有 task 在跑的時間比例（千分比）= CPU 還剩多少餘裕
+  // （loop() 外面 WiFi stack 用掉的時間也算在 idle 裡）
+  uint32_t idlePermille() const;
+  uint32_t idlePasses() const { return idlePasses_; }
+  void resetStats();
+
+  // Serial：STATS:task:<name>:runs=..,late=..,max_late_us=..,busy_permille=..
+  size_t formatLine(uint8_t id, char* out, size_t capacity) const;
+  // WebSocket：{"idle_permille":..,"tasks":{"nfc":{"runs":..,"late":..,"max_late_us":..,"busy_permille":..},...}}
+  size_t writeJson(char* out, size_t capacity) const;
+
+ private:
+  uint32_t busyPermille(const Task& t) const;
+  uint64_t elapsedUs() const;
+
+  Task tasks_[kMaxTasks];
+  uint8_t count_ = 0;
+  int current_ = -1;
+  unsigned long statsStartMs_ = 0;   // 統計區間用 millis()，micros() 71 分鐘就 wrap
+  uint32_t idlePasses_ = 0;
+};
@@ -0,0 +1,78 @@
+#include "tag_presence.h"
+
+#include <string.h>
+
+int TagPresence::find(const uint8_t* uid, uint8_t uidLength, bool presentOnly) const {
+  for (uint8_t i = 0; i < kSlots; i++) {
+    const Slot& s = slots_[i];
+    if (!s.used || (presentOnly && !s.present)) continue;
+    if (s.tag.uidLength == uidLength && memcmp(s.tag.uid, uid, uidLength) == 0) return i;
+  }
+  return -1;
+}
+
+uint8_t TagPresence::update(const Pn532Async::Target* seen, uint8_t count, unsigned long nowMs, Event* events) {
+  uint8_t n = 0;
+
+  // 這次沒看到的：在場的過了 leaveMs 才離場，候選直接丟掉（進場要連續看到）
+  for (uint8_t i = 0; i < kSlots; i++) {
+    Slot& s = slots_[i];
+    if (!s.used) continue;
+    bool hit = false;
+    for (uint8_t j = 0; j < count && !hit; j++) {
+      hit = seen[j].uidLength == s.tag.uidLength && memcmp(seen[j].uid, s.tag.uid, s.tag.uidLength) == 0;
+    }
+    if (hit) continue;
+    if (!s.present) {
+      s.used = false;
+    } else if (nowMs - s.lastSeenMs >= leaveMs_) {
+      events[n].type = TAG_LEAVE;
+      events[n].tag = s.tag;
+      events[n].atMs = s.lastSeenMs;
+      n++;
+      s.used = false;
+    }
+  }
+
+  for (uint8_t j = 0; j < count; j++) {
+    const Pn532Async::Target& t = seen[j];
+    int i = find(t.uid, t.uidLength, false);
+    if (i < 0) {
+      for (uint8_t k = 0; k < kSlots && i < 0; k++) {
+        if (!slots_[k].used) i = k;
+      }
+      if (i < 0) continue;   // 滿了（不會發生：同時最多 kMaxTargets 張 + 遲滯中的 kMaxTargets 張）
+      Slot& s = slots_[i];
+      memcpy(s.tag.uid, t.uid, t.uidLength);
+      s.tag.uidLength = t.uidLength;
+      s.used = true;
+      s.present = false;
+      s.hits = 0;
+    }
+    Slot& s = slots_[i];
+    s.tag.atqa = t.atqa;
+    s.tag.sak = t.sak;
+    s.lastSeenMs = nowMs;
+    if (s.present) continue;
+    if (++s.hits >= enterHits_) {
+      s.present = true;
+      events[n].type = TAG_ENTER;
+      events[n].tag = s.tag;
+      events[n].atMs = nowMs;
+      n++;
+    }
+  }
+  return n;
+}
+
+uint8_t TagPresence::presentCount() const {
+  uint8_t n = 0;
+  for (const Slot& s : slots_) {
+    if (s.used && s.present) n++;
+  }
+  return n;
+}
+
+void TagPresence::clear() {
+  for (Slot& s : slots_) s.used = false;
+}
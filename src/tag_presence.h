@@ -0,0 +1,66 @@
+#pragma once
+// ===== 感應區上的卡（最多兩張同時）=====
+// 以前只記「最後一張 UID」：第二個瓶子放上去會被當成換卡、兩張輪流被 InList 選到就一直重觸發，
+// 任何一張拿走都送一次沒頭沒尾的 nfc_hold_end。現在 InList 用 MaxTg = 2，每次的結果丟進這裡，
+// 依 UID 各自判斷進場 / 離場，產生每張卡自己的 enter / leave 事件：
+//
+//   進場 ── 連續 enterHits 次 InList 都看到才算（預設 1：放上去第一次看到就觸發，延遲不變）
+//   離場 ── 沒看到不會馬上算離場，最後一次看到之後超過 leaveMs 才算（遲滯：
+//           兩張卡時 PN532 偶爾只選到一張、卡在感應邊緣一閃一閃，都不會送出 leave + enter）
+//
+// 一次 update() 裡 leave 先於 enter，「拿走 A、放上 B」前端一定先收到 A 的 hold_end。
+// slot 是固定大小的陣列，不碰 heap。
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pn532_async.h"
+
+class TagPresence {
+ public:
+  // 兩張在場 + 兩張還在 enter debounce 的候選
+  static const uint8_t kSlots = 2 * Pn532Async::kMaxTargets;
+
+  struct Tag {
+    uint8_t uid[Pn532Async::kMaxUid];
+    uint8_t uidLength;
+    uint16_t atqa;
+    uint8_t sak;
+    Pn532Async::TagFamily family() const { return Pn532Async::familyFromSak(sak); }
+  };
+
+  enum EventType : uint8_t { TAG_ENTER, TAG_LEAVE };
+  struct Event {
+    EventType type;
+    Tag tag;
+    unsigned long atMs;   // 實際發生的時間：enter = 這次 update，leave = 最後一次看到
+  };
+  // 一次 update 最多：每個 slot 一個 leave + 每張看到的卡一個 enter
+  static const uint8_t kMaxEvents = kSlots + Pn532Async::kMaxTargets;
+
+  TagPresence(uint8_t enterHits, unsigned long leaveMs)
+      : enterHits_(enterHits ? enterHits : 1), leaveMs_(leaveMs) {}
+
+  // 一次 InList 的結果（沒卡 = count 0）；產生的事件寫進 events，回傳個數
+  uint8_t update(const Pn532Async::Target* seen, uint8_t count, unsigned long nowMs, Event* events);
+
+  uint8_t presentCount() const;
+  bool isPresent(const uint8_t* uid, uint8_t uidLength) const { return find(uid, uidLength, true) >= 0; }
+  // 全部忘掉，不產生事件（燒錄模式接手 reader 時用）
+  void clear();
+
+ private:
+  struct Slot {
+    Tag tag;
+    bool used;
+    bool present;
+    uint8_t hits;              // 還沒進場前連續看到幾次
+    unsigned long lastSeenMs;
+  };
+
+  int find(const uint8_t* uid, uint8_t uidLength, bool presentOnly) const;
+
+  Slot slots_[kSlots] = {};
+  uint8_t enterHits_;
+  unsigned long leaveMs_;
+};
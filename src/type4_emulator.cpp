@@ -0,0 +1,206 @@
+#include "type4_emulator.h"
+
+#include "hal.h"
+
+namespace {
+
+const uint8_t PN532_CMD_TGINITASTARGET = 0x8C;
+const uint8_t PN532_CMD_TGGETDATA = 0x86;
+const uint8_t PN532_CMD_TGSETDATA = 0x8E;
+
+// TgInitAsTarget（UM0701-02 §7.3.14）：只當 106 kbps 的 ISO 14443-4 PICC，RATS / ATS 由 PN532 自己回
+const uint8_t TG_INIT_AS_TARGET[] = {
+  PN532_CMD_TGINITASTARGET,
+  0x05,                  // Mode：PassiveOnly | PICCOnly
+  0x04, 0x00,            // SENS_RES
+  0x12, 0x34, 0x56,      // NFCID1t（PN532 會在前面補 0x08，手機看到的是 4-byte 隨機 UID）
+  0x20,                  // SEL_RES：ISO 14443-4
+  // FeliCaParams（PICCOnly 用不到，照 datasheet 的範例填）
+  0x01, 0xFE, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xFF, 0xFF,
+  0xAA, 0x99, 0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11,   // NFCID3t
+  0x00,                  // LEN Gt
+  0x00                   // LEN Tk
+};
+const uint8_t TG_GET_DATA[] = { PN532_CMD_TGGETDATA };
+const uint8_t TG_SET_DATA[] = { PN532_CMD_TGSETDATA };
+
+// 等手機的 TgInitAsTarget 到期就重下一次；手機每個 C-APDU 之間只隔幾 ms，1 秒沒下一個就當走了
+const uint16_t ARM_TIMEOUT_MS = 1000;
+const uint16_t APDU_TIMEOUT_MS = 1000;
+const uint16_t SET_DATA_TIMEOUT_MS = 100;
+
+const uint8_t NDEF_AID[7] = { 0xD2, 0x76, 0x00, 0x00, 0x85, 0x01, 0x01 };
+
+const uint8_t ISO_CLA = 0x00;
+const uint8_t INS_SELECT = 0xA4;
+const uint8_t INS_READ_BINARY = 0xB0;
+const uint8_t INS_UPDATE_BINARY = 0xD6;
+
+}  // namespace
+
+// ===== Type4Tag =====
+
+void Type4Tag::load(const uint8_t* file, uint16_t length, uint16_t capacity) {
+  file_ = file;
+  fileLength_ = length;
+  const uint8_t cc[kCcLength] = {
+    0x00, kCcLength,                                   // CCLEN
+    0x20,                                              // Mapping version 2.0
+    0x00, kMaxLe,                                      // MLe
+    0x00, kMaxLc,                                      // MLc
+    0x04, 0x06,                                        // NDEF File Control TLV
+    (uint8_t)(kNdefFileId >> 8), (uint8_t)kNdefFileId,
+    (uint8_t)(capacity >> 8), (uint8_t)capacity,       // NDEF file 最大大小（含 NLEN）
+    0x00,                                              // 讀：不限
+    0xFF                                               // 寫：唯讀
+  };
+  memcpy(cc_, cc, sizeof(cc_));
+  reset();
+}
+
+void Type4Tag::reset() {
+  selected_ = SEL_NONE;
+  readUpTo_ = 0;
+}
+
+Type4Tag::Response Type4Tag::process(const uint8_t* apdu, uint8_t length) {
+  if (length < 4) return Response{nullptr, 0, 0x67, 0x00};
+  if (apdu[0] != ISO_CLA) return Response{nullptr, 0, 0x6E, 0x00};
+  switch (apdu[1]) {
+    case INS_SELECT: return select(apdu, length);
+    case INS_READ_BINARY: return readBinary(apdu, length);
+    case INS_UPDATE_BINARY: return Response{nullptr, 0, 0x69, 0x82};   // 唯讀
+    default: return Response{nullptr, 0, 0x6D, 0x00};
+  }
+}
+
+// 00 A4 04 00 Lc AID [Le]：選 NDEF application
+// 00 A4 00 0C 02 ID       ：選 CC / NDEF file（application 要先選過）
+Type4Tag::Response Type4Tag::select(const uint8_t* apdu, uint8_t length) {
+  if (length < 5 || length < 5 + apdu[4]) return Response{nullptr, 0, 0x67, 0x00};
+  const uint8_t* body = apdu + 5;
+  uint8_t lc = apdu[4];
+  if (apdu[2] == 0x04 && apdu[3] == 0x00) {
+    if (lc == sizeof(NDEF_AID) && memcmp(body, NDEF_AID, sizeof(NDEF_AID)) == 0) {
+      selected_ = SEL_APP;
+      return Response{nullptr, 0, 0x90, 0x00};
+    }
+    selected_ = SEL_NONE;
+    return Response{nullptr, 0, 0x6A, 0x82};
+  }
+  if (apdu[2] != 0x00 || (apdu[3] != 0x0C && apdu[3] != 0x00)) return Response{nullptr, 0, 0x6A, 0x86};
+  if (lc != 2) return Response{nullptr, 0, 0x67, 0x00};
+  if (selected_ == SEL_NONE) return Response{nullptr, 0, 0x6A, 0x82};
+  uint16_t id = (uint16_t)(body[0] << 8 | body[1]);
+  if (id == kCcFileId) {
+    selected_ = SEL_CC;
+  } else if (id == kNdefFileId) {
+    selected_ = SEL_NDEF;
+  } else {
+    selected_ = SEL_APP;
+    return Response{nullptr, 0, 0x6A, 0x82};
+  }
+  return Response{nullptr, 0, 0x90, 0x00};
+}
+
+// 00 B0 offset(2) Le：一次最多 MLe，不到 Le 就是 file 剩下的
+Type4Tag::Response Type4Tag::readBinary(const uint8_t* apdu, uint8_t length) {
+  if (length > 5) return Response{nullptr, 0, 0x67, 0x00};
+  if (selected_ != SEL_CC && selected_ != SEL_NDEF) return Response{nullptr, 0, 0x69, 0x86};
+  if (apdu[2] & 0x80) return Response{nullptr, 0, 0x6A, 0x86};   // short EF identifier：不支援
+  uint16_t offset = (uint16_t)(apdu[2] << 8 | apdu[3]);
+  uint16_t le = length == 5 && apdu[4] != 0 ? apdu[4] : 256;
+  const uint8_t* file = selected_ == SEL_CC ? cc_ : file_;
+  uint16_t size = selected_ == SEL_CC ? kCcLength : fileLength_;
+  if (offset > size) return Response{nullptr, 0, 0x6B, 0x00};
+  uint16_t n = size - offset;
+  if (n > le) n = le;
+  if (n > kMaxLe) n = kMaxLe;
+  if (selected_ == SEL_NDEF && offset <= readUpTo_ && offset + n > readUpTo_) readUpTo_ = offset + n;
+  return Response{file + offset, (uint8_t)n, 0x90, 0x00};
+}
+
+// ===== Type4Emulator =====
+
+bool Type4Emulator::start(const uint8_t* file, uint16_t length, uint16_t capacity) {
+  if (reader_.busy() || length == 0) return false;
+  tag_.load(file, length, capacity);
+  lastReadMs_ = 0;
+  return arm();
+}
+
+bool Type4Emulator::arm() {
+  tag_.reset();
+  readReported_ = false;
+  apdus_ = 0;
+  if (!reader_.startCommand(TG_INIT_AS_TARGET, sizeof(TG_INIT_AS_TARGET), ARM_TIMEOUT_MS, rx_, sizeof(rx_))) {
+    state_ = EMU_IDLE;
+    return false;
+  }
+  state_ = EMU_WAIT_PHONE;
+  return true;
+}
+
+bool Type4Emulator::requestApdu() {
+  if (!reader_.startCommand(TG_GET_DATA, sizeof(TG_GET_DATA), APDU_TIMEOUT_MS, rx_, sizeof(rx_))) return false;
+  state_ = EMU_WAIT_APDU;
+  return true;
+}
+
+// 手機走了 / 通訊出錯：重新等下一支；讀完之後才走的不算
+Type4Emulator::Event Type4Emulator::lost() {
+  bool wasRead = readReported_;
+  arm();
+  return wasRead ? EMU_NONE : EMU_LOST;
+}
+
+Type4Emulator::Event Type4Emulator::poll() {
+  if (state_ == EMU_IDLE) return EMU_NONE;
+  Pn532Async::Result r = reader_.poll();
+  if (r == Pn532Async::PN532_PENDING) return EMU_NONE;
+
+  switch (state_) {
+    case EMU_WAIT_PHONE:
+      // 回應 = Mode + 手機的第一個指令（RATS，PN532 已經回過 ATS）
+      if (r != Pn532Async::PN532_RESPONSE) {
+        arm();
+        return EMU_NONE;
+      }
+      phoneAtMs_ = millis();
+      if (!requestApdu()) return lost();
+      return EMU_PHONE;
+
+    case EMU_WAIT_APDU: {
+      // Status + C-APDU；status 0x29 = 手機放掉了 target
+      uint8_t n = reader_.responseLength();
+      if (r != Pn532Async::PN532_RESPONSE || n < 2 || (rx_[0] & 0x3F) != 0) return lost();
+      Type4Tag::Response response = tag_.process(rx_ + 1, n - 1);
+      apdus_++;
+      const uint8_t sw[2] = { response.sw1, response.sw2 };
+      const Pn532Async::Span parts[3] = {
+        { TG_SET_DATA, sizeof(TG_SET_DATA) }, { response.data, response.dataLength }, { sw, sizeof(sw) }
+      };
+      if (!reader_.startCommand(parts, 3, SET_DATA_TIMEOUT_MS, rx_, sizeof(rx_))) return lost();
+      state_ = EMU_SEND;
+      return EMU_NONE;
+    }
+
+    case EMU_SEND:
+      if (r != Pn532Async::PN532_RESPONSE || reader_.responseLength() < 1 || (rx_[0] & 0x3F) != 0) return lost();
+      if (!requestApdu()) return lost();
+      if (tag_.fileRead() && !readReported_) {
+        readReported_ = true;
+        lastReadMs_ = millis() - phoneAtMs_;
+        return EMU_READ;
+      }
+      return EMU_NONE;
+
+    default:
+      return EMU_NONE;
+  }
+}
+
+void Type4Emulator::stop() {
+  reader_.cancel();
+  state_ = EMU_IDLE;
+}
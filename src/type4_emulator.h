@@ -0,0 +1,101 @@
+#pragma once
+// ===== NFC Forum Type 4 tag 模擬（ISO-DEP，給 Android 手機把網址帶走）=====
+// PN532 當 target（卡），手機當 reader。Android 讀 Type 4 tag 的流程（NFC Forum Type 4 Tag 2.0）：
+//
+//   SELECT NDEF AID (D2 76 00 00 85 01 01)
+//   SELECT CC file (E103)   → READ BINARY 15 bytes：MLe / MLc、NDEF file 的 ID 跟大小
+//   SELECT NDEF file (E104) → READ BINARY 2 bytes（NLEN）→ 依 MLe 分段 READ BINARY 整個 message
+//
+// 拆成兩層：
+//   Type4Tag       純 APDU 狀態機，不碰 PN532；C-APDU 進、R-APDU 出，native selftest 直接拿 APDU transcript 對
+//   Type4Emulator  用 Pn532Async 跑 TgInitAsTarget（等手機）→ TgGetData（收 C-APDU）→ TgSetData（送 R-APDU）
+//
+// R-APDU 的 data 是指向 NDEF file（main.cpp 的 ndefBuffer）/ CC 的指標，不另外複製；
+// Type4Emulator 用 Pn532Async 的分段 startCommand() 直接把那一段跟 SW1 SW2 組進 SPI frame。
+// iPhone 不讀模擬的 Type 4 tag（只認實體貼紙），展場的 iPhone 還是走 NTAG 貼紙流程。
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pn532_async.h"
+
+class Type4Tag {
+ public:
+  static const uint16_t kCcFileId = 0xE103;
+  static const uint16_t kNdefFileId = 0xE104;
+  static const uint8_t kCcLength = 15;
+  // MLe / MLc：TgSetData 的 frame 要放得下 MLe + SW1 SW2（Pn532Async::kMaxFrame）
+  static const uint8_t kMaxLe = 0x7F;
+  static const uint8_t kMaxLc = 0x7F;
+
+  // R-APDU = data + SW1 SW2；data 指向 CC / NDEF file 裡面，下一次 process() 之前有效
+  struct Response {
+    const uint8_t* data;
+    uint8_t dataLength;
+    uint8_t sw1;
+    uint8_t sw2;
+  };
+
+  // file = NDEF file（NLEN + message，見 ndef::encodeType4File），capacity = CC 宣告的最大大小
+  // file 由呼叫端持有，模擬期間不能動
+  void load(const uint8_t* file, uint16_t length, uint16_t capacity);
+  // 換一支手機：回到什麼都沒選
+  void reset();
+
+  Response process(const uint8_t* apdu, uint8_t length);
+
+  // 手機已經從頭到尾讀過整個 NDEF file
+  bool fileRead() const { return fileLength_ > 0 && readUpTo_ >= fileLength_; }
+  const uint8_t* ccFile() const { return cc_; }
+
+ private:
+  enum Selected : uint8_t { SEL_NONE, SEL_APP, SEL_CC, SEL_NDEF };
+
+  Response select(const uint8_t* apdu, uint8_t length);
+  Response readBinary(const uint8_t* apdu, uint8_t length);
+
+  uint8_t cc_[kCcLength] = {};
+  const uint8_t* file_ = nullptr;
+  uint16_t fileLength_ = 0;
+  Selected selected_ = SEL_NONE;
+  uint16_t readUpTo_ = 0;   // NDEF file 從 0 開始連續被讀到哪裡
+};
+
+class Type4Emulator {
+ public:
+  enum Event : uint8_t {
+    EMU_NONE,
+    EMU_PHONE,      // 手機進場、ISO-DEP 建好了
+    EMU_READ,       // 手機讀完整個 NDEF file（最後一個 R-APDU 已經送出去）
+    EMU_LOST        // 手機沒讀完就走了 / 通訊錯誤；已經重新等下一支
+  };
+
+  explicit Type4Emulator(Pn532Async& reader) : reader_(reader) {}
+
+  // 開始等手機；reader 必須閒著（先 cancel()）
+  bool start(const uint8_t* file, uint16_t length, uint16_t capacity);
+  // 跟 Pn532Async::poll() 一樣不阻塞，每輪 loop 叫一次
+  Event poll();
+  void stop();
+
+  bool active() const { return state_ != EMU_IDLE; }
+  // 最近一支手機：ISO-DEP 建好 → 讀完整個 NDEF file 花幾 ms、交換了幾個 APDU
+  unsigned long lastReadMs() const { return lastReadMs_; }
+  uint16_t lastApdus() const { return apdus_; }
+
+ private:
+  enum State : uint8_t { EMU_IDLE, EMU_WAIT_PHONE, EMU_WAIT_APDU, EMU_SEND };
+
+  bool arm();
+  bool requestApdu();
+  Event lost();
+
+  Pn532Async& reader_;
+  Type4Tag tag_;
+  State state_ = EMU_IDLE;
+  uint8_t rx_[Pn532Async::kMaxFrame];
+  bool readReported_ = false;   // 這支手機的 EMU_READ 已經回報過
+  unsigned long phoneAtMs_ = 0;
+  unsigned long lastReadMs_ = 0;
+  uint16_t apdus_ = 0;
+};
@@ -0,0 +1,156 @@
+#include "wifi_connector.h"
+
+#include <string.h>
+
+#include "hal.h"
+
+namespace {
+
+const uint32_t kCacheMagic = 0x57494643;   // "WIFC"
+const char* const kCachePath = "/wifi.bin";
+
+// FNV-1a：SSID + 密碼的指紋，也拿來當快取的 checksum
+uint32_t fnv1a(const uint8_t* data, size_t length, uint32_t hash = 2166136261u) {
+  for (size_t i = 0; i < length; i++) {
+    hash ^= data[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+}  // namespace
+
+void WifiConnector::begin(const char* ssid, const char* pass, bool reuseLease, unsigned long nowMs) {
+  ssid_ = ssid;
+  pass_ = pass;
+  reuseLease_ = reuseLease;
+  ssidHash_ = fnv1a((const uint8_t*)pass, strlen(pass), fnv1a((const uint8_t*)ssid, strlen(ssid)));
+  // RTC 有就不碰 flash；斷電開機 RTC 是亂的才讀檔
+  if (loadRtc()) {
+    source_ = CACHE_RTC;
+  } else if (loadFlash()) {
+    source_ = CACHE_FLASH;
+    ESP.rtcUserMemoryWrite(kRtcOffset, (uint32_t*)&cache_, sizeof(cache_));
+  } else {
+    source_ = CACHE_NONE;
+  }
+  haveCache_ = source_ != CACHE_NONE;
+  start(nowMs);
+}
+
+WifiConnector::Event WifiConnector::poll(unsigned long nowMs) {
+  wl_status_t status = WiFi.status();
+  switch (phase_) {
+    case PHASE_CONNECTED:
+      if (status == WL_CONNECTED) return EV_NONE;
+      start(nowMs);
+      return EV_LOST;
+
+    case PHASE_DIRECT:
+    case PHASE_SCAN:
+      if (status == WL_CONNECTED) {
+        lastPath_ = phase_;
+        if (phase_ == PHASE_DIRECT) directHits_++;
+        connectMs_ = nowMs - attemptStartMs_;
+        phase_ = PHASE_CONNECTED;
+        remember();
+        return EV_CONNECTED;
+      }
+      if (phase_ == PHASE_DIRECT) {
+        // 那個 channel 上找不到那台 AP，或等太久：快取不能信了，掃描
+        if (status == WL_NO_SSID_AVAIL || status == WL_CONNECT_FAILED || nowMs - phaseStartMs_ >= kDirectTimeoutMs) {
+          directMisses_++;
+          startScan(nowMs);
+          return EV_DIRECT_FAILED;
+        }
+        return EV_NONE;
+      }
+      if (nowMs - phaseStartMs_ >= kScanTimeoutMs) {
+        start(nowMs);
+        return EV_SCAN_FAILED;
+      }
+      return EV_NONE;
+
+    default:
+      return EV_NONE;
+  }
+}
+
+void WifiConnector::start(unsigned long nowMs) {
+  attemptStartMs_ = nowMs;
+  if (haveCache_) {
+    startDirect(nowMs);
+  } else {
+    startScan(nowMs);
+  }
+}
+
+void WifiConnector::startDirect(unsigned long nowMs) {
+  phase_ = PHASE_DIRECT;
+  phaseStartMs_ = nowMs;
+  if (reuseLease_ && cache_.hasLease) {
+    WiFi.config(IPAddress(cache_.ip), IPAddress(cache_.gateway), IPAddress(cache_.subnet), IPAddress(cache_.dns));
+  }
+  WiFi.begin(ssid_, pass_, cache_.channel, cache_.bssid);
+}
+
+void WifiConnector::startScan(unsigned long nowMs) {
+  phase_ = PHASE_SCAN;
+  phaseStartMs_ = nowMs;
+  // 完整掃描 = 可能換了網路：lease 也不用舊的，回到 DHCP
+  if (reuseLease_) WiFi.config(IPAddress(), IPAddress(), IPAddress(), IPAddress());
+  WiFi.begin(ssid_, pass_);
+}
+
+// 連上了：記下這台 AP；跟快取一樣就什麼都不寫（平常開機 0 次 flash 寫入）
+void WifiConnector::remember() {
+  Cache fresh = {};
+  fresh.magic = kCacheMagic;
+  fresh.ssidHash = ssidHash_;
+  memcpy(fresh.bssid, WiFi.BSSID(), sizeof(fresh.bssid));
+  fresh.channel = (uint8_t)WiFi.channel();
+  fresh.hasLease = 1;
+  fresh.ip = (uint32_t)WiFi.localIP();
+  fresh.gateway = (uint32_t)WiFi.gatewayIP();
+  fresh.subnet = (uint32_t)WiFi.subnetMask();
+  fresh.dns = (uint32_t)WiFi.dnsIP();
+  fresh.crc = checksum(fresh);
+  if (haveCache_ && memcmp(&fresh, &cache_, sizeof(fresh)) == 0) return;
+
+  cache_ = fresh;
+  haveCache_ = true;
+  ESP.rtcUserMemoryWrite(kRtcOffset, (uint32_t*)&cache_, sizeof(cache_));
+  File f = LittleFS.open(kCachePath, "w");
+  if (f) {
+    f.write((const uint8_t*)&cache_, sizeof(cache_));
+    f.close();
+  }
+}
+
+bool WifiConnector::loadRtc() {
+  Cache cache;
+  if (!ESP.rtcUserMemoryRead(kRtcOffset, (uint32_t*)&cache, sizeof(cache)) || !valid(cache)) return false;
+  cache_ = cache;
+  return true;
+}
+
+bool WifiConnector::loadFlash() {
+  if (!LittleFS.begin()) return false;
+  File f = LittleFS.open(kCachePath, "r");
+  if (!f) return false;
+  Cache cache;
+  bool ok = f.read((uint8_t*)&cache, sizeof(cache)) == sizeof(cache);
+  f.close();
+  if (!ok || !valid(cache)) return false;
+  cache_ = cache;
+  return true;
+}
+
+bool WifiConnector::valid(const Cache& cache) const {
+  return cache.magic == kCacheMagic && cache.crc == checksum(cache) && cache.ssidHash == ssidHash_ &&
+         cache.channel >= 1 && cache.channel <= 14;
+}
+
+uint32_t WifiConnector::checksum(const Cache& cache) {
+  return fnv1a((const uint8_t*)&cache, offsetof(Cache, crc));
+}
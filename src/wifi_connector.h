@@ -0,0 +1,90 @@
+#pragma once
+// ===== WiFi 快速連線（記住上次的 AP）=====
+// 以前 setup() 的 WiFi.begin(ssid, pass) 每次都完整掃描 13 個 channel 再 DHCP，最多卡 6 秒；
+// 斷線後 loop() 也是同一條路。展場一天開關機好幾次，每一秒開機時間都是一台不能用的讀卡機。
+//
+// 現在連上之後把 AP 的 BSSID / channel（跟 DHCP 拿到的 lease）記下來：
+//
+//   RTC user memory  reset / 當機 / OTA 之後還在，讀起來不碰 flash
+//   LittleFS /wifi.bin  斷電也還在（展場是直接拔電）；內容有變才寫，平常開機不寫 flash
+//
+// 下次開機 / 斷線重連先「直連」：WiFi.begin(ssid, pass, channel, bssid) 不掃描，
+// kDirectTimeoutMs 內沒連上（AP 換了 channel、換了一台）才退回完整掃描。
+// reuseLease = true 時連 DHCP 也省掉（WiFi.config 直接用上次的 IP），見 main.cpp 的 WIFI_REUSE_LEASE。
+//
+// 全部非阻塞：begin() 送出去就回來，之後 WiFi task 每次呼叫 poll()，狀態有變回傳 Event。
+
+#include <stddef.h>
+#include <stdint.h>
+
+class WifiConnector {
+ public:
+  static const unsigned long kDirectTimeoutMs = 1500;   // 直連等多久沒連上就改完整掃描
+  static const unsigned long kScanTimeoutMs = 10000;    // 完整掃描等多久沒連上算失敗（印診斷、重來）
+  // RTC user memory 前 128 bytes 是 OTA 的 eboot command，快取放在後面
+  static const uint32_t kRtcOffset = 32;
+
+  enum Phase : uint8_t { PHASE_IDLE, PHASE_DIRECT, PHASE_SCAN, PHASE_CONNECTED };
+  enum Event : uint8_t {
+    EV_NONE,
+    EV_CONNECTED,       // 連上了（connectMs() / path() 是這一次的）
+    EV_LOST,            // 斷線，已經開始重連
+    EV_DIRECT_FAILED,   // 直連沒連上，改完整掃描
+    EV_SCAN_FAILED      // 完整掃描也沒連上，重來
+  };
+  // 快取從哪裡來
+  enum Source : uint8_t { CACHE_NONE, CACHE_RTC, CACHE_FLASH };
+
+  // 讀快取、開始連；ssid / pass 要一直有效
+  void begin(const char* ssid, const char* pass, bool reuseLease, unsigned long nowMs);
+  Event poll(unsigned long nowMs);
+
+  Phase phase() const { return phase_; }
+  bool connecting() const { return phase_ == PHASE_DIRECT || phase_ == PHASE_SCAN; }
+  Source cacheSource() const { return source_; }
+  uint8_t cachedChannel() const { return cache_.channel; }
+  // 最近一次連上走哪條路（"direct" / "scan"）、從開始連到連上花多久
+  const char* pathName() const { return lastPath_ == PHASE_DIRECT ? "direct" : "scan"; }
+  unsigned long connectMs() const { return connectMs_; }
+  uint32_t directHits() const { return directHits_; }
+  uint32_t directMisses() const { return directMisses_; }
+
+ private:
+  // RTC / flash 上的格式（4 bytes 對齊，RTC 一次讀寫 4 bytes）
+  struct Cache {
+    uint32_t magic;
+    uint32_t ssidHash;   // 換了 SSID / 密碼快取就作廢
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint8_t hasLease;
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t subnet;
+    uint32_t dns;
+    uint32_t crc;
+  };
+
+  void startDirect(unsigned long nowMs);
+  void startScan(unsigned long nowMs);
+  void start(unsigned long nowMs);
+  void remember();
+  bool loadRtc();
+  bool loadFlash();
+  bool valid(const Cache& cache) const;
+  static uint32_t checksum(const Cache& cache);
+
+  const char* ssid_ = nullptr;
+  const char* pass_ = nullptr;
+  bool reuseLease_ = false;
+  uint32_t ssidHash_ = 0;
+  Cache cache_ = {};
+  bool haveCache_ = false;
+  Source source_ = CACHE_NONE;
+  Phase phase_ = PHASE_IDLE;
+  Phase lastPath_ = PHASE_IDLE;
+  unsigned long phaseStartMs_ = 0;
+  unsigned long attemptStartMs_ = 0;   // 這一輪連線（直連 + 退回掃描）從什麼時候開始
+  unsigned long connectMs_ = 0;
+  uint32_t directHits_ = 0;
+  uint32_t directMisses_ = 0;
+};
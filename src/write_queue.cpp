@@ -0,0 +1,27 @@
+#include "write_queue.h"
+
+#include <string.h>
+
+uint16_t WriteQueue::push(const char* url, size_t length) {
+  if (length == 0 || length > kMaxUrl || full()) return 0;
+  Job& job = jobs_[(head_ + count_) % kSlots];
+  job.id = nextId_++;
+  if (nextId_ == 0) nextId_ = 1;   // 0 留給「失敗」
+  job.attempts = 0;
+  job.length = (uint8_t)length;
+  memcpy(job.url, url, length);
+  job.url[length] = '\0';
+  count_++;
+  return job.id;
+}
+
+void WriteQueue::pop() {
+  if (count_ == 0) return;
+  head_ = (head_ + 1) % kSlots;
+  count_--;
+}
+
+void WriteQueue::clear() {
+  head_ = 0;
+  count_ = 0;
+}
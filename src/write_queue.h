@@ -0,0 +1,67 @@
+#pragma once
+// ===== 批次燒錄佇列（firmware 端）=====
+// 以前 scripts/nfc_batch_write.py 一次只送一個 WRITE:，等 READY_FOR_TAG、再等 OK / FAIL 才送下一個，
+// 燒 100 多張瓶身貼紙的時間大半花在 Serial 來回。現在 host 先用 QUEUE: 塞好幾個 URL，
+// START 之後每放上一張「新」卡就直接寫下一個 URL + 讀回驗證，結果一行一行串流回去；
+// host 收到結果再補一個 QUEUE:，佇列一直是滿的，操作員只要一直換卡就好。
+//
+// 寫失敗的 URL 留在隊首，下一張卡重試；同一個 URL 失敗 kMaxAttempts 次才放棄（GIVEUP）。
+// slot 是固定大小的陣列，不碰 heap。
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef WRITE_QUEUE_SLOTS
+#define WRITE_QUEUE_SLOTS 16
+#endif
+
+class WriteQueue {
+ public:
+  static const uint8_t kSlots = WRITE_QUEUE_SLOTS;
+  // NTAG213 的 NDEF 區 144 bytes，扣掉 TLV + record header 之後 URL 大約就剩這麼多
+  static const uint8_t kMaxUrl = 120;
+  static const uint8_t kMaxAttempts = 3;
+
+  struct Job {
+    uint16_t id;        // 從 1 開始遞增，RESULT:<id> 用它對回 host 的 URL
+    uint8_t attempts;   // 已經失敗幾次
+    uint8_t length;
+    char url[kMaxUrl + 1];
+  };
+
+  // 回傳 job id；URL 空的 / 太長 / 佇列滿回 0
+  uint16_t push(const char* url, size_t length);
+  Job* front() { return count_ ? &jobs_[head_] : nullptr; }
+  void pop();
+  void clear();
+
+  uint8_t count() const { return count_; }
+  uint8_t freeSlots() const { return kSlots - count_; }
+  bool empty() const { return count_ == 0; }
+  bool full() const { return count_ == kSlots; }
+
+ private:
+  Job jobs_[kSlots];
+  uint8_t head_ = 0;
+  uint8_t count_ = 0;
+  uint16_t nextId_ = 1;
+};
+
+// ===== 這一輪批次的統計 =====
+struct BatchStats {
+  uint32_t written = 0;   // 寫入 + 讀回都對
+  uint32_t failed = 0;    // 每一次失敗都算（含之後重試成功的）
+  uint32_t gaveUp = 0;    // 重試到上限被丟掉的 URL
+  unsigned long startedMs = 0;
+
+  void reset(unsigned long nowMs) {
+    written = failed = gaveUp = 0;
+    startedMs = nowMs;
+  }
+  // 從 START 到現在的平均速度（張 / 分鐘，×10 給一位小數用，避免在 ESP8266 上用浮點 printf）
+  uint32_t tagsPerMinuteX10(unsigned long nowMs) const {
+    unsigned long elapsed = nowMs - startedMs;
+    if (elapsed == 0) return 0;
+    return (uint32_t)((uint64_t)written * 600000ULL / elapsed);
+  }
+};
@@ -0,0 +1,111 @@
+#include "ws_binary.h"
+
+#include <string.h>
+
+namespace wsbin {
+
+bool wantsBinary(const uint8_t* url, size_t length) {
+  static const char kKey[] = "proto=bin";
+  const size_t n = sizeof(kKey) - 1;
+  for (size_t i = 0; i + n <= length; i++) {
+    if (memcmp(url + i, kKey, n) != 0) continue;
+    // 前面要是 ? 或 &，後面要是結尾或 &（不要誤認 proto=binary2 之類的）
+    bool startOk = i > 0 && (url[i - 1] == '?' || url[i - 1] == '&');
+    bool endOk = i + n == length || url[i + n] == '&' || url[i + n] == '\0';
+    if (startOk && endOk) return true;
+  }
+  return false;
+}
+
+uint16_t floatToHalf(float value) {
+  uint32_t f;
+  memcpy(&f, &value, sizeof(f));
+  uint16_t sign = (uint16_t)((f >> 16) & 0x8000);
+  int32_t exp = (int32_t)((f >> 23) & 0xFF) - 127 + 15;
+  uint32_t mant = f & 0x7FFFFF;
+
+  if (((f >> 23) & 0xFF) == 0xFF) return (uint16_t)(sign | 0x7C00 | (mant ? 0x200 : 0));   // inf / NaN
+  if (exp >= 0x1F) return (uint16_t)(sign | 0x7C00);                                    // overflow → inf
+  if (exp <= 0) {
+    if (exp < -10) return sign;                                                           // 太小 → ±0
+    // subnormal：把隱含的 1 補回來再右移
+    mant |= 0x800000;
+    uint32_t shift = (uint32_t)(14 - exp);
+    uint32_t half = mant >> shift;
+    uint32_t rest = mant & ((1u << shift) - 1);
+    uint32_t mid = 1u << (shift - 1);
+    if (rest > mid || (rest == mid && (half & 1))) half++;   // round to nearest even
+    return (uint16_t)(sign | half);
+  }
+  uint32_t half = ((uint32_t)exp << 10) | (mant >> 13);
+  uint32_t rest = mant & 0x1FFF;
+  if (rest > 0x1000 || (rest == 0x1000 && (half & 1))) half++;   // 進位可能進到指數，剛好也對
+  return (uint16_t)(sign | half);
+}
+
+float halfToFloat(uint16_t half) {
+  uint32_t sign = (uint32_t)(half & 0x8000) << 16;
+  uint32_t exp = (half >> 10) & 0x1F;
+  uint32_t mant = half & 0x3FF;
+  uint32_t f;
+  if (exp == 0) {
+    if (mant == 0) {
+      f = sign;
+    } else {
+      // subnormal → normalize
+      exp = 127 - 15 + 1;
+      while (!(mant & 0x400)) {
+        mant <<= 1;
+        exp--;
+      }
+      f = sign | (exp << 23) | ((mant & 0x3FF) << 13);
+    }
+  } else if (exp == 0x1F) {
+    f = sign | 0x7F800000 | (mant << 13);
+  } else {
+    f = sign | ((exp - 15 + 127) << 23) | (mant << 13);
+  }
+  float value;
+  memcpy(&value, &f, sizeof(value));
+  return value;
+}
+
+size_t encodeShowContext(uint8_t* out, const uint8_t* uid, uint8_t uidLength, int quoteNumber) {
+  if (uidLength > UID_FIELD) uidLength = UID_FIELD;
+  out[0] = OP_SHOW_CONTEXT;
+  out[1] = uidLength;
+  memcpy(out + 2, uid, uidLength);
+  memset(out + 2 + uidLength, 0, UID_FIELD - uidLength);
+  out[2 + UID_FIELD] = (quoteNumber > 0 && quoteNumber <= 255) ? (uint8_t)quoteNumber : 0;
+  return SHOW_CONTEXT_SIZE;
+}
+
+size_t encodeHold(uint8_t* out, uint8_t op, const uint8_t* uid, uint8_t uidLength) {
+  if (uidLength > UID_FIELD) uidLength = UID_FIELD;
+  out[0] = op;
+  out[1] = uidLength;
+  memcpy(out + 2, uid, uidLength);
+  memset(out + 2 + uidLength, 0, UID_FIELD - uidLength);
+  return HOLD_SIZE;
+}
+
+namespace {
+uint16_t clampMs(uint32_t ms) { return ms > 0xFFFF ? 0xFFFF : (uint16_t)ms; }
+}  // namespace
+
+size_t encodeHoldProgress(uint8_t* out, const uint8_t* uid, uint8_t uidLength, uint32_t heldMs, uint32_t requiredMs,
+                          bool holding) {
+  encodeHold(out, OP_HOLD_PROGRESS, uid, uidLength);
+  writeU16(out + HOLD_SIZE, clampMs(heldMs));
+  writeU16(out + HOLD_SIZE + 2, clampMs(requiredMs));
+  out[HOLD_SIZE + 4] = holding ? 1 : 0;
+  return HOLD_PROGRESS_SIZE;
+}
+
+size_t encodeHoldComplete(uint8_t* out, const uint8_t* uid, uint8_t uidLength, uint32_t heldMs) {
+  encodeHold(out, OP_HOLD_COMPLETE, uid, uidLength);
+  writeU16(out + HOLD_SIZE, clampMs(heldMs));
+  return HOLD_COMPLETE_SIZE;
+}
+
+}  // namespace wsbin
@@ -0,0 +1,98 @@
+#pragma once
+// ===== WebSocket 二進位協定（選用）=====
+// 預設所有事件都是 JSON 文字 frame。顯示端連線時 URL 帶 ?proto=bin（例如 ws://192.168.137.218:81/?proto=bin），
+// firmware 在 WStype_CONNECTED 看到就把這個 client 切成二進位，回一個 HELLO frame 確認；
+// 沒帶、或舊 firmware 不認得 → 照舊 JSON（前端收到 JSON 的 connected 就知道要 fallback）。
+//
+// frame 格式：第 1 byte 是 opcode，後面是固定長度欄位，多 byte 數值一律 little-endian。
+// 只有掃描 / hold / 燈條這些高頻事件有二進位版；燒錄結果、emulate、log_scan 這類少見的照舊走 JSON，
+// 同一條連線上文字 / 二進位 frame 可以混著送。firmware 送出的掃描 / hold 事件一律包在 EVENTS 裡。
+//
+//   firmware → 顯示端
+//     0x01 HELLO           [op][version]
+//     0x10 SHOW_CONTEXT    [op][uidLength][uid × 7（不足補 0）][quoteNumber]   quoteNumber 0 = 未登錄
+//     0x11 RANDOM_QUOTE    [op]
+//     0x12 AI_REVEAL       [op]
+//     0x13 HOLD_START      [op][uidLength][uid × 7]   哪一張卡放上 / 拿走（兩張同時在場時前端靠它分辨）
+//     0x14 HOLD_END        [op][uidLength][uid × 7]   version 1 只有 [op]
+//     0x15 HOLD_PROGRESS   [op][uidLength][uid × 7][held ms u16][required ms u16][holding]   version 4 起（hold_tracker.h）
+//                          不包在 EVENTS、不記 journal：下一個進度馬上就來，掉了也沒關係
+//     0x16 HOLD_COMPLETE   [op][uidLength][uid × 7][held ms u16]   包在 EVENTS 裡，跟 HOLD_START 一樣記 journal
+//     0x20 EVENTS          [op][seq u32][t u32][len][事件][len][事件]...   一個 loop 產生的事件合在一起（event_queue.h）
+//     0x80 HEARTBEAT       [op]（echo）
+//   顯示端 → firmware
+//     0x80 HEARTBEAT       [op]
+//     0x81 LED_MODE        [op][mode]            0 = idle，1 = await_scan，2 = revealed
+//     0x82 LED_PROGRESS    [op][float16]         IEEE 754 half，0.0 ~ 1.0
+//     0x83 CURRENT_QUOTE   [op][int16]           -1 = 沒有
+//     0x84 LED_TIMELINE    [op][loopFrom][loopTo][keyframe × 8 bytes]...   0xFF 0xFF = 不循環（led_timeline.h），version 3 起
+//     0x85 LED_PLAY        [op][offset ms u32]
+//     0x86 LED_SEEK        [op][position ms u32]
+//     0x87 LED_STOP        [op]
+//     0x88 HOLD_TARGET     [op][quoteNumber int16][required ms u16]   -1 = 解除，0 = 任何卡，version 4 起
+//
+// 前端對應的編解碼在 js/nfc.js（WS_BIN_*）
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace wsbin {
+
+const uint8_t PROTOCOL_VERSION = 4;
+
+enum Opcode : uint8_t {
+  OP_HELLO = 0x01,
+  OP_SHOW_CONTEXT = 0x10,
+  OP_RANDOM_QUOTE = 0x11,
+  OP_AI_REVEAL = 0x12,
+  OP_HOLD_START = 0x13,
+  OP_HOLD_END = 0x14,
+  OP_HOLD_PROGRESS = 0x15,
+  OP_HOLD_COMPLETE = 0x16,
+  OP_EVENTS = 0x20,
+  OP_HEARTBEAT = 0x80,
+  OP_LED_MODE = 0x81,
+  OP_LED_PROGRESS = 0x82,
+  OP_CURRENT_QUOTE = 0x83,
+  OP_LED_TIMELINE = 0x84,
+  OP_LED_PLAY = 0x85,
+  OP_LED_SEEK = 0x86,
+  OP_LED_STOP = 0x87,
+  OP_HOLD_TARGET = 0x88,
+};
+
+const uint8_t UID_FIELD = 7;
+const size_t SHOW_CONTEXT_SIZE = 3 + UID_FIELD;
+const size_t HOLD_SIZE = 2 + UID_FIELD;
+const size_t HOLD_PROGRESS_SIZE = HOLD_SIZE + 5;
+const size_t HOLD_COMPLETE_SIZE = HOLD_SIZE + 2;
+const size_t MAX_FRAME = HOLD_PROGRESS_SIZE;
+
+// WStype_CONNECTED 的 payload 是 client 要求的 URL（"/?proto=bin"）
+bool wantsBinary(const uint8_t* url, size_t length);
+
+// float ↔ IEEE 754 half（進度條只需要 0~1，但整個範圍都處理，含 inf / NaN / subnormal）
+uint16_t floatToHalf(float value);
+float halfToFloat(uint16_t half);
+
+inline uint16_t readU16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+inline void writeU16(uint8_t* p, uint16_t v) {
+  p[0] = (uint8_t)(v & 0xFF);
+  p[1] = (uint8_t)(v >> 8);
+}
+inline uint32_t readU32(const uint8_t* p) { return (uint32_t)readU16(p) | ((uint32_t)readU16(p + 2) << 16); }
+inline void writeU32(uint8_t* p, uint32_t v) {
+  writeU16(p, (uint16_t)(v & 0xFFFF));
+  writeU16(p + 2, (uint16_t)(v >> 16));
+}
+
+// 回傳 frame 長度
+size_t encodeShowContext(uint8_t* out, const uint8_t* uid, uint8_t uidLength, int quoteNumber);
+// op = OP_HOLD_START / OP_HOLD_END
+size_t encodeHold(uint8_t* out, uint8_t op, const uint8_t* uid, uint8_t uidLength);
+// 毫秒數超過 65535 就停在 65535（hold 只有幾秒）
+size_t encodeHoldProgress(uint8_t* out, const uint8_t* uid, uint8_t uidLength, uint32_t heldMs, uint32_t requiredMs,
+                          bool holding);
+size_t encodeHoldComplete(uint8_t* out, const uint8_t* uid, uint8_t uidLength, uint32_t heldMs);
+
+}  // namespace wsbin
@@ -0,0 +1,96 @@
+#include "ws_sessions.h"
+
+#include <string.h>
+
+namespace {
+
+struct TopicName {
+  const char* name;
+  uint8_t length;
+  WsTopic topic;
+};
+const TopicName TOPIC_NAMES[] = {
+  { "scan", 4, TOPIC_SCAN },
+  { "led", 3, TOPIC_LED },
+  { "stats", 5, TOPIC_STATS },
+  { "write", 5, TOPIC_WRITE },
+};
+
+}  // namespace
+
+void WsSessions::open(uint8_t num, Proto proto, uint8_t topics) {
+  if (num >= kMaxClients || proto == PROTO_NONE) return;
+  if (proto_[num] == PROTO_NONE) open_++;
+  proto_[num] = proto;
+  topics_[num] = topics & TOPIC_ALL;
+}
+
+void WsSessions::close(uint8_t num) {
+  if (!isOpen(num)) return;
+  proto_[num] = PROTO_NONE;
+  topics_[num] = 0;
+  open_--;
+}
+
+void WsSessions::subscribe(uint8_t num, uint8_t topics) {
+  if (isOpen(num)) topics_[num] |= topics & TOPIC_ALL;
+}
+
+void WsSessions::unsubscribe(uint8_t num, uint8_t topics) {
+  if (isOpen(num)) topics_[num] &= ~topics;
+}
+
+uint8_t WsSessions::subscribers(WsTopic topic, Proto proto) const {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < kMaxClients; i++) {
+    if (proto_[i] == PROTO_NONE || !(topics_[i] & topic)) continue;
+    if (proto == PROTO_NONE || proto_[i] == proto) n++;
+  }
+  return n;
+}
+
+uint8_t WsSessions::parseTopics(const char* list, size_t length) {
+  uint8_t topics = 0;
+  size_t start = 0;
+  while (start <= length) {
+    size_t end = start;
+    while (end < length && list[end] != ',' && list[end] != '\0') end++;
+    size_t n = end - start;
+    if (n == 3 && memcmp(list + start, "all", 3) == 0) topics |= TOPIC_ALL;
+    for (const TopicName& t : TOPIC_NAMES) {
+      if (n == t.length && memcmp(list + start, t.name, n) == 0) topics |= t.topic;
+    }
+    if (end >= length || list[end] == '\0') break;
+    start = end + 1;
+  }
+  return topics;
+}
+
+uint8_t WsSessions::topicsFromUrl(const uint8_t* url, size_t length, uint8_t fallback) {
+  static const char kKey[] = "topics=";
+  const size_t n = sizeof(kKey) - 1;
+  for (size_t i = 1; i + n <= length; i++) {
+    // 前面要是 ? 或 &（跟 wsbin::wantsBinary 一樣，不要誤認 xtopics=）
+    if ((url[i - 1] != '?' && url[i - 1] != '&') || memcmp(url + i, kKey, n) != 0) continue;
+    const char* value = (const char*)url + i + n;
+    size_t valueLength = 0;
+    while (i + n + valueLength < length && value[valueLength] != '&' && value[valueLength] != '\0') valueLength++;
+    return parseTopics(value, valueLength);
+  }
+  return fallback;
+}
+
+size_t WsSessions::formatTopics(uint8_t topics, char* out, size_t capacity) {
+  size_t used = 0;
+  if (capacity == 0) return 0;
+  for (const TopicName& t : TOPIC_NAMES) {
+    if (!(topics & t.topic)) continue;
+    size_t need = (used ? 1 : 0) + t.length;
+    if (used + need >= capacity) break;
+    if (used) out[used++] = ',';
+    memcpy(out + used, t.name, t.length);
+    used += t.length;
+  }
+  out[used] = '\0';
+  return used;
+}
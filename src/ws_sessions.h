@@ -0,0 +1,69 @@
+#pragma once
+// ===== WebSocket client 各自的狀態 + 主題訂閱 =====
+// 以前只有一個全域的 clientConnected：任何一個 client 斷線就變 false，其他還連著的顯示端也收不到事件；
+// 每則訊息也都是 broadcast 給所有人。現在展場同一台 reader 會接好幾個 client：
+// 主畫面（掃描事件）、工作人員的平板（燈條狀態 + 燒錄結果）、記 log 的筆電（stats）。
+//
+// 每個 client 一格（num 就是 WebSocketsServer 的 client 編號）：協定（JSON / 二進位）、訂了哪些主題。
+//
+//   scan    掃描 / hold 事件（show_context、random_quote、ai_reveal、nfc_hold_start / end）
+//   led     燈條模式被任何 client 改了：{"type":"led_state","mode":"await_scan","progress":0.00}
+//   stats   每個心跳週期推一次 profiler + 排程器（跟 {"type":"stats"} 回的一樣）
+//   write   燒錄結果（nfc_write_success / error）、emulate ready / timeout
+//
+// 訂閱：
+//   連線 URL 帶 ?topics=scan,stats（跟 ?proto=bin 可以一起用）；沒帶 = scan + write（舊前端收到的就是這兩種）
+//   {"type":"subscribe","topics":"led,stats"} / {"type":"unsubscribe","topics":"scan"}
+//   → 回 {"type":"subscribed","topics":"scan,led,stats"}（目前訂的全部）
+// 二進位 client 一樣用 JSON 訂閱；led / stats / write 都是文字 frame（少見的訊息不做二進位版，見 ws_binary.h）
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum WsTopic : uint8_t {
+  TOPIC_SCAN = 1 << 0,
+  TOPIC_LED = 1 << 1,
+  TOPIC_STATS = 1 << 2,
+  TOPIC_WRITE = 1 << 3,
+  TOPIC_ALL = 0x0F
+};
+
+class WsSessions {
+ public:
+  // WebSocketsServer 的 client 上限（ESP8266 預設 5）不能超過這個，main.cpp 有 static_assert
+  static const uint8_t kMaxClients = 8;
+  static const uint8_t kDefaultTopics = TOPIC_SCAN | TOPIC_WRITE;
+
+  enum Proto : uint8_t { PROTO_NONE, PROTO_JSON, PROTO_BINARY };
+
+  void open(uint8_t num, Proto proto, uint8_t topics);
+  void close(uint8_t num);
+  void subscribe(uint8_t num, uint8_t topics);
+  void unsubscribe(uint8_t num, uint8_t topics);
+
+  bool isOpen(uint8_t num) const { return num < kMaxClients && proto_[num] != PROTO_NONE; }
+  Proto proto(uint8_t num) const { return num < kMaxClients ? proto_[num] : PROTO_NONE; }
+  uint8_t topics(uint8_t num) const { return isOpen(num) ? topics_[num] : 0; }
+  bool wants(uint8_t num, WsTopic topic) const { return (topics(num) & topic) != 0; }
+
+  uint8_t openCount() const { return open_; }
+  // 訂了 topic 的 client 數；proto = PROTO_NONE 不分協定
+  uint8_t subscribers(WsTopic topic, Proto proto = PROTO_NONE) const;
+  bool anySubscriber(WsTopic topic) const { return subscribers(topic) > 0; }
+  // 所有連著的 client 都是 JSON 而且都訂了 topic → 可以直接 broadcastTXT 一次
+  bool everyoneWantsJson(WsTopic topic) const {
+    return open_ > 0 && subscribers(topic, PROTO_JSON) == open_;
+  }
+
+  // "scan,led" → TOPIC_SCAN | TOPIC_LED；"all" = 全部；不認得的名字略過
+  static uint8_t parseTopics(const char* list, size_t length);
+  // 連線 URL 裡的 topics=...；沒有這個參數回 fallback
+  static uint8_t topicsFromUrl(const uint8_t* url, size_t length, uint8_t fallback);
+  // TOPIC_SCAN | TOPIC_LED → "scan,led"；回傳長度
+  static size_t formatTopics(uint8_t topics, char* out, size_t capacity);
+
+ private:
+  Proto proto_[kMaxClients] = {};
+  uint8_t topics_[kMaxClients] = {};
+  uint8_t open_ = 0;
+};
@@ -0,0 +1,485 @@
+#include "hub_core.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
+namespace hub {
+
+namespace {
+
+void skipSpace(const std::string& s, size_t* pos) {
+  while (*pos < s.size() && (s[*pos] == ' ' || s[*pos] == '\t' || s[*pos] == '\r' || s[*pos] == '\n')) (*pos)++;
+}
+
+// s[*pos] 是 '"'：走到結尾引號後面
+bool skipString(const std::string& s, size_t* pos) {
+  for (size_t i = *pos + 1; i < s.size(); i++) {
+    if (s[i] == '\\') {
+      i++;
+    } else if (s[i] == '"') {
+      *pos = i + 1;
+      return true;
+    }
+  }
+  return false;
+}
+
+// 一個完整的值（字串 / 物件 / 陣列 / 數字 / true / false / null）
+bool skipValue(const std::string& s, size_t* pos) {
+  if (*pos >= s.size()) return false;
+  char c = s[*pos];
+  if (c == '"') return skipString(s, pos);
+  if (c == '{' || c == '[') {
+    int depth = 0;
+    while (*pos < s.size()) {
+      char d = s[*pos];
+      if (d == '"') {
+        if (!skipString(s, pos)) return false;
+        continue;
+      }
+      if (d == '{' || d == '[') depth++;
+      if (d == '}' || d == ']') depth--;
+      (*pos)++;
+      if (depth == 0) return true;
+    }
+    return false;
+  }
+  size_t begin = *pos;
+  while (*pos < s.size() && strchr(",}] \t\r\n", s[*pos]) == nullptr) (*pos)++;
+  return *pos > begin;
+}
+
+const char* const kForwardToScanner[] = {
+  "led_mode", "led_progress", "led_play", "led_seek", "led_stop", "log_scan", "update_current_quote", "emulate_ndef",
+};
+
+}  // namespace
+
+bool splitObject(const std::string& json, std::vector<Member>* members) {
+  members->clear();
+  size_t pos = 0;
+  skipSpace(json, &pos);
+  if (pos >= json.size() || json[pos] != '{') return false;
+  pos++;
+  skipSpace(json, &pos);
+  if (pos < json.size() && json[pos] == '}') return true;
+  for (;;) {
+    skipSpace(json, &pos);
+    size_t keyBegin = pos;
+    if (pos >= json.size() || json[pos] != '"' || !skipString(json, &pos)) return false;
+    Member member;
+    member.key = json.substr(keyBegin + 1, pos - keyBegin - 2);
+    skipSpace(json, &pos);
+    if (pos >= json.size() || json[pos] != ':') return false;
+    pos++;
+    skipSpace(json, &pos);
+    size_t valueBegin = pos;
+    if (!skipValue(json, &pos)) return false;
+    member.raw = json.substr(valueBegin, pos - valueBegin);
+    members->push_back(member);
+    skipSpace(json, &pos);
+    if (pos >= json.size()) return false;
+    if (json[pos] == '}') return true;
+    if (json[pos] != ',') return false;
+    pos++;
+  }
+}
+
+bool splitArray(const std::string& json, std::vector<std::string>* items) {
+  items->clear();
+  size_t pos = 0;
+  skipSpace(json, &pos);
+  if (pos >= json.size() || json[pos] != '[') return false;
+  pos++;
+  skipSpace(json, &pos);
+  if (pos < json.size() && json[pos] == ']') return true;
+  for (;;) {
+    skipSpace(json, &pos);
+    size_t begin = pos;
+    if (!skipValue(json, &pos)) return false;
+    items->push_back(json.substr(begin, pos - begin));
+    skipSpace(json, &pos);
+    if (pos >= json.size()) return false;
+    if (json[pos] == ']') return true;
+    if (json[pos] != ',') return false;
+    pos++;
+  }
+}
+
+std::string joinObject(const std::vector<Member>& members) {
+  std::string out = "{";
+  for (size_t i = 0; i < members.size(); i++) {
+    if (i) out += ',';
+    out += quote(members[i].key);
+    out += ':';
+    out += members[i].raw;
+  }
+  out += '}';
+  return out;
+}
+
+const Member* findMember(const std::vector<Member>& members, const char* key) {
+  for (const Member& m : members) {
+    if (m.key == key) return &m;
+  }
+  return nullptr;
+}
+
+void removeMember(std::vector<Member>* members, const char* key) {
+  members->erase(std::remove_if(members->begin(), members->end(), [key](const Member& m) { return m.key == key; }),
+                 members->end());
+}
+
+std::string stringValue(const Member* member) {
+  if (!member || member->raw.size() < 2 || member->raw[0] != '"') return "";
+  std::string out;
+  const std::string& raw = member->raw;
+  for (size_t i = 1; i + 1 < raw.size(); i++) {
+    char c = raw[i];
+    if (c == '\\' && i + 2 < raw.size()) {
+      c = raw[++i];
+      switch (c) {
+        case 'n': c = '\n'; break;
+        case 't': c = '\t'; break;
+        case 'r': c = '\r'; break;
+        case 'b': c = '\b'; break;
+        case 'f': c = '\f'; break;
+        default: break;   // \" \\ \/；\uXXXX 這裡用不到（type / reader 都是 ASCII）
+      }
+    }
+    out += c;
+  }
+  return out;
+}
+
+bool intValue(const Member* member, int64_t* out) {
+  if (!member || member->raw.empty()) return false;
+  char* end = nullptr;
+  long long v = strtoll(member->raw.c_str(), &end, 10);
+  if (end == member->raw.c_str() || *end != '\0') return false;
+  *out = v;
+  return true;
+}
+
+std::string quote(const std::string& text) {
+  std::string out = "\"";
+  for (char c : text) {
+    switch (c) {
+      case '"': out += "\\\""; break;
+      case '\\': out += "\\\\"; break;
+      case '\n': out += "\\n"; break;
+      case '\r': out += "\\r"; break;
+      case '\t': out += "\\t"; break;
+      default:
+        if ((unsigned char)c < 0x20) {
+          char esc[8];
+          snprintf(esc, sizeof(esc), "\\u%04x", c);
+          out += esc;
+        } else {
+          out += c;
+        }
+        break;
+    }
+  }
+  out += '"';
+  return out;
+}
+
+// ===== ClockSync =====
+
+void ClockSync::onHeartbeat(int64_t sentMs, int64_t receivedMs, int64_t deviceMs) {
+  int64_t rtt = receivedMs - sentMs;
+  if (rtt < 0) return;
+  // RTT 比較小（比較準）或手上的樣本太舊才換
+  if (haveSample_ && rtt > rtt_ && receivedMs - sampleAtMs_ < kSampleHoldMs) return;
+  haveSample_ = true;
+  offset_ = deviceMs - (sentMs + receivedMs) / 2;
+  rtt_ = rtt;
+  sampleAtMs_ = receivedMs;
+}
+
+void ClockSync::onEvent(int64_t deviceMs, int64_t receivedMs) {
+  int64_t bound = deviceMs - receivedMs;
+  if (!haveEvent_ || bound > eventOffset_) eventOffset_ = bound;
+  haveEvent_ = true;
+}
+
+int64_t ClockSync::toHubMs(int64_t deviceMs, int64_t receivedMs) const {
+  if (!haveSample_ && !haveEvent_) return receivedMs;
+  return deviceMs - offsetMs();
+}
+
+// ===== Aggregator =====
+
+int Aggregator::addNode(const std::string& id) {
+  Node node;
+  node.id = id;
+  nodes_.push_back(node);
+  return (int)nodes_.size() - 1;
+}
+
+int Aggregator::findNode(const std::string& id) const {
+  for (size_t i = 0; i < nodes_.size(); i++) {
+    if (nodes_[i].id == id) return (int)i;
+  }
+  return -1;
+}
+
+std::string Aggregator::nodeOnline(int node, int64_t nowMs) {
+  Node& n = nodes_[node];
+  n.online = true;
+  n.clock.reset();
+  n.heartbeatSentMs = -1;
+  n.fresh = true;
+  outbox_.push_back("{\"type\":\"reader_online\",\"reader\":" + quote(n.id) + ",\"t\":" + std::to_string(nowMs) + "}");
+  return n.lastSeq ? "{\"type\":\"replay\",\"after\":" + std::to_string(n.lastSeq) + "}" : std::string();
+}
+
+void Aggregator::nodeOffline(int node, int64_t nowMs) {
+  Node& n = nodes_[node];
+  if (!n.online) return;
+  n.online = false;
+  if (lastScanNode_ == node) lastScanNode_ = -1;
+  outbox_.push_back("{\"type\":\"reader_offline\",\"reader\":" + quote(n.id) + ",\"t\":" + std::to_string(nowMs) + "}");
+}
+
+std::string Aggregator::heartbeat(int node, int64_t nowMs) {
+  nodes_[node].heartbeatSentMs = nowMs;
+  return "{\"type\":\"heartbeat\"}";
+}
+
+std::string Aggregator::fromNode(int node, const std::string& text, int64_t nowMs) {
+  Node& n = nodes_[node];
+  std::vector<Member> members;
+  if (!splitObject(text, &members)) return std::string();
+  std::string type = stringValue(findMember(members, "type"));
+
+  // 自己送的 heartbeat 的回覆：對時，不轉送
+  if (type == "heartbeat") {
+    int64_t deviceMs;
+    if (n.heartbeatSentMs >= 0 && intValue(findMember(members, "t"), &deviceMs)) {
+      n.clock.onHeartbeat(n.heartbeatSentMs, nowMs, deviceMs);
+    }
+    n.heartbeatSentMs = -1;
+    return std::string();
+  }
+  // firmware 的歡迎訊息：hub 已經送過 reader_online
+  if (type == "connected") return std::string();
+  // 重連時要的 replay 補完了（或補到一半）：不轉送
+  if (type == "replay_done") {
+    n.fresh = false;
+    int64_t last = 0, lost = 0;
+    intValue(findMember(members, "last"), &last);
+    const Member* reset = findMember(members, "reset");
+    const Member* more = findMember(members, "more");
+    if (reset && reset->raw == "true") {
+      // reader 的 journal 比 hub 記得的還舊（flash 清過）：從它的 seq 重新算
+      n.lastSeq = last;
+      return std::string();
+    }
+    if (intValue(findMember(members, "lost"), &lost) && lost > 0) n.replayLost += (uint32_t)lost;
+    if (more && more->raw == "true") {
+      return "{\"type\":\"replay\",\"after\":" + std::to_string(std::max(n.lastSeq, last)) + "}";
+    }
+    return std::string();
+  }
+
+  int64_t seq, deviceMs;
+  if (!intValue(findMember(members, "seq"), &seq) || !intValue(findMember(members, "t"), &deviceMs)) {
+    // 不是事件 frame（led_state / stats / nfc_write_* ...）：標上 reader 立刻轉送
+    members.push_back(Member{"reader", quote(n.id)});
+    outbox_.push_back(joinObject(members));
+    return std::string();
+  }
+
+  // seq 每個 frame +1，重開機也接著編（journal）：收過的 = replay 重疊，丟掉
+  // 例外：重連後第一個 frame 就變小、也沒回 replay_done = 沒有 journal 的舊 firmware 重開機了，重新起算
+  if (n.lastSeq && seq <= n.lastSeq && !n.fresh) {
+    n.duplicates++;
+    return std::string();
+  }
+  if (n.lastSeq && seq > n.lastSeq + 1) n.seqGaps += (uint32_t)(seq - n.lastSeq - 1);
+  n.fresh = false;
+  n.lastSeq = seq;
+  n.clock.onEvent(deviceMs, nowMs);
+  int64_t alignedMs = n.clock.toHubMs(deviceMs, nowMs);
+
+  if (type != "events") {
+    removeMember(&members, "seq");
+    removeMember(&members, "t");
+    pushEvent(node, std::move(members), alignedMs);
+    return std::string();
+  }
+  const Member* list = findMember(members, "events");
+  std::vector<std::string> items;
+  if (!list || !splitArray(list->raw, &items)) return std::string();
+  for (const std::string& item : items) {
+    std::vector<Member> event;
+    if (splitObject(item, &event)) pushEvent(node, std::move(event), alignedMs);
+  }
+  return std::string();
+}
+
+void Aggregator::pushEvent(int node, std::vector<Member> members, int64_t alignedMs) {
+  removeMember(&members, "reader");
+  pending_.push_back(Pending{alignedMs, order_++, node, std::move(members)});
+}
+
+Aggregator::Route Aggregator::fromDisplay(const std::string& text, int64_t nowMs) {
+  Route route;
+  std::vector<Member> members;
+  if (!splitObject(text, &members)) return route;
+  std::string type = stringValue(findMember(members, "type"));
+
+  // 顯示端的 watchdog：hub 自己回（帶 hub 時間），不用每台 reader 都回一次
+  if (type == "heartbeat") {
+    route.replies.push_back("{\"type\":\"heartbeat\",\"t\":" + std::to_string(nowMs) + "}");
+    return route;
+  }
+  // 顯示端重連補拿：hub 的 seq，從 hub 自己的 history 回
+  if (type == "replay") {
+    int64_t after;
+    if (intValue(findMember(members, "after"), &after) && after >= 0) replayHistory(after, &route.replies);
+    return route;
+  }
+
+  const Member* reader = findMember(members, "reader");
+  if (reader) {
+    std::string id = stringValue(reader);
+    removeMember(&members, "reader");
+    route.text = joinObject(members);
+    if (id == "*") {
+      route.nodes = onlineNodes();
+      return route;
+    }
+    int node = findNode(id);
+    if (node >= 0 && nodes_[node].online) {
+      route.nodes.push_back(node);
+    } else {
+      route.replies.push_back("{\"type\":\"route_error\",\"reader\":" + quote(id) + ",\"error\":\"" +
+                              (node < 0 ? "unknown_reader" : "offline") + "\"}");
+    }
+    return route;
+  }
+
+  route.text = text;
+  // 燈條 / 雞湯指令沒指定 reader：給最後一個掃到卡的（觀眾正站在那台前面）
+  for (const char* name : kForwardToScanner) {
+    if (type == name && lastScanNode_ >= 0) {
+      route.nodes.push_back(lastScanNode_);
+      return route;
+    }
+  }
+  route.nodes = onlineNodes();
+  return route;
+}
+
+std::string Aggregator::welcome() const {
+  std::string readers = "[";
+  for (int node : onlineNodes()) {
+    if (readers.size() > 1) readers += ',';
+    readers += quote(nodes_[node].id);
+  }
+  readers += ']';
+  return "{\"type\":\"connected\",\"message\":\"Connected to NFC hub\",\"readers\":" + readers + "}";
+}
+
+std::vector<std::string> Aggregator::takeForDisplays(int64_t nowMs) {
+  releaseUpTo(nowMs - windowMs_);
+  std::vector<std::string> out;
+  out.swap(outbox_);
+  return out;
+}
+
+int64_t Aggregator::nextReleaseMs() const {
+  if (pending_.empty()) return -1;
+  int64_t earliest = pending_[0].alignedMs;
+  for (const Pending& p : pending_) earliest = std::min(earliest, p.alignedMs);
+  return earliest + windowMs_;
+}
+
+void Aggregator::releaseUpTo(int64_t cutoffMs) {
+  std::vector<Pending> due;
+  for (size_t i = 0; i < pending_.size();) {
+    if (pending_[i].alignedMs <= cutoffMs) {
+      due.push_back(std::move(pending_[i]));
+      pending_.erase(pending_.begin() + i);
+    } else {
+      i++;
+    }
+  }
+  if (due.empty()) return;
+  std::sort(due.begin(), due.end(), [](const Pending& a, const Pending& b) {
+    return a.alignedMs != b.alignedMs ? a.alignedMs < b.alignedMs : a.order < b.order;
+  });
+  for (Pending& event : due) {
+    // 比已經送出去的還早：順序救不回來了，t 至少不要倒退
+    if (event.alignedMs < lastReleasedMs_) {
+      event.alignedMs = lastReleasedMs_;
+      lateEvents_++;
+    }
+    lastReleasedMs_ = event.alignedMs;
+    std::string type = stringValue(findMember(event.members, "type"));
+    if (type == "show_context" || type == "nfc_hold_start") lastScanNode_ = event.node;
+  }
+
+  hubSeq_++;
+  if (due.size() == 1) {
+    emit(labelled(due[0], true));
+    return;
+  }
+  std::string frame = "{\"type\":\"events\",\"seq\":" + std::to_string(hubSeq_) +
+                      ",\"t\":" + std::to_string(due[0].alignedMs) + ",\"events\":[";
+  for (size_t i = 0; i < due.size(); i++) {
+    if (i) frame += ',';
+    frame += labelled(due[i], false);
+  }
+  frame += "]}";
+  emit(std::move(frame));
+}
+
+// 送出的事件 frame 也留一份給顯示端 replay
+void Aggregator::emit(std::string frame) {
+  history_.push_back(Sent{hubSeq_, frame});
+  if (history_.size() > kHistoryFrames) history_.pop_front();
+  outbox_.push_back(std::move(frame));
+}
+
+// 回的格式跟 firmware 的 onWsReplay 一樣；hub 沒有 TCP 塞車的顧慮，一次全部補完（more 永遠 false）
+void Aggregator::replayHistory(int64_t after, std::vector<std::string>* replies) const {
+  bool reset = after > hubSeq_;   // hub 重開過，seq 從頭算
+  int64_t last = after;
+  if (!reset) {
+    for (const Sent& sent : history_) {
+      if (sent.seq <= after) continue;
+      replies->push_back(sent.text);
+      last = sent.seq;
+    }
+  }
+  int64_t oldest = history_.empty() ? hubSeq_ + 1 : history_.front().seq;
+  int64_t lost = (!reset && oldest > after + 1) ? oldest - after - 1 : 0;
+  replies->push_back("{\"type\":\"replay_done\",\"after\":" + std::to_string(after) + ",\"last\":" +
+                     std::to_string(reset ? hubSeq_ : last) + ",\"more\":false,\"lost\":" + std::to_string(lost) +
+                     (reset ? ",\"reset\":true}" : "}"));
+}
+
+std::string Aggregator::labelled(const Pending& event, bool withFrameFields) const {
+  std::vector<Member> members = event.members;
+  members.push_back(Member{"reader", quote(nodes_[event.node].id)});
+  if (withFrameFields) members.push_back(Member{"seq", std::to_string(hubSeq_)});
+  members.push_back(Member{"t", std::to_string(event.alignedMs)});
+  return joinObject(members);
+}
+
+std::vector<int> Aggregator::onlineNodes() const {
+  std::vector<int> out;
+  for (size_t i = 0; i < nodes_.size(); i++) {
+    if (nodes_[i].online) out.push_back((int)i);
+  }
+  return out;
+}
+
+}  // namespace hub
@@ -0,0 +1,167 @@
+#pragma once
+// ===== 多台讀卡機的事件合流（hub 的邏輯部分，不碰 socket）=====
+// 展場不只一台 ESP：每台 controller（reader）各自有自己的 millis()，各自送 seq / t 的事件 frame
+// （src/event_queue.h）。hub 連到每一台，把事件照「發生的時間」排成一條流，標上是哪一台，
+// 再送給所有顯示端；顯示端回的燈條指令送回對的那一台。
+//
+// 時間對齊：每台的 millis() 跟 hub 的時鐘差一個 offset。
+//   - hub 定期送 {"type":"heartbeat"}，firmware 回 {"type":"heartbeat","t":millis()}：
+//     offset ≈ t - (送出 + 收到) / 2，誤差 ≤ RTT / 2，取 RTT 最小的那次（NTP 的作法）
+//   - 舊 firmware 回的 heartbeat 沒有 t：退而用事件本身，事件一定在收到之前發生，
+//     offset ≥ t - 收到時間，取看過最大的那個（少算了網路延遲，但同一台之內順序不受影響）
+// 合流：對齊後的事件先放著，等 windowMs（比最慢的那台的延遲長）沒有更早的事件進來才放出去；
+// 太晚到（比已經放出去的還早）的照樣送，t 拉到已送出的最後時間，記一次 late。
+//
+// 送給顯示端的格式跟 firmware 一樣（前端 nfc.js 不用改），每個事件多一個 "reader"：
+//   一個事件 → {"type":"nfc_hold_end","uid":"..","reader":"p1","seq":43,"t":123456}
+//   兩個以上 → {"type":"events","seq":42,"t":..,"events":[{..,"reader":"p1","t":..},{..}]}
+// seq 是 hub 自己的（每個送出的 frame +1），t 是 hub 時間（ms）。
+//
+// 斷線補送（firmware 的 scan journal，src/scan_journal.h）：
+//   - reader 重連：hub 送 {"type":"replay","after":<這台最後收到的 seq>}，補回來的 frame 照一般事件合流
+//     （太晚到的照 late 處理）；replay_done 的 more = 還沒補完，hub 接著要
+//   - 顯示端重連：hub 自己留最近 kHistoryFrames 個送出的 frame，用 hub seq 回 replay / replay_done，
+//     格式跟 firmware 一樣，前端分不出是接 hub 還是直接接 ESP
+
+#include <stdint.h>
+
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace hub {
+
+// ---- 頂層 JSON 欄位（只拆一層，值保留原文）----
+struct Member {
+  std::string key;
+  std::string raw;   // 原封不動的 JSON 值：字串含引號、物件 / 陣列含括號
+};
+
+// 不是 {...} 物件或語法壞掉回 false
+bool splitObject(const std::string& json, std::vector<Member>* members);
+// 陣列 [...] 的元素（原文）
+bool splitArray(const std::string& json, std::vector<std::string>* items);
+std::string joinObject(const std::vector<Member>& members);
+const Member* findMember(const std::vector<Member>& members, const char* key);
+void removeMember(std::vector<Member>* members, const char* key);
+// 字串值去引號、還原 escape；不是字串回 ""
+std::string stringValue(const Member* member);
+bool intValue(const Member* member, int64_t* out);
+std::string quote(const std::string& text);
+
+// ---- 一台 reader 的時鐘 ----
+class ClockSync {
+ public:
+  // heartbeat 樣本最多留多久：時鐘會漂，太舊的最小 RTT 樣本讓新樣本取代
+  static const int64_t kSampleHoldMs = 10000;
+
+  void onHeartbeat(int64_t sentMs, int64_t receivedMs, int64_t deviceMs);
+  void onEvent(int64_t deviceMs, int64_t receivedMs);
+  void reset() { *this = ClockSync(); }
+
+  bool synced() const { return haveSample_; }
+  // 裝置時間 → hub 時間；完全沒有資料時當作剛剛發生
+  int64_t toHubMs(int64_t deviceMs, int64_t receivedMs) const;
+  int64_t offsetMs() const { return haveSample_ ? offset_ : eventOffset_; }
+  int64_t rttMs() const { return haveSample_ ? rtt_ : -1; }
+
+ private:
+  bool haveSample_ = false;
+  int64_t offset_ = 0;
+  int64_t rtt_ = 0;
+  int64_t sampleAtMs_ = 0;
+  bool haveEvent_ = false;
+  int64_t eventOffset_ = 0;
+};
+
+// ---- 合流 + 路由 ----
+class Aggregator {
+ public:
+  static const int kAllNodes = -1;
+  // 顯示端 replay 用：留最近幾個送出的事件 frame
+  static const size_t kHistoryFrames = 512;
+
+  explicit Aggregator(int64_t windowMs = 60) : windowMs_(windowMs) {}
+
+  int addNode(const std::string& id);
+  size_t nodeCount() const { return nodes_.size(); }
+  const std::string& nodeId(int node) const { return nodes_[node].id; }
+  int findNode(const std::string& id) const;
+  bool isOnline(int node) const { return nodes_[node].online; }
+  const ClockSync& clock(int node) const { return nodes_[node].clock; }
+
+  // 連上 / 斷線：通知顯示端 reader_online / reader_offline；連上時時鐘重新對（reader 可能重開機過），
+  // seq 留著：回傳要送給 reader 的 replay 要求（第一次連上 = 空字串）
+  std::string nodeOnline(int node, int64_t nowMs);
+  void nodeOffline(int node, int64_t nowMs);
+  // hub 要送給 reader 的 heartbeat（記下送出時間，回覆回來時算 offset）
+  std::string heartbeat(int node, int64_t nowMs);
+  // reader 送來的文字訊息；回傳要回給這台 reader 的（replay 還沒補完就接著要），沒有 = 空字串
+  std::string fromNode(int node, const std::string& text, int64_t nowMs);
+
+  // 顯示端送來的指令要往哪送：nodes 是 reader（已經去掉 "reader" 欄位的 text），replies 依序直接回給這個顯示端
+  struct Route {
+    std::vector<int> nodes;
+    std::string text;
+    std::vector<std::string> replies;
+  };
+  Route fromDisplay(const std::string& text, int64_t nowMs);
+  // 新的顯示端連上：歡迎訊息 + 目前在線的 reader
+  std::string welcome() const;
+
+  // 把到期的事件組成 frame，連同其他要立刻轉送的訊息一起取出（送給所有顯示端）
+  std::vector<std::string> takeForDisplays(int64_t nowMs);
+  // 還沒放出去的事件最早什麼時候到期（沒有 → -1），主迴圈的 poll timeout 用
+  int64_t nextReleaseMs() const;
+
+  // 統計
+  uint32_t lateEvents() const { return lateEvents_; }
+  uint32_t seqGaps(int node) const { return nodes_[node].seqGaps; }
+  // replay 跟即時送的重疊、丟掉的 frame；reader 的 journal 已經輪掉、補不回來的 frame
+  uint32_t duplicates(int node) const { return nodes_[node].duplicates; }
+  uint32_t replayLost(int node) const { return nodes_[node].replayLost; }
+  int lastScanNode() const { return lastScanNode_; }
+
+ private:
+  struct Node {
+    std::string id;
+    bool online = false;
+    ClockSync clock;
+    int64_t heartbeatSentMs = -1;
+    int64_t lastSeq = 0;
+    bool fresh = false;   // 這次連上之後還沒收到事件 frame / replay_done
+    uint32_t seqGaps = 0;
+    uint32_t duplicates = 0;
+    uint32_t replayLost = 0;
+  };
+  struct Sent {
+    uint32_t seq;
+    std::string text;
+  };
+  struct Pending {
+    int64_t alignedMs;
+    uint64_t order;   // 同一毫秒照收到的順序
+    int node;
+    std::vector<Member> members;   // 已經去掉 seq / t
+  };
+
+  void pushEvent(int node, std::vector<Member> members, int64_t alignedMs);
+  void releaseUpTo(int64_t cutoffMs);
+  std::string labelled(const Pending& event, bool withFrameFields) const;
+  std::vector<int> onlineNodes() const;
+  void replayHistory(int64_t after, std::vector<std::string>* replies) const;
+  void emit(std::string frame);
+
+  int64_t windowMs_;
+  std::vector<Node> nodes_;
+  std::vector<Pending> pending_;
+  std::vector<std::string> outbox_;
+  std::deque<Sent> history_;
+  uint64_t order_ = 0;
+  uint32_t hubSeq_ = 0;
+  int64_t lastReleasedMs_ = INT64_MIN;
+  uint32_t lateEvents_ = 0;
+  int lastScanNode_ = -1;
+};
+
+}  // namespace hub
@@ -0,0 +1,640 @@
+// ===== 多台讀卡機 hub =====
+// 連到每一台 controller（ESP 的 ws://<ip>:81），把各台的掃卡事件依發生時間合成一條流、標上 reader，
+// 送給連到 hub 的所有顯示端；顯示端的燈條指令送回對的那一台（規則見 hub_core.h）。
+// 顯示端只要把 js/config.js 的 websocket.url 改指 hub，格式跟直接連 ESP 一樣。
+//
+// build（跑在展場的筆電 / 樹莓派上，不是 firmware 的一部分）：
+//   g++ -std=gnu++17 -O2 -Wall tools/hub/*.cpp -o hub
+//
+// 用法：
+//   ./hub --listen 8081 --node p1=192.168.137.218:81 --node p2=192.168.137.64:81 [--window-ms 60] [-v]
+//   ./hub --selftest
+// selftest 在 localhost 起三台模擬的 controller（時鐘各差很多、其中一台事件晚 30ms 才送），
+// 檢查合流順序、reader 標籤、燈條指令路由、heartbeat、reader 斷線通知；有任何一項不對 exit 1
+
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "hub_core.h"
+#include "ws_socket.h"
+
+namespace {
+
+int64_t nowMs() {
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+struct NodeSpec {
+  std::string id;
+  std::string host;
+  uint16_t port;
+};
+
+// "p1=192.168.137.218:81"
+bool parseNodeSpec(const char* text, NodeSpec* spec) {
+  const char* eq = strchr(text, '=');
+  const char* colon = strrchr(text, ':');
+  if (!eq || !colon || colon < eq || eq == text) return false;
+  int port = atoi(colon + 1);
+  if (port <= 0 || port > 65535) return false;
+  spec->id.assign(text, eq - text);
+  spec->host.assign(eq + 1, colon - eq - 1);
+  spec->port = (uint16_t)port;
+  return !spec->host.empty();
+}
+
+class Hub {
+ public:
+  // 連不上 / 斷線之後的重連間隔（每次加倍到上限）
+  static const int64_t kReconnectMinMs = 200;
+  static const int64_t kReconnectMaxMs = 3000;
+
+  Hub(hub::Aggregator* aggregator, int listenFd, const std::vector<NodeSpec>& specs, int64_t heartbeatMs,
+      bool verbose)
+      : agg_(aggregator), listenFd_(listenFd), heartbeatMs_(heartbeatMs), verbose_(verbose) {
+    for (const NodeSpec& spec : specs) {
+      Node node;
+      node.spec = spec;
+      node.index = agg_->addNode(spec.id);
+      nodes_.push_back(std::move(node));
+    }
+  }
+
+  // 一輪：poll 所有 socket（最多等 timeoutMs），處理收到的訊息、到期的 heartbeat / 合流事件
+  void poll(int timeoutMs) {
+    int64_t now = nowMs();
+    for (Node& node : nodes_) {
+      if (!node.conn && now >= node.nextAttemptMs) connect(node, now);
+    }
+
+    std::vector<pollfd> fds;
+    fds.push_back(pollfd{listenFd_, POLLIN, 0});
+    for (Node& node : nodes_) {
+      if (node.conn) fds.push_back(pollfd{node.conn->fd(), events(*node.conn), 0});
+    }
+    for (auto& display : displays_) fds.push_back(pollfd{display.conn->fd(), events(*display.conn), 0});
+
+    int64_t release = agg_->nextReleaseMs();
+    if (release >= 0 && release - now < timeoutMs) timeoutMs = (int)std::max<int64_t>(0, release - now);
+    ::poll(fds.data(), fds.size(), timeoutMs);
+    now = nowMs();
+
+    size_t f = 0;
+    if (fds[f++].revents & POLLIN) {
+      int fd;
+      while ((fd = ws::acceptTcp(listenFd_)) >= 0) {
+        displays_.push_back(Display{std::unique_ptr<ws::Connection>(new ws::Connection(fd, ws::Connection::SERVER_SIDE)), false});
+      }
+    }
+    for (Node& node : nodes_) {
+      if (!node.conn) continue;
+      serviceNode(node, fds[f++].revents, now);
+    }
+    for (auto& display : displays_) serviceDisplay(display, fds[f++].revents, now);
+
+    for (const std::string& text : agg_->takeForDisplays(now)) {
+      if (verbose_) printf("[hub] → 顯示端: %s\n", text.c_str());
+      for (auto& display : displays_) {
+        if (display.conn->isOpen()) display.conn->sendText(text);
+      }
+    }
+
+    // 這一輪排進去的先試著送，不用等下一輪 POLLOUT
+    for (Node& node : nodes_) {
+      if (node.conn && node.conn->isOpen()) node.conn->onWritable();
+    }
+    for (auto& display : displays_) {
+      if (display.conn->isOpen()) display.conn->onWritable();
+    }
+    displays_.erase(std::remove_if(displays_.begin(), displays_.end(),
+                                   [](const Display& d) { return d.conn->isClosed(); }),
+                    displays_.end());
+  }
+
+  size_t displayCount() const { return displays_.size(); }
+
+ private:
+  struct Node {
+    NodeSpec spec;
+    int index = 0;
+    std::unique_ptr<ws::Connection> conn;
+    bool announced = false;
+    int64_t nextAttemptMs = 0;
+    int64_t backoffMs = kReconnectMinMs;
+    int64_t nextHeartbeatMs = 0;
+    int64_t lastHeardMs = 0;
+  };
+  struct Display {
+    std::unique_ptr<ws::Connection> conn;
+    bool welcomed;
+  };
+
+  static short events(const ws::Connection& conn) { return POLLIN | (conn.wantsWrite() ? POLLOUT : 0); }
+
+  void connect(Node& node, int64_t now) {
+    int fd = ws::connectTcp(node.spec.host, node.spec.port);
+    if (fd < 0) {
+      retryLater(node, now);
+      return;
+    }
+    // 燈條狀態、燒錄結果也要轉給顯示端
+    node.conn.reset(new ws::Connection(fd, ws::Connection::CLIENT_SIDE,
+                                       node.spec.host + ":" + std::to_string(node.spec.port),
+                                       "/?topics=scan,led,write"));
+    node.lastHeardMs = now;
+  }
+
+  void retryLater(Node& node, int64_t now) {
+    node.conn.reset();
+    node.nextAttemptMs = now + node.backoffMs;
+    node.backoffMs = std::min(node.backoffMs * 2, kReconnectMaxMs);
+  }
+
+  void serviceNode(Node& node, short revents, int64_t now) {
+    std::vector<ws::Message> messages;
+    if (revents & (POLLIN | POLLHUP | POLLERR)) node.conn->onReadable(&messages);
+    if ((revents & POLLOUT) && !node.conn->isClosed()) node.conn->onWritable();
+
+    if (node.conn->isOpen() && !node.announced) {
+      node.announced = true;
+      node.backoffMs = kReconnectMinMs;
+      node.nextHeartbeatMs = now;
+      std::string replay = agg_->nodeOnline(node.index, now);
+      // 斷線期間這台掃到的卡記在它的 journal：從 hub 最後收到的 seq 之後補拿
+      if (!replay.empty()) node.conn->sendText(replay);
+      printf("[hub] reader %s 連上 (%s:%u)\n", node.spec.id.c_str(), node.spec.host.c_str(), node.spec.port);
+    }
+    for (const ws::Message& message : messages) {
+      node.lastHeardMs = now;
+      if (message.binary) continue;   // hub 跟 reader 之間只用 JSON
+      if (verbose_) printf("[hub] ← %s: %s\n", node.spec.id.c_str(), message.data.c_str());
+      std::string reply = agg_->fromNode(node.index, message.data, now);
+      if (!reply.empty()) node.conn->sendText(reply);
+    }
+    if (node.conn->isOpen() && now >= node.nextHeartbeatMs) {
+      node.conn->sendText(agg_->heartbeat(node.index, now));
+      node.nextHeartbeatMs = now + heartbeatMs_;
+    }
+
+    // 三個 heartbeat 週期都沒聲音 = 當掉 / 斷電（TCP 不一定會知道）
+    bool silent = now - node.lastHeardMs > 3 * heartbeatMs_;
+    if (node.conn->isClosed() || silent) {
+      if (node.announced) {
+        printf("[hub] reader %s 斷線%s\n", node.spec.id.c_str(), silent ? "（沒有回應）" : "");
+        agg_->nodeOffline(node.index, now);
+      }
+      node.announced = false;
+      retryLater(node, now);
+    }
+  }
+
+  void serviceDisplay(Display& display, short revents, int64_t now) {
+    std::vector<ws::Message> messages;
+    if (revents & (POLLIN | POLLHUP | POLLERR)) display.conn->onReadable(&messages);
+    if ((revents & POLLOUT) && !display.conn->isClosed()) display.conn->onWritable();
+    if (!display.conn->isOpen()) return;
+
+    if (!display.welcomed) {
+      display.welcomed = true;
+      display.conn->sendText(agg_->welcome());
+    }
+    for (const ws::Message& message : messages) {
+      if (message.binary) continue;   // 二進位協定只在 firmware 直連時協商；hub 沒回 HELLO，前端會維持 JSON
+      hub::Aggregator::Route route = agg_->fromDisplay(message.data, now);
+      for (const std::string& reply : route.replies) display.conn->sendText(reply);
+      for (int index : route.nodes) {
+        for (Node& node : nodes_) {
+          if (node.index == index && node.conn && node.conn->isOpen()) node.conn->sendText(route.text);
+        }
+      }
+    }
+  }
+
+  hub::Aggregator* agg_;
+  int listenFd_;
+  int64_t heartbeatMs_;
+  bool verbose_;
+  std::vector<Node> nodes_;
+  std::vector<Display> displays_;
+};
+
+// ===== selftest =====
+int g_checksFailed = 0;
+
+void check(bool ok, const char* what) {
+  printf("  [%s] %s\n", ok ? "ok" : "FAIL", what);
+  if (!ok) g_checksFailed++;
+}
+
+// 模擬一台 controller：WebSocket server，時鐘 = hub 時鐘 + skewMs，事件晚 delayMs 才送出
+class FakeNode {
+ public:
+  FakeNode(int64_t skewMs, int64_t delayMs) : skewMs_(skewMs), delayMs_(delayMs) {
+    listenFd_ = ws::listenTcp(0, &port_);
+  }
+  ~FakeNode() { shutdown(); }
+
+  uint16_t port() const { return port_; }
+  int64_t deviceMs(int64_t hubMs) const { return hubMs + skewMs_; }
+  const std::vector<std::string>& received() const { return received_; }
+
+  // hubMs 時發生的事件（一個或一批，跟 EventQueue 送出的格式一樣）
+  void emit(const std::vector<std::string>& eventsJson, int64_t hubMs) {
+    seq_++;
+    std::string t = std::to_string(deviceMs(hubMs));
+    std::string frame;
+    if (eventsJson.size() == 1) {
+      frame = eventsJson[0].substr(0, eventsJson[0].size() - 1) + ",\"seq\":" + std::to_string(seq_) +
+              ",\"t\":" + t + "}";
+    } else {
+      frame = "{\"type\":\"events\",\"seq\":" + std::to_string(seq_) + ",\"t\":" + t + ",\"events\":[";
+      for (size_t i = 0; i < eventsJson.size(); i++) frame += (i ? "," : "") + eventsJson[i];
+      frame += "]}";
+    }
+    outgoing_.push_back(Outgoing{hubMs + delayMs_, frame});
+  }
+
+  void poll(int64_t now) {
+    if (listenFd_ < 0) return;
+    int fd;
+    while ((fd = ws::acceptTcp(listenFd_)) >= 0) {
+      conns_.push_back(std::unique_ptr<ws::Connection>(new ws::Connection(fd, ws::Connection::SERVER_SIDE)));
+      welcomed_.push_back(false);
+    }
+    for (size_t i = 0; i < conns_.size(); i++) {
+      ws::Connection& conn = *conns_[i];
+      std::vector<ws::Message> messages;
+      conn.onReadable(&messages);
+      if (!conn.isOpen()) continue;
+      if (!welcomed_[i]) {
+        welcomed_[i] = true;
+        conn.sendText("{\"type\":\"connected\",\"message\":\"Connected to NFC Controller\"}");
+      }
+      for (const ws::Message& message : messages) {
+        if (message.data == "{\"type\":\"heartbeat\"}") {
+          conn.sendText("{\"type\":\"heartbeat\",\"t\":" + std::to_string(deviceMs(now)) + "}");
+        } else {
+          received_.push_back(message.data);
+        }
+      }
+      for (size_t k = 0; k < outgoing_.size();) {
+        if (outgoing_[k].atMs <= now) {
+          conn.sendText(outgoing_[k].text);
+          outgoing_.erase(outgoing_.begin() + k);
+        } else {
+          k++;
+        }
+      }
+      conn.onWritable();
+    }
+  }
+
+  // 斷電：listen socket 跟連線都關掉
+  void shutdown() {
+    conns_.clear();
+    if (listenFd_ >= 0) ::close(listenFd_);
+    listenFd_ = -1;
+  }
+
+ private:
+  struct Outgoing {
+    int64_t atMs;
+    std::string text;
+  };
+
+  int64_t skewMs_;
+  int64_t delayMs_;
+  int listenFd_ = -1;
+  uint16_t port_ = 0;
+  uint32_t seq_ = 0;
+  std::vector<std::unique_ptr<ws::Connection>> conns_;
+  std::vector<bool> welcomed_;
+  std::vector<Outgoing> outgoing_;
+  std::vector<std::string> received_;
+};
+
+// 顯示端（瀏覽器）：收到的訊息都留著
+struct FakeDisplay {
+  std::unique_ptr<ws::Connection> conn;
+  std::vector<std::string> received;
+
+  void poll() {
+    pollfd pfd = {conn->fd(), (short)(POLLIN | (conn->wantsWrite() ? POLLOUT : 0)), 0};
+    ::poll(&pfd, 1, 0);
+    std::vector<ws::Message> messages;
+    if (pfd.revents & (POLLIN | POLLHUP | POLLERR)) conn->onReadable(&messages);
+    if (pfd.revents & POLLOUT) conn->onWritable();
+    for (const ws::Message& m : messages) received.push_back(m.data);
+  }
+};
+
+bool contains(const std::string& text, const char* part) { return text.find(part) != std::string::npos; }
+
+int countContaining(const std::vector<std::string>& texts, const char* part) {
+  int n = 0;
+  for (const std::string& t : texts) n += contains(t, part) ? 1 : 0;
+  return n;
+}
+
+// 合流 / 對時 / 路由的純邏輯，時間自己給
+void runCoreSelfTest() {
+  printf("== aggregator（注入時間）==\n");
+  {
+    std::vector<hub::Member> members;
+    check(hub::splitObject("{\"type\":\"a\\\"b\",\"n\":-12,\"o\":{\"x\":[1,\"]\"]},\"b\":true}", &members) &&
+              members.size() == 4 && hub::stringValue(&members[0]) == "a\"b" && members[2].raw == "{\"x\":[1,\"]\"]}",
+          "splitObject: escape / 巢狀 / 字串裡的括號");
+    int64_t n = 0;
+    check(hub::intValue(&members[1], &n) && n == -12, "intValue");
+    check(!hub::splitObject("{\"a\":1", &members) && !hub::splitObject("[1]", &members), "壞掉的 JSON 回 false");
+  }
+  {
+    hub::ClockSync clock;
+    clock.onHeartbeat(1000, 1040, 51020);   // RTT 40
+    clock.onHeartbeat(2000, 2004, 52001);   // RTT 4：比較準，換掉
+    clock.onHeartbeat(3000, 3100, 53090);   // RTT 100：不換
+    check(clock.synced() && clock.rttMs() == 4 && clock.offsetMs() == 50000 - 1, "對時取 RTT 最小的樣本");
+    hub::ClockSync fallback;
+    fallback.onEvent(70000, 1010);
+    fallback.onEvent(70500, 1505);
+    check(!fallback.synced() && fallback.offsetMs() == 68995, "沒有 heartbeat 樣本：用事件的下界");
+  }
+
+  hub::Aggregator agg(60);
+  int a = agg.addNode("p1");
+  int b = agg.addNode("p2");
+  agg.nodeOnline(a, 0);
+  agg.nodeOnline(b, 0);
+  agg.takeForDisplays(0);
+  agg.heartbeat(a, 100);
+  agg.fromNode(a, "{\"type\":\"heartbeat\",\"t\":10102}", 104);   // p1 = hub + 10000
+  agg.heartbeat(b, 100);
+  agg.fromNode(b, "{\"type\":\"heartbeat\",\"t\":-398}", 104);    // p2 = hub - 500
+
+  // p2 的事件 (hub 1000) 比 p1 的 (hub 1005) 早發生，但晚 30ms 才到
+  agg.fromNode(a, "{\"type\":\"nfc_hold_start\",\"uid\":\"04:AA\",\"seq\":1,\"t\":11005}", 1010);
+  agg.fromNode(b, "{\"type\":\"events\",\"seq\":1,\"t\":500,\"events\":[{\"type\":\"show_context\",\"uid\":\"04:BB\"},"
+                  "{\"type\":\"nfc_hold_start\",\"uid\":\"04:BB\"}]}", 1030);
+  check(agg.takeForDisplays(1050).empty(), "window 內先不放");
+  std::vector<std::string> out = agg.takeForDisplays(1070);
+  check(out.size() == 1 && contains(out[0], "\"type\":\"events\"") && contains(out[0], "\"seq\":1,\"t\":1000"),
+        "到期的事件合成一個 frame（hub seq / hub 時間）");
+  size_t first = out.empty() ? 0 : out[0].find("04:BB");
+  size_t second = out.empty() ? 0 : out[0].find("04:AA");
+  check(!out.empty() && first < second && contains(out[0], "\"uid\":\"04:BB\",\"reader\":\"p2\",\"t\":1000") &&
+            contains(out[0], "\"uid\":\"04:AA\",\"reader\":\"p1\",\"t\":1005"),
+        "依對齊後的時間排序、標上 reader");
+  check(agg.lastScanNode() == a, "最後掃到卡的是 p1");
+
+  // 太晚到：順序救不回來，t 拉到已送出的最後時間
+  agg.fromNode(b, "{\"type\":\"nfc_hold_end\",\"uid\":\"04:BB\",\"seq\":3,\"t\":498}", 1200);
+  out = agg.takeForDisplays(1300);
+  check(out.size() == 1 && contains(out[0], "\"reader\":\"p2\",\"seq\":2,\"t\":1005") && agg.lateEvents() == 1,
+        "太晚到的事件照送，記一次 late");
+  check(agg.seqGaps(b) == 1, "seq 跳號記下來");
+
+  // 不是事件的訊息立刻轉送；自己的 heartbeat / connected 不轉
+  agg.fromNode(a, "{\"type\":\"led_state\",\"mode\":\"revealed\",\"progress\":0.00}", 1400);
+  agg.fromNode(a, "{\"type\":\"connected\",\"message\":\"Connected to NFC Controller\"}", 1400);
+  out = agg.takeForDisplays(1400);
+  check(out.size() == 1 && out[0] == "{\"type\":\"led_state\",\"mode\":\"revealed\",\"progress\":0.00,\"reader\":\"p1\"}",
+        "led_state 標上 reader 立刻轉送");
+
+  hub::Aggregator::Route route = agg.fromDisplay("{\"type\":\"led_mode\",\"mode\":\"revealed\"}", 1500);
+  check(route.nodes.size() == 1 && route.nodes[0] == a, "沒指定 reader 的燈條指令 → 最後掃到卡的");
+  route = agg.fromDisplay("{\"type\":\"led_progress\",\"value\":0.5,\"reader\":\"p2\"}", 1500);
+  check(route.nodes.size() == 1 && route.nodes[0] == b && route.text == "{\"type\":\"led_progress\",\"value\":0.5}",
+        "指定 reader → 只送那台，去掉 reader 欄位");
+  route = agg.fromDisplay("{\"type\":\"led_play\",\"offset\":1200}", 1500);
+  check(route.nodes.size() == 1 && route.nodes[0] == a, "timeline 的 play 也跟著最後掃到卡的");
+  route = agg.fromDisplay("{\"type\":\"stats\"}", 1500);
+  check(route.nodes.size() == 2, "其他指令送給所有 reader");
+  route = agg.fromDisplay("{\"type\":\"heartbeat\"}", 1500);
+  check(route.nodes.empty() && route.replies.size() == 1 && route.replies[0] == "{\"type\":\"heartbeat\",\"t\":1500}",
+        "heartbeat 由 hub 自己回");
+  route = agg.fromDisplay("{\"type\":\"led_mode\",\"mode\":\"idle\",\"reader\":\"p9\"}", 1500);
+  check(route.nodes.empty() && route.replies.size() == 1 && contains(route.replies[0], "unknown_reader"),
+        "不認得的 reader 回 route_error");
+
+  agg.nodeOffline(a, 1600);
+  out = agg.takeForDisplays(1600);
+  check(out.size() == 1 && contains(out[0], "\"type\":\"reader_offline\",\"reader\":\"p1\""), "斷線通知");
+  route = agg.fromDisplay("{\"type\":\"led_mode\",\"mode\":\"idle\"}", 1700);
+  check(route.nodes.size() == 1 && route.nodes[0] == b, "最後掃卡的那台離線 → 送給還在線的");
+
+  // p1 重連：要它 journal 裡 seq 1 之後的；補回來的照常合流，跟即時送的重疊的丟掉
+  printf("== replay ==\n");
+  std::string request = agg.nodeOnline(a, 2000);
+  check(request == "{\"type\":\"replay\",\"after\":1}", "reader 重連 → 從最後收到的 seq 要 replay");
+  agg.heartbeat(a, 2000);
+  agg.fromNode(a, "{\"type\":\"heartbeat\",\"t\":12002}", 2004);
+  agg.fromNode(a, "{\"type\":\"nfc_hold_end\",\"uid\":\"04:AA\",\"seq\":2,\"t\":11800}", 2010);
+  agg.fromNode(a, "{\"type\":\"nfc_hold_end\",\"uid\":\"04:AA\",\"seq\":2,\"t\":11800}", 2011);
+  std::string next = agg.fromNode(a, "{\"type\":\"replay_done\",\"after\":1,\"last\":2,\"more\":true,\"lost\":0}", 2012);
+  check(agg.duplicates(a) == 1 && next == "{\"type\":\"replay\",\"after\":2}", "重複的 seq 丟掉；more → 接著要");
+  next = agg.fromNode(a, "{\"type\":\"replay_done\",\"after\":2,\"last\":2,\"more\":false,\"lost\":3}", 2013);
+  out = agg.takeForDisplays(2100);
+  check(next.empty() && agg.replayLost(a) == 3 && out.size() == 2 && contains(out[0], "reader_online") &&
+            contains(out[1], "\"uid\":\"04:AA\",\"reader\":\"p1\",\"seq\":3,\"t\":1800"),
+        "補回來的事件照裝置時間對齊送出，replay_done 不轉給顯示端");
+
+  // 沒有 journal 的舊 firmware 重開機：重連後第一個 frame seq 就變小，也不回 replay_done
+  agg.nodeOffline(b, 2200);
+  agg.nodeOnline(b, 2300);
+  agg.fromNode(b, "{\"type\":\"nfc_hold_start\",\"uid\":\"04:CC\",\"seq\":1,\"t\":50}", 2400);
+  out = agg.takeForDisplays(2600);
+  check(agg.duplicates(b) == 0 && out.size() == 3 && contains(out[2], "04:CC"), "舊 firmware 重開機：seq 重新起算");
+
+  // 顯示端重連：hub 用自己的 seq 補
+  route = agg.fromDisplay("{\"type\":\"replay\",\"after\":2}", 2700);
+  check(route.nodes.empty() && route.replies.size() == 3 && contains(route.replies[0], "\"seq\":3") &&
+            contains(route.replies[1], "\"seq\":4") &&
+            route.replies[2] == "{\"type\":\"replay_done\",\"after\":2,\"last\":4,\"more\":false,\"lost\":0}",
+        "顯示端 replay 從 hub 的 history 回，格式跟 firmware 一樣");
+  route = agg.fromDisplay("{\"type\":\"replay\",\"after\":900}", 2700);
+  check(route.replies.size() == 1 && contains(route.replies[0], "\"last\":4,\"more\":false,\"lost\":0,\"reset\":true"),
+        "顯示端的 seq 比 hub 新（hub 重開過）→ reset");
+}
+
+// 真的 socket：三台模擬 controller + 一個顯示端，都在 localhost
+void runLoopbackSelfTest() {
+  printf("== localhost 三台 controller ==\n");
+  FakeNode p1(+100000, 0), p2(-5000, 0), p3(+777, 30);
+  uint16_t hubPort = 0;
+  int listenFd = ws::listenTcp(0, &hubPort);
+  check(listenFd >= 0 && p1.port() && p2.port() && p3.port(), "listen 在 ephemeral port");
+  if (listenFd < 0) return;
+
+  hub::Aggregator agg(60);
+  std::vector<NodeSpec> specs = {
+    {"p1", "127.0.0.1", p1.port()}, {"p2", "127.0.0.1", p2.port()}, {"p3", "127.0.0.1", p3.port()},
+  };
+  Hub hubLoop(&agg, listenFd, specs, 50, false);
+  FakeDisplay display;
+
+  auto pump = [&](int64_t ms) {
+    int64_t until = nowMs() + ms;
+    while (nowMs() < until) {
+      hubLoop.poll(1);
+      int64_t now = nowMs();
+      p1.poll(now);
+      p2.poll(now);
+      p3.poll(now);
+      if (display.conn) display.poll();
+    }
+  };
+
+  pump(300);   // 連上 + 幾輪 heartbeat 對時
+  check(agg.isOnline(0) && agg.isOnline(1) && agg.isOnline(2), "三台都連上");
+  check(agg.clock(0).synced() && agg.clock(1).synced() && agg.clock(2).synced(), "三台都對好時");
+  int64_t err = std::max({std::llabs(agg.clock(0).offsetMs() - 100000), std::llabs(agg.clock(1).offsetMs() + 5000),
+                          std::llabs(agg.clock(2).offsetMs() - 777)});
+  printf("  offset 誤差最大 %lld ms\n", (long long)err);
+  check(err <= 5, "offset 誤差 ≤ 5ms");
+
+  display.conn.reset(new ws::Connection(ws::connectTcp("127.0.0.1", hubPort), ws::Connection::CLIENT_SIDE,
+                                        "127.0.0.1", "/?proto=bin"));
+  pump(100);
+  check(!display.received.empty() && contains(display.received[0], "\"type\":\"connected\"") &&
+            contains(display.received[0], "\"readers\":[\"p1\",\"p2\",\"p3\"]"),
+        "顯示端連上收到 connected + reader 清單");
+
+  // p3 先發生但晚 30ms 才送；p2 一次送兩個事件
+  int64_t base = nowMs();
+  p3.emit({"{\"type\":\"nfc_hold_end\",\"uid\":\"04:33\"}"}, base);
+  p1.emit({"{\"type\":\"show_context\",\"uid\":\"04:11\",\"quoteNumber\":11}"}, base + 10);
+  p2.emit({"{\"type\":\"show_context\",\"uid\":\"04:22\",\"quoteNumber\":22}",
+           "{\"type\":\"nfc_hold_start\",\"uid\":\"04:22\"}"}, base + 20);
+  size_t mark = display.received.size();
+  pump(250);
+
+  std::vector<std::string> readers;
+  std::vector<int64_t> times;
+  for (size_t i = mark; i < display.received.size(); i++) {
+    std::vector<hub::Member> frame;
+    if (!hub::splitObject(display.received[i], &frame)) continue;
+    std::vector<std::string> items;
+    const hub::Member* list = hub::findMember(frame, "events");
+    if (list) hub::splitArray(list->raw, &items);
+    else items.push_back(display.received[i]);
+    for (const std::string& item : items) {
+      std::vector<hub::Member> event;
+      int64_t t;
+      if (hub::splitObject(item, &event) && hub::intValue(hub::findMember(event, "t"), &t)) {
+        readers.push_back(hub::stringValue(hub::findMember(event, "reader")));
+        times.push_back(t - base);
+      }
+    }
+  }
+  std::string order;
+  for (size_t i = 0; i < readers.size(); i++) {
+    order += (i ? " " : "") + readers[i] + "@" + std::to_string(times[i]);
+  }
+  printf("  顯示端收到：%s\n", order.c_str());
+  check(readers == std::vector<std::string>({"p3", "p1", "p2", "p2"}), "依發生時間合流（p3 晚送也排第一）");
+  check(std::is_sorted(times.begin(), times.end()) && !times.empty() && std::llabs(times[0]) <= 5 &&
+            std::llabs(times.back() - 20) <= 5,
+        "t 換成 hub 時間、不倒退");
+
+  // 顯示端的指令：沒指定 → 最後掃到卡的 p2；指定 p1 → 只送 p1
+  display.conn->sendText("{\"type\":\"led_mode\",\"mode\":\"revealed\"}");
+  display.conn->sendText("{\"type\":\"led_progress\",\"value\":0.5,\"reader\":\"p1\"}");
+  display.conn->sendText("{\"type\":\"heartbeat\"}");
+  mark = display.received.size();
+  pump(100);
+  check(p2.received().size() == 1 && p2.received()[0] == "{\"type\":\"led_mode\",\"mode\":\"revealed\"}" &&
+            p3.received().empty(),
+        "led_mode 送到最後掃到卡的 reader");
+  check(p1.received().size() == 1 && p1.received()[0] == "{\"type\":\"led_progress\",\"value\":0.5}",
+        "指定 reader 的 led_progress 只送那台");
+  check(countContaining(std::vector<std::string>(display.received.begin() + mark, display.received.end()),
+                        "\"type\":\"heartbeat\"") == 1,
+        "顯示端 heartbeat 由 hub 回");
+
+  // p1 斷電
+  mark = display.received.size();
+  p1.shutdown();
+  pump(300);
+  std::vector<std::string> after(display.received.begin() + mark, display.received.end());
+  check(!agg.isOnline(0) && countContaining(after, "\"type\":\"reader_offline\",\"reader\":\"p1\"") == 1,
+        "reader 斷線 → 顯示端收到 reader_offline");
+  check(agg.isOnline(1) && agg.isOnline(2), "其他 reader 照常");
+
+  display.conn.reset();
+  ::close(listenFd);
+}
+
+int runSelfTest() {
+  runCoreSelfTest();
+  runLoopbackSelfTest();
+  printf("\n%s (%d failed)\n", g_checksFailed ? "HUB SELFTEST FAILED" : "hub selftest passed", g_checksFailed);
+  return g_checksFailed ? 1 : 0;
+}
+
+void usage(const char* argv0) {
+  fprintf(stderr,
+          "用法: %s --listen PORT --node ID=HOST:PORT [--node ...] [--window-ms MS] [--heartbeat-ms MS] [-v]\n"
+          "      %s --selftest\n",
+          argv0, argv0);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  uint16_t listenPort = 8081;
+  int64_t windowMs = 60;
+  int64_t heartbeatMs = 1000;
+  bool verbose = false;
+  std::vector<NodeSpec> specs;
+
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (strcmp(arg, "--selftest") == 0) return runSelfTest();
+    if (strcmp(arg, "--listen") == 0 && hasValue) {
+      listenPort = (uint16_t)atoi(argv[++i]);
+    } else if (strcmp(arg, "--node") == 0 && hasValue) {
+      NodeSpec spec;
+      if (!parseNodeSpec(argv[++i], &spec)) {
+        fprintf(stderr, "--node 格式是 ID=HOST:PORT：%s\n", argv[i]);
+        return 2;
+      }
+      specs.push_back(spec);
+    } else if (strcmp(arg, "--window-ms") == 0 && hasValue) {
+      windowMs = atoi(argv[++i]);
+    } else if (strcmp(arg, "--heartbeat-ms") == 0 && hasValue) {
+      heartbeatMs = std::max(100, atoi(argv[++i]));
+    } else if (strcmp(arg, "-v") == 0) {
+      verbose = true;
+    } else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+  if (specs.empty()) {
+    usage(argv[0]);
+    return 2;
+  }
+
+  int listenFd = ws::listenTcp(listenPort, &listenPort);
+  if (listenFd < 0) {
+    perror("listen");
+    return 1;
+  }
+  printf("[hub] 顯示端連 ws://<這台的 IP>:%u，%zu 台 reader，合流 window %lld ms\n", listenPort, specs.size(),
+         (long long)windowMs);
+
+  hub::Aggregator aggregator(windowMs);
+  Hub hubLoop(&aggregator, listenFd, specs, heartbeatMs, verbose);
+  for (;;) hubLoop.poll(50);
+}
@@ -0,0 +1,406 @@
+#include "ws_socket.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <random>
+
+namespace ws {
+
+namespace {
+
+const char* const kGuid = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+const size_t kMaxMessage = 64 * 1024;   // firmware 最大的訊息（stats）也才幾百 bytes
+
+enum Opcode : uint8_t {
+  OP_CONTINUATION = 0x0,
+  OP_TEXT = 0x1,
+  OP_BINARY = 0x2,
+  OP_CLOSE = 0x8,
+  OP_PING = 0x9,
+  OP_PONG = 0xA,
+};
+
+uint32_t rol(uint32_t v, int n) { return (v << n) | (v >> (32 - n)); }
+
+bool setNonBlocking(int fd) {
+  int flags = fcntl(fd, F_GETFL, 0);
+  if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) return false;
+  int one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  return true;
+}
+
+// "Sec-WebSocket-Key: xxx" → "xxx"（header 名稱不分大小寫）
+std::string headerValue(const std::string& head, const char* name) {
+  size_t nameLength = strlen(name);
+  size_t pos = 0;
+  while ((pos = head.find("\r\n", pos)) != std::string::npos) {
+    pos += 2;
+    if (head.size() - pos > nameLength && strncasecmp(head.c_str() + pos, name, nameLength) == 0 &&
+        head[pos + nameLength] == ':') {
+      size_t begin = pos + nameLength + 1;
+      size_t end = head.find("\r\n", begin);
+      while (begin < end && head[begin] == ' ') begin++;
+      return head.substr(begin, end - begin);
+    }
+  }
+  return "";
+}
+
+}  // namespace
+
+void sha1(const uint8_t* data, size_t length, uint8_t out[20]) {
+  uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+  std::string msg(reinterpret_cast<const char*>(data), length);
+  msg += '\x80';
+  while (msg.size() % 64 != 56) msg += '\0';
+  uint64_t bits = (uint64_t)length * 8;
+  for (int i = 7; i >= 0; i--) msg += (char)(bits >> (i * 8));
+
+  for (size_t chunk = 0; chunk < msg.size(); chunk += 64) {
+    uint32_t w[80];
+    for (int i = 0; i < 16; i++) {
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(msg.data()) + chunk + i * 4;
+      w[i] = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+    }
+    for (int i = 16; i < 80; i++) w[i] = rol(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+    for (int i = 0; i < 80; i++) {
+      uint32_t f, k;
+      if (i < 20) {
+        f = (b & c) | (~b & d);
+        k = 0x5A827999;
+      } else if (i < 40) {
+        f = b ^ c ^ d;
+        k = 0x6ED9EBA1;
+      } else if (i < 60) {
+        f = (b & c) | (b & d) | (c & d);
+        k = 0x8F1BBCDC;
+      } else {
+        f = b ^ c ^ d;
+        k = 0xCA62C1D6;
+      }
+      uint32_t temp = rol(a, 5) + f + e + k + w[i];
+      e = d;
+      d = c;
+      c = rol(b, 30);
+      b = a;
+      a = temp;
+    }
+    h[0] += a;
+    h[1] += b;
+    h[2] += c;
+    h[3] += d;
+    h[4] += e;
+  }
+  for (int i = 0; i < 5; i++) {
+    out[i * 4] = (uint8_t)(h[i] >> 24);
+    out[i * 4 + 1] = (uint8_t)(h[i] >> 16);
+    out[i * 4 + 2] = (uint8_t)(h[i] >> 8);
+    out[i * 4 + 3] = (uint8_t)h[i];
+  }
+}
+
+std::string base64(const uint8_t* data, size_t length) {
+  static const char kTable[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string out;
+  for (size_t i = 0; i < length; i += 3) {
+    uint32_t v = (uint32_t)data[i] << 16;
+    if (i + 1 < length) v |= (uint32_t)data[i + 1] << 8;
+    if (i + 2 < length) v |= data[i + 2];
+    out += kTable[(v >> 18) & 0x3F];
+    out += kTable[(v >> 12) & 0x3F];
+    out += i + 1 < length ? kTable[(v >> 6) & 0x3F] : '=';
+    out += i + 2 < length ? kTable[v & 0x3F] : '=';
+  }
+  return out;
+}
+
+std::string acceptKey(const std::string& key) {
+  std::string text = key + kGuid;
+  uint8_t digest[20];
+  sha1(reinterpret_cast<const uint8_t*>(text.data()), text.size(), digest);
+  return base64(digest, sizeof(digest));
+}
+
+int listenTcp(uint16_t port, uint16_t* boundPort) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) return -1;
+  int one = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  addr.sin_port = htons(port);
+  if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 || listen(fd, 16) < 0 ||
+      !setNonBlocking(fd)) {
+    ::close(fd);
+    return -1;
+  }
+  if (boundPort) {
+    socklen_t addrLength = sizeof(addr);
+    getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &addrLength);
+    *boundPort = ntohs(addr.sin_port);
+  }
+  return fd;
+}
+
+int connectTcp(const std::string& host, uint16_t port) {
+  addrinfo hints = {};
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  addrinfo* result = nullptr;
+  if (getaddrinfo(host.c_str(), nullptr, &hints, &result) != 0 || !result) return -1;
+  sockaddr_in addr = *reinterpret_cast<sockaddr_in*>(result->ai_addr);
+  freeaddrinfo(result);
+  addr.sin_port = htons(port);
+
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) return -1;
+  if (!setNonBlocking(fd)) {
+    ::close(fd);
+    return -1;
+  }
+  if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 && errno != EINPROGRESS) {
+    ::close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+int acceptTcp(int listenFd) {
+  int fd = accept(listenFd, nullptr, nullptr);
+  if (fd < 0) return -1;
+  if (!setNonBlocking(fd)) {
+    ::close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+Connection::Connection(int fd, Role role, const std::string& host, const std::string& path)
+    : fd_(fd), role_(role), state_(role == CLIENT_SIDE ? STATE_CONNECTING : STATE_HANDSHAKE), path_(path) {
+  if (role_ == CLIENT_SIDE) {
+    static std::mt19937 rng(std::random_device{}());
+    uint8_t nonce[16];
+    for (uint8_t& b : nonce) b = (uint8_t)rng();
+    key_ = base64(nonce, sizeof(nonce));
+    out_ = "GET " + path_ + " HTTP/1.1\r\nHost: " + host + "\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n" +
+           "Sec-WebSocket-Key: " + key_ + "\r\nSec-WebSocket-Version: 13\r\n\r\n";
+  }
+}
+
+Connection::~Connection() {
+  if (fd_ >= 0) ::close(fd_);
+}
+
+void Connection::onReadable(std::vector<Message>* messages) {
+  if (state_ == STATE_CLOSED) return;
+  char buf[4096];
+  for (;;) {
+    ssize_t n = recv(fd_, buf, sizeof(buf), 0);
+    if (n > 0) {
+      in_.append(buf, (size_t)n);
+      continue;
+    }
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+    if (n < 0 && errno == EINTR) continue;
+    state_ = STATE_CLOSED;   // 0 = 對方關了；其他錯誤一樣當斷線
+    break;
+  }
+  if (state_ == STATE_HANDSHAKE && !handshake()) return;
+  if (state_ == STATE_OPEN && !parseFrames(messages)) state_ = STATE_CLOSED;
+}
+
+void Connection::onWritable() {
+  if (state_ == STATE_CONNECTING) {
+    int err = 0;
+    socklen_t errLength = sizeof(err);
+    if (getsockopt(fd_, SOL_SOCKET, SO_ERROR, &err, &errLength) < 0 || err != 0) {
+      state_ = STATE_CLOSED;
+      return;
+    }
+    state_ = STATE_HANDSHAKE;
+  }
+  flush();
+}
+
+void Connection::sendText(const std::string& text) {
+  if (state_ == STATE_OPEN) queueFrame(OP_TEXT, text);
+}
+
+void Connection::sendBinary(const std::string& data) {
+  if (state_ == STATE_OPEN) queueFrame(OP_BINARY, data);
+}
+
+void Connection::close() {
+  if (state_ == STATE_OPEN) {
+    queueFrame(OP_CLOSE, std::string("\x03\xE8", 2));   // 1000 normal closure
+    flush();
+  }
+  state_ = STATE_CLOSED;
+}
+
+// 收齊 HTTP header（\r\n\r\n）才處理；成功 → STATE_OPEN，header 後面多讀到的留在 in_ 當 frame
+bool Connection::handshake() {
+  size_t end = in_.find("\r\n\r\n");
+  if (end == std::string::npos) {
+    if (in_.size() > 8192) state_ = STATE_CLOSED;
+    return false;
+  }
+  std::string head = in_.substr(0, end + 2);
+  in_.erase(0, end + 4);
+
+  if (role_ == SERVER_SIDE) {
+    std::string key = headerValue(head, "Sec-WebSocket-Key");
+    size_t pathBegin = head.find(' ');
+    size_t pathEnd = pathBegin == std::string::npos ? pathBegin : head.find(' ', pathBegin + 1);
+    if (head.compare(0, 4, "GET ") != 0 || key.empty() || pathEnd == std::string::npos) {
+      out_ = "HTTP/1.1 400 Bad Request\r\nContent-Length: 0\r\n\r\n";
+      flush();
+      state_ = STATE_CLOSED;
+      return false;
+    }
+    path_ = head.substr(pathBegin + 1, pathEnd - pathBegin - 1);
+    out_ += "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+            "Sec-WebSocket-Accept: " + acceptKey(key) + "\r\n\r\n";
+    flush();
+  } else {
+    if (head.compare(0, 12, "HTTP/1.1 101") != 0 ||
+        headerValue(head, "Sec-WebSocket-Accept") != acceptKey(key_)) {
+      state_ = STATE_CLOSED;
+      return false;
+    }
+  }
+  state_ = STATE_OPEN;
+  return true;
+}
+
+// in_ 裡完整的 frame 一個一個拆出來；回傳 false = 協定錯誤或收到 close
+bool Connection::parseFrames(std::vector<Message>* messages) {
+  size_t pos = 0;
+  bool ok = true;
+  while (ok) {
+    if (in_.size() - pos < 2) break;
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(in_.data()) + pos;
+    bool fin = p[0] & 0x80;
+    uint8_t opcode = p[0] & 0x0F;
+    bool masked = p[1] & 0x80;
+    uint64_t length = p[1] & 0x7F;
+    size_t header = 2;
+    if (length == 126) {
+      if (in_.size() - pos < 4) break;
+      length = ((uint64_t)p[2] << 8) | p[3];
+      header = 4;
+    } else if (length == 127) {
+      if (in_.size() - pos < 10) break;
+      length = 0;
+      for (int i = 0; i < 8; i++) length = (length << 8) | p[2 + i];
+      header = 10;
+    }
+    // client → server 一定要 mask，server → client 一定不能
+    if (length > kMaxMessage || masked != (role_ == SERVER_SIDE)) {
+      ok = false;
+      break;
+    }
+    size_t maskOffset = header;
+    if (masked) header += 4;
+    if (in_.size() - pos < header + length) break;
+
+    std::string payload(in_, pos + header, (size_t)length);
+    if (masked) {
+      for (size_t i = 0; i < payload.size(); i++) payload[i] ^= (char)p[maskOffset + (i & 3)];
+    }
+    pos += header + (size_t)length;
+
+    switch (opcode) {
+      case OP_TEXT:
+      case OP_BINARY:
+      case OP_CONTINUATION:
+        if (opcode != OP_CONTINUATION) {
+          fragmentOpcode_ = opcode;
+          fragments_.clear();
+        } else if (fragmentOpcode_ == 0) {
+          ok = false;
+          break;
+        }
+        fragments_ += payload;
+        if (fragments_.size() > kMaxMessage) {
+          ok = false;
+          break;
+        }
+        if (fin) {
+          messages->push_back(Message{fragmentOpcode_ == OP_BINARY, fragments_});
+          fragments_.clear();
+          fragmentOpcode_ = 0;
+        }
+        break;
+      case OP_PING:
+        queueFrame(OP_PONG, payload);
+        break;
+      case OP_PONG:
+        break;
+      case OP_CLOSE:
+        queueFrame(OP_CLOSE, payload.substr(0, 2));
+        flush();
+        ok = false;
+        break;
+      default:
+        ok = false;
+        break;
+    }
+  }
+  in_.erase(0, pos);
+  return ok;
+}
+
+void Connection::queueFrame(uint8_t opcode, const std::string& payload) {
+  out_ += (char)(0x80 | opcode);
+  uint8_t maskBit = role_ == CLIENT_SIDE ? 0x80 : 0x00;
+  size_t length = payload.size();
+  if (length < 126) {
+    out_ += (char)(maskBit | length);
+  } else if (length <= 0xFFFF) {
+    out_ += (char)(maskBit | 126);
+    out_ += (char)(length >> 8);
+    out_ += (char)length;
+  } else {
+    out_ += (char)(maskBit | 127);
+    for (int i = 7; i >= 0; i--) out_ += (char)((uint64_t)length >> (i * 8));
+  }
+  if (role_ == CLIENT_SIDE) {
+    static std::mt19937 rng(std::random_device{}());
+    uint32_t mask = rng();
+    char key[4] = {(char)(mask >> 24), (char)(mask >> 16), (char)(mask >> 8), (char)mask};
+    out_.append(key, 4);
+    for (size_t i = 0; i < length; i++) out_ += (char)(payload[i] ^ key[i & 3]);
+  } else {
+    out_ += payload;
+  }
+}
+
+void Connection::flush() {
+  while (!out_.empty() && state_ != STATE_CONNECTING) {
+    ssize_t n = send(fd_, out_.data(), out_.size(), MSG_NOSIGNAL);
+    if (n > 0) {
+      out_.erase(0, (size_t)n);
+      continue;
+    }
+    if (n < 0 && errno == EINTR) continue;
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+    state_ = STATE_CLOSED;
+    break;
+  }
+}
+
+}  // namespace ws
@@ -0,0 +1,77 @@
+#pragma once
+// ===== hub 用的最小 WebSocket（RFC 6455）=====
+// 只做 hub 需要的：非阻塞 TCP、握手（client / server 兩邊）、text / binary frame、ping / pong / close。
+// 不做擴充（permessage-deflate）、不做 TLS：展場的 ESP 跟顯示端都在同一個熱點的區網裡。
+//
+// 用法：自己的 poll() 迴圈拿 fd() / wantsWrite() 組 pollfd，可讀呼叫 onReadable()、可寫呼叫 onWritable()
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace ws {
+
+// Sec-WebSocket-Accept = base64(sha1(key + GUID))
+void sha1(const uint8_t* data, size_t length, uint8_t out[20]);
+std::string base64(const uint8_t* data, size_t length);
+std::string acceptKey(const std::string& key);
+
+// port = 0 → 系統挑一個，實際的 port 放在 boundPort。失敗回 -1
+int listenTcp(uint16_t port, uint16_t* boundPort);
+// 非阻塞 connect（回傳時多半還在 EINPROGRESS，等 fd 可寫）。解析 / socket 失敗回 -1
+int connectTcp(const std::string& host, uint16_t port);
+// listen fd 上有新連線：回傳非阻塞的 fd，沒有回 -1
+int acceptTcp(int listenFd);
+
+struct Message {
+  bool binary;
+  std::string data;
+};
+
+class Connection {
+ public:
+  enum Role : uint8_t { SERVER_SIDE, CLIENT_SIDE };
+
+  // SERVER_SIDE：accept 進來的 fd，等 client 的 HTTP Upgrade
+  // CLIENT_SIDE：connectTcp() 的 fd，握手請求先排進送出 buffer（host / path 放進 GET）
+  Connection(int fd, Role role, const std::string& host = "", const std::string& path = "/");
+  ~Connection();
+  Connection(const Connection&) = delete;
+  Connection& operator=(const Connection&) = delete;
+
+  int fd() const { return fd_; }
+  bool isOpen() const { return state_ == STATE_OPEN; }
+  bool isClosed() const { return state_ == STATE_CLOSED; }
+  // SERVER_SIDE：client 要求的路徑（"/?proto=bin"）
+  const std::string& path() const { return path_; }
+  bool wantsWrite() const { return !out_.empty() || state_ == STATE_CONNECTING; }
+
+  // 讀到的完整訊息 append 到 messages；對方關掉 / 協定錯誤 → isClosed()
+  void onReadable(std::vector<Message>* messages);
+  void onWritable();
+  void sendText(const std::string& text);
+  void sendBinary(const std::string& data);
+  void close();
+
+ private:
+  enum State : uint8_t { STATE_CONNECTING, STATE_HANDSHAKE, STATE_OPEN, STATE_CLOSED };
+
+  bool handshake();
+  bool parseFrames(std::vector<Message>* messages);
+  void queueFrame(uint8_t opcode, const std::string& payload);
+  void flush();
+
+  int fd_;
+  Role role_;
+  State state_;
+  std::string path_;
+  std::string key_;        // CLIENT_SIDE：送出去的 Sec-WebSocket-Key
+  std::string in_;
+  std::string out_;
+  std::string fragments_;  // 分段訊息累積中
+  uint8_t fragmentOpcode_ = 0;
+};
+
+}  // namespace ws